@@ -5,17 +5,22 @@
 #include "app.h"
 #include "app_funcs.h"
 #include "app_ios_and_regs.h"
+#include "app_regs_tables.h"
+
+#include <avr/pgmspace.h>
 
 
 /************************************************************************/
 /* Declare application registers                                        */
 /************************************************************************/
 extern AppRegs app_regs;
+extern AppRegsShared app_regs_shared;
 extern uint8_t app_regs_type[];
 extern uint16_t app_regs_n_elements[];
 extern uint8_t *app_regs_pointer[];
-extern void (*app_func_rd_pointer[])(void);
-extern bool (*app_func_wr_pointer[])(void*);
+extern void (* const app_func_rd_pointer[])(void) PROGMEM;
+extern bool (* const app_func_wr_pointer[])(void*) PROGMEM;
+extern const AppRegsCheck app_regs_check[] PROGMEM;
 
 
 /************************************************************************/
@@ -48,201 +53,2824 @@ void hwbp_app_initialize(void)
     );
 
 }
-
-/************************************************************************/
-/* Handle if a catastrophic error occur                                 */
-/************************************************************************/
-void core_callback_catastrophic_error_detected(void)
+
+/************************************************************************/
+/* Handle if a catastrophic error occur                                 */
+/************************************************************************/
+void core_callback_catastrophic_error_detected(void)
+{
+	timer_type0_stop(&TCC0);	// Stop Cam0 or Motor0
+	timer_type0_stop(&TCD0);	// Stop Cam1 or Motor1
+	timer_type1_stop(&TCD1);	// Stop Harp clock discipline
+	timer_type0_stop(&TCE0);	// Stop DI0 period measurement
+	DMA.CH0.CTRLA = 0;			// Stop sequence mode
+	DMA.CH1.CTRLA = 0;
+
+	clr_CAM0_TRIG;
+	clr_CAM1_TRIG;
+	clr_CAM0_SYNC;
+	clr_CAM1_SYNC;
+}
+
+/************************************************************************/
+/* General definitions                                                  */
+/************************************************************************/
+// #define NBYTES 23
+
+/************************************************************************/
+/* General used functions                                               */
+/************************************************************************/
+/* Load external functions if needed */
+//#include "hwbp_app_pwm_gen_funcs.c"
+
+/************************************************************************/
+/* Harp clock discipline                                                */
+/************************************************************************/
+/* TCD1 counts the local 32 MHz clock. On each Harp second the number   */
+/* of local ticks is compared with the nominal 32000000 (only the lower */
+/* 16 bits are needed, so the error must stay under 1000 ppm). The      */
+/* camera periods are stretched by the filtered error plus a fraction   */
+/* of the accumulated phase, dithered with PERBUF on each overflow.     */
+#define CLK_TICKS_PER_SECOND_LSB ((uint16_t)(32000000UL & 0xFFFF))
+
+bool clock_discipline_on = false;
+bool clock_discipline_valid;
+uint16_t clock_discipline_last_cnt;
+int32_t clock_discipline_freq;		// Filtered error (ticks/s) x 16
+int32_t clock_discipline_trim;		// Correction applied (ticks/s)
+int32_t clock_discipline_phase;		// Residual phase (ticks)
+
+uint16_t camera0_base_per;
+uint16_t camera1_base_per;
+int32_t camera0_trim_q16;
+int32_t camera1_trim_q16;
+int32_t camera0_trim_acc;
+int32_t camera1_trim_acc;
+
+/* Timer ticks (Q16) to add to each period of <base> + 1 ticks */
+static int32_t clock_discipline_period_trim(uint16_t base)
+{
+	if (!clock_discipline_on)
+		return 0;
+	
+	return (int32_t)(((int64_t)clock_discipline_trim * ((uint32_t)base + 1) * 65536) / 32000000);
+}
+
+void clock_discipline_start(void)
+{
+	clock_discipline_valid = false;
+	clock_discipline_freq = 0;
+	clock_discipline_trim = 0;
+	clock_discipline_phase = 0;
+	
+	app_regs.REG_CLK_DRIFT[0] = 0;
+	app_regs.REG_CLK_DRIFT[1] = 0;
+	app_regs.REG_CLK_DRIFT[2] = 0;
+	app_regs.REG_CLK_DRIFT[3] = 0;
+	
+	/* A counter already running is kept, it's the ISR profiling time base */
+	if (TCD1_CTRLA != TIMER_PRESCALER_DIV1)
+	{
+		TCD1_CTRLA = 0;
+		TCD1_CTRLB = 0;
+		TCD1_INTCTRLA = 0;
+		TCD1_CNT = 0;
+		TCD1_PER = 0xFFFF;
+		TCD1_CTRLA = TIMER_PRESCALER_DIV1;
+	}
+	app_regs.REG_TIMER_OWNERS[TIMER_TCD1] = GM_TIMER_OWNER_CLK_DISCIPLINE;
+	
+	clock_discipline_on = true;
+}
+
+void clock_discipline_stop(void)
+{
+	clock_discipline_on = false;
+#ifndef ISR_PROFILING
+	timer_type1_stop(&TCD1);								// Also the ISR profiling time base
+#endif
+	app_regs.REG_TIMER_OWNERS[TIMER_TCD1] = GM_TIMER_OWNER_FREE;
+	
+	camera0_trim_q16 = 0;
+	camera1_trim_q16 = 0;
+	
+	if (app_regs.REG_TIMER_OWNERS[TIMER_TCC0] == GM_TIMER_OWNER_CAMERA)
+		TCC0_PERBUF = camera0_base_per;
+	if (app_regs.REG_TIMER_OWNERS[TIMER_TCD0] == GM_TIMER_OWNER_CAMERA)
+		TCD0_PERBUF = camera1_base_per;
+}
+
+/* Called on each new Harp second */
+static void clock_discipline_new_second(void)
+{
+	uint16_t cnt = TCD1_CNT;
+	int16_t error = (int16_t)(cnt - clock_discipline_last_cnt - CLK_TICKS_PER_SECOND_LSB);
+	
+	clock_discipline_last_cnt = cnt;
+	
+	/* The first second only holds the time since TCD1 was started */
+	if (!clock_discipline_valid)
+	{
+		clock_discipline_valid = true;
+		return;
+	}
+	
+	/* Harp time was set or jumped, skip this second */
+	if (error > 16000 || error < -16000)
+		return;
+	
+	clock_discipline_phase += error - clock_discipline_trim;
+	clock_discipline_freq += ((int32_t)error * 16 - clock_discipline_freq) >> 3;
+	clock_discipline_trim = (clock_discipline_freq >> 4) + (clock_discipline_phase >> 2);
+	
+	int32_t phase_abs = (clock_discipline_phase < 0) ? -clock_discipline_phase : clock_discipline_phase;
+	
+	app_regs.REG_CLK_DRIFT[0] = error;
+	app_regs.REG_CLK_DRIFT[1] = clock_discipline_trim;
+	app_regs.REG_CLK_DRIFT[2] = clock_discipline_phase;
+	if (phase_abs > app_regs.REG_CLK_DRIFT[3])
+		app_regs.REG_CLK_DRIFT[3] = phase_abs;
+	
+	int32_t trim0 = clock_discipline_period_trim(camera0_base_per);
+	int32_t trim1 = clock_discipline_period_trim(camera1_base_per);
+	
+	uint8_t sreg = SREG;
+	cli();
+	camera0_trim_q16 = trim0;
+	camera1_trim_q16 = trim1;
+	SREG = sreg;
+}
+
+/* Called from the camera timer overflow to load the next period */
+void clock_discipline_step(TC0_t* timer, uint16_t base, int32_t * acc, int32_t trim_q16)
+{
+	*acc += trim_q16;
+	int16_t whole = (int16_t)(*acc >> 16);
+	*acc -= (int32_t)whole << 16;
+	timer->PERBUF = base + whole;
+}
+
+/************************************************************************/
+/* Channel state                                                        */
+/************************************************************************/
+/* Each line is idle, running camera triggers or running a servo, and   */
+/* REG_TIMER_OWNERS tells which camera mode. Stops that wait for the    */
+/* end of a trigger pulse go through stopping. A start received while   */
+/* stopping is kept as starting and applied when the stop completes, so */
+/* no command of a quick start and stop sequence is lost. Transitions   */
+/* that depend on the current state are made with interrupts disabled.  */
+void channel_set_state(uint8_t channel, uint8_t state)
+{
+	if (app_regs.REG_CHANNEL_STATE[channel] == state)
+		return;
+	
+	app_regs.REG_CHANNEL_STATE[channel] = state;
+	
+	if (app_regs.REG_EVT_EN & B_EVT_CHANNELS)
+		core_func_send_event(ADD_REG_CHANNEL_STATE, true);
+}
+
+/* Returns false if the channel wasn't in the expected state */
+bool channel_transition(uint8_t channel, uint8_t from, uint8_t to)
+{
+	uint8_t sreg = SREG;
+	cli();
+	bool valid = (app_regs.REG_CHANNEL_STATE[channel] == from);
+	if (valid)
+		app_regs.REG_CHANNEL_STATE[channel] = to;
+	SREG = sreg;
+	
+	if (valid && (app_regs.REG_EVT_EN & B_EVT_CHANNELS))
+		core_func_send_event(ADD_REG_CHANNEL_STATE, true);
+	
+	return valid;
+}
+
+void channel_start(uint8_t channel);
+void servo_motion_cancel_motor0(void);
+void servo_motion_cancel_motor1(void);
+
+/* A camera start takes the timer over from a running servo, so its     */
+/* move, trajectory or setpoint stream is cancelled first.              */
+static void channel_release_servo(uint8_t channel)
+{
+	if (app_regs.REG_CHANNEL_STATE[channel] != GM_CHANNEL_SERVO)
+		return;
+	
+	if (channel == 0)
+		servo_motion_cancel_motor0();
+	else
+		servo_motion_cancel_motor1();
+}
+
+/* Camera triggers are running, even if stopping */
+bool channel_is_camera(uint8_t channel)
+{
+	uint8_t state = app_regs.REG_CHANNEL_STATE[channel];
+	return (state == GM_CHANNEL_STARTING || state == GM_CHANNEL_RUNNING || state == GM_CHANNEL_STOPPING);
+}
+
+/* A start loads the frequency the line runs at, the frequency register */
+/* reads it back while the line runs in Camera mode and holds the host  */
+/* value otherwise. A start received while stopping keeps its frequency */
+/* for the restart.                                                     */
+uint16_t camera0_freq, camera1_freq;			// Running frequency
+uint16_t camera0_freq_host, camera1_freq_host;	// Written by the host
+
+bool camera0_pulse;
+uint32_t camera0_triggers = 0;    // Trigger pulses since the last reset
+int8_t camera0_sync_sec_counter;
+
+#define rise_cam0_trig_now	set_CAM0_TRIG; \
+                            camera0_triggers++; \
+                            if (app_regs.REG_EVT_EN & B_EVT_CAMS) \
+                            {   \
+                                app_regs.REG_CAM0 = 1;  \
+                                core_func_send_event(ADD_REG_CAM0, true);   \
+                            }
+
+void start_camera0(uint16_t freq)
+{
+	uint16_t camera_freq = freq << 1;					// Multiply CAM_FREQ x 2
+
+	camera0_freq = freq;
+	
+	if (channel_transition(0, GM_CHANNEL_STOPPING, GM_CHANNEL_STARTING))
+		return;
+
+	if (!channel_is_camera(0))							// Not running or running a servo
+	{
+		channel_release_servo(0);
+		
+		camera0_pulse = false;
+		camera0_sync_sec_counter = -1;
+
+		if (read_CAM0_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
+		{
+			app_regs.REG_SYNC0 = 0;
+			core_func_send_event(ADD_REG_SYNC0, true);
+		}		
+		clr_CAM0_SYNC;
+
+		if (camera_freq < 8)
+		{
+			timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV256, (32000000/256)/camera_freq, INT_LEVEL_LOW);
+            rise_cam0_trig_now;
+		}
+		else if (camera_freq < 64)
+		{
+			timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV64, (32000000/64)/camera_freq, INT_LEVEL_LOW);
+			rise_cam0_trig_now;
+		}
+		else if (camera_freq < 128)
+		{
+			timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV8, (32000000/8)/camera_freq, INT_LEVEL_LOW);
+			rise_cam0_trig_now;
+		}
+		else if (camera_freq < 256)
+		{
+			timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV4, (32000000/4)/camera_freq, INT_LEVEL_LOW);
+			rise_cam0_trig_now;
+		}
+		else /*if (camera_freq <= 512)*/
+		{
+			timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV2, (32000000/2)/camera_freq, INT_LEVEL_LOW);
+			rise_cam0_trig_now;
+		}
+		/*
+		else if (camera_freq <= 1024)
+		{
+			timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV1, (32000000/1)/camera_freq, INT_LEVEL_LOW);
+		}
+		*/
+		
+		app_regs.REG_TIMER_OWNERS[TIMER_TCC0] = GM_TIMER_OWNER_CAMERA;
+		channel_set_state(0, GM_CHANNEL_RUNNING);
+		camera0_base_per = TCC0_PER;
+		camera0_trim_acc = 0;
+		camera0_trim_q16 = clock_discipline_period_trim(camera0_base_per);
+	}
+}
+bool camera1_pulse;
+uint32_t camera1_triggers = 0;    // Trigger pulses since the last reset
+int8_t camera1_sync_sec_counter;
+
+#define rise_cam1_trig_now	set_CAM1_TRIG; \
+                            camera1_triggers++; \
+                            if (app_regs.REG_EVT_EN & B_EVT_CAMS) \
+                            {   \
+                                app_regs.REG_CAM1 = 1;  \
+                                core_func_send_event(ADD_REG_CAM1, true);   \
+                            }
+
+void start_camera1(uint16_t freq)
+{
+	uint16_t camera_freq = freq << 1;					// Multiply CAM_FREQ x 2
+
+	camera1_freq = freq;
+	
+	if (channel_transition(1, GM_CHANNEL_STOPPING, GM_CHANNEL_STARTING))
+		return;
+
+	if (!channel_is_camera(1))							// Not running or running a servo
+	{
+		channel_release_servo(1);
+		
+		camera1_pulse = false;
+		camera1_sync_sec_counter = -1;
+
+		if (read_CAM1_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
+		{
+			app_regs.REG_SYNC1 = 0;
+			core_func_send_event(ADD_REG_SYNC1, true);
+		}		
+		clr_CAM1_SYNC;
+
+		if (camera_freq < 8)
+		{
+			timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV256, (32000000/256)/camera_freq, INT_LEVEL_LOW);
+			rise_cam1_trig_now;
+		}
+		else if (camera_freq < 64)
+		{
+			timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV64, (32000000/64)/camera_freq, INT_LEVEL_LOW);
+			rise_cam1_trig_now;
+		}
+		else if (camera_freq < 128)
+		{
+			timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV8, (32000000/8)/camera_freq, INT_LEVEL_LOW);
+			rise_cam1_trig_now;
+		}
+		else if (camera_freq < 256)
+		{
+			timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV4, (32000000/4)/camera_freq, INT_LEVEL_LOW);
+			rise_cam1_trig_now;
+		}
+		else /*if (camera_freq <= 512)*/
+		{
+			timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV2, (32000000/2)/camera_freq, INT_LEVEL_LOW);
+			rise_cam1_trig_now;
+		}
+		/*
+		else if (camera_freq <= 1024)
+		{
+			timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV1, (32000000/1)/camera_freq, INT_LEVEL_LOW);
+		}
+		*/
+		
+		app_regs.REG_TIMER_OWNERS[TIMER_TCD0] = GM_TIMER_OWNER_CAMERA;
+		channel_set_state(1, GM_CHANNEL_RUNNING);
+		camera1_base_per = TCD0_PER;
+		camera1_trim_acc = 0;
+		camera1_trim_q16 = clock_discipline_period_trim(camera1_base_per);
+	}
+}
+
+/************************************************************************/
+/* Trigger jitter measurement                                           */
+/************************************************************************/
+/* The selected trigger pin is routed back through event channel 1 to   */
+/* TCE0 in frequency capture mode, so each rising edge captures the     */
+/* period since the previous one. The capture interrupt accumulates the */
+/* deviations from the nominal period of the camera frequency, and the  */
+/* statistics are reported and cleared on each Harp second. Only the    */
+/* periods of a line in Camera mode are measured.                       */
+#define JITTER_MAX_DEV 1023
+
+bool jitter_valid = false;
+uint8_t jitter_shift;							// log2 of the CPU cycles per tick
+uint16_t jitter_nominal;						// Nominal period in ticks
+uint16_t jitter_threshold;						// Outlier threshold in ticks
+uint16_t jitter_count;
+uint16_t jitter_outliers;
+int32_t jitter_sum;
+uint32_t jitter_sum_sq;
+int16_t jitter_min;
+int16_t jitter_max;
+
+static uint8_t jitter_prescaler(uint8_t shift)
+{
+	switch (shift)
+	{
+		case 0: return TIMER_PRESCALER_DIV1;
+		case 3: return TIMER_PRESCALER_DIV8;
+		case 6: return TIMER_PRESCALER_DIV64;
+		case 8: return TIMER_PRESCALER_DIV256;
+		default: return TIMER_PRESCALER_DIV1024;
+	}
+}
+
+/* Uses the finest tick that holds the nominal period with some margin */
+static void jitter_timebase(void)
+{
+	uint16_t freq = (app_regs.REG_JITTER_MODE == GM_JITTER_CAM0) ? camera0_freq : camera1_freq;
+	uint32_t cycles = 32000000UL / freq;
+	
+	if (cycles < 60000)
+		jitter_shift = 0;
+	else if ((cycles >> 3) < 60000)
+		jitter_shift = 3;
+	else if ((cycles >> 6) < 60000)
+		jitter_shift = 6;
+	else if ((cycles >> 8) < 60000)
+		jitter_shift = 8;
+	else
+		jitter_shift = 10;
+	
+	jitter_nominal = cycles >> jitter_shift;
+	jitter_threshold = (((uint32_t)app_regs.REG_JITTER_THRESHOLD << 2) / 125) >> jitter_shift;
+}
+
+static void jitter_clear(void)
+{
+	jitter_count = 0;
+	jitter_outliers = 0;
+	jitter_sum = 0;
+	jitter_sum_sq = 0;
+	jitter_min = INT16_MAX;
+	jitter_max = INT16_MIN;
+}
+
+/* Ticks times 16 to ns */
+static int32_t jitter_ns(int64_t ticks_x16)
+{
+	return (ticks_x16 * (125L << jitter_shift)) >> 6;
+}
+
+static uint16_t jitter_isqrt(uint32_t x)
+{
+	uint32_t root = 0;
+	
+	for (uint32_t bit = 1UL << 30; bit; bit >>= 2)
+	{
+		if (x >= root + bit)
+		{
+			x -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+			root >>= 1;
+	}
+	
+	return root;
+}
+
+void jitter_stop(void)
+{
+	if (app_regs.REG_TIMER_OWNERS[TIMER_TCE0] != GM_TIMER_OWNER_JITTER)
+		return;
+	
+	TCE0_INTCTRLB = 0;
+	TCE0_CTRLD = 0;
+	timer_type0_stop(&TCE0);
+	EVSYS_CH1MUX = 0;
+	PORTC_PIN0CTRL = (PORTC_PIN0CTRL & ~PORT_ISC_gm) | PORT_ISC_BOTHEDGES_gc;
+	PORTD_PIN0CTRL = (PORTD_PIN0CTRL & ~PORT_ISC_gm) | PORT_ISC_BOTHEDGES_gc;
+	app_regs.REG_TIMER_OWNERS[TIMER_TCE0] = GM_TIMER_OWNER_FREE;
+}
+
+/* Returns false if TCE0 is measuring DI0 */
+bool jitter_start(void)
+{
+	jitter_stop();
+	
+	if (app_regs.REG_TIMER_OWNERS[TIMER_TCE0] != GM_TIMER_OWNER_FREE)
+		return false;
+	
+	jitter_timebase();
+	jitter_clear();
+	jitter_valid = false;
+	
+	/* Only the rising edges of the trigger generate events */
+	if (app_regs.REG_JITTER_MODE == GM_JITTER_CAM0)
+	{
+		PORTC_PIN0CTRL = (PORTC_PIN0CTRL & ~PORT_ISC_gm) | PORT_ISC_RISING_gc;
+		EVSYS_CH1MUX = EVSYS_CHMUX_PORTC_PIN0_gc;
+	}
+	else
+	{
+		PORTD_PIN0CTRL = (PORTD_PIN0CTRL & ~PORT_ISC_gm) | PORT_ISC_RISING_gc;
+		EVSYS_CH1MUX = EVSYS_CHMUX_PORTD_PIN0_gc;
+	}
+	
+	TCE0_CTRLA = 0;
+	TCE0_CNT = 0;
+	TCE0_PER = 0xFFFF;
+	TCE0_CTRLB = TC0_CCAEN_bm;
+	TCE0_CTRLD = TC_EVACT_FRQ_gc | TC_EVSEL_CH1_gc;
+	TCE0_INTFLAGS = TC0_CCAIF_bm | TC0_OVFIF_bm;
+	TCE0_INTCTRLB = TC_CCAINTLVL_LO_gc;
+	TCE0_CTRLA = jitter_prescaler(jitter_shift);
+	app_regs.REG_TIMER_OWNERS[TIMER_TCE0] = GM_TIMER_OWNER_JITTER;
+	
+	return true;
+}
+
+/* Called from the TCE0 capture interrupt */
+void jitter_capture(uint16_t period)
+{
+	uint8_t timer = (app_regs.REG_JITTER_MODE == GM_JITTER_CAM0) ? TIMER_TCC0 : TIMER_TCD0;
+	
+	/* A counter overflow or a line out of Camera mode breaks the period */
+	if (TCE0_INTFLAGS & TC0_OVFIF_bm)
+	{
+		TCE0_INTFLAGS = TC0_OVFIF_bm;
+		jitter_valid = false;
+	}
+	if (app_regs.REG_TIMER_OWNERS[timer] != GM_TIMER_OWNER_CAMERA)
+	{
+		jitter_valid = false;
+		return;
+	}
+	if (!jitter_valid)
+	{
+		jitter_valid = true;
+		return;
+	}
+	
+	int32_t dev = (int32_t)period - jitter_nominal;
+	
+	if (dev > JITTER_MAX_DEV || dev < -JITTER_MAX_DEV)
+	{
+		dev = (dev > 0) ? JITTER_MAX_DEV : -JITTER_MAX_DEV;
+		jitter_outliers++;
+	}
+	else if (dev > jitter_threshold || dev < -(int32_t)jitter_threshold)
+	{
+		jitter_outliers++;
+	}
+	
+	if (jitter_count == 0xFFFF)
+		return;
+	
+	jitter_count++;
+	jitter_sum += dev;
+	jitter_sum_sq += dev * dev;
+	if (dev < jitter_min)
+		jitter_min = dev;
+	if (dev > jitter_max)
+		jitter_max = dev;
+}
+
+/* Reports the statistics of the last second in ns and starts a new one */
+void jitter_new_second(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+	uint16_t count = jitter_count;
+	uint16_t outliers = jitter_outliers;
+	int32_t sum = jitter_sum;
+	uint32_t sum_sq = jitter_sum_sq;
+	int16_t min = jitter_min;
+	int16_t max = jitter_max;
+	jitter_clear();
+	SREG = sreg;
+	
+	int32_t nominal_ns = jitter_ns((int32_t)jitter_nominal << 4);
+	
+	app_regs.REG_JITTER_STATS[0] = count;
+	app_regs.REG_JITTER_STATS[5] = outliers;
+	
+	if (count)
+	{
+		int32_t mean_x16 = (sum << 4) / count;
+		int64_t var_x256 = (((int64_t)sum_sq << 8) / count) - (int64_t)mean_x16 * mean_x16;
+		
+		app_regs.REG_JITTER_STATS[1] = nominal_ns + jitter_ns(mean_x16);
+		app_regs.REG_JITTER_STATS[2] = jitter_ns(jitter_isqrt(var_x256 > 0 ? var_x256 : 0));
+		app_regs.REG_JITTER_STATS[3] = nominal_ns + jitter_ns((int32_t)min << 4);
+		app_regs.REG_JITTER_STATS[4] = nominal_ns + jitter_ns((int32_t)max << 4);
+	}
+	else
+	{
+		for (uint8_t i = 1; i < 5; i++)
+			app_regs.REG_JITTER_STATS[i] = 0;
+	}
+	
+	/* Follows changes of the camera frequency */
+	uint8_t shift = jitter_shift;
+	cli();
+	jitter_timebase();
+	if (shift != jitter_shift)
+	{
+		TCE0_CTRLA = jitter_prescaler(jitter_shift);
+		jitter_valid = false;
+	}
+	SREG = sreg;
+	
+	if (app_regs.REG_EVT_EN & B_EVT_JITTER)
+		core_func_send_event(ADD_REG_JITTER_STATS, true);
+}
+
+/************************************************************************/
+/* External clock mode                                                  */
+/************************************************************************/
+/* DI0 is routed to the event channel 0 and each camera timer restarts  */
+/* on that event, so the trigger delay is counted by hardware from the  */
+/* DI0 rising edge. TCE0 runs in frequency capture mode on the same     */
+/* channel and keeps the DI0 period (2 us ticks) used to multiply the   */
+/* clock. Its overflows are counted, so periods up to 33 s are measured */
+/* and a slower DI0 invalidates the period. The sub-periods are worked  */
+/* out after each edge is handled, and an edge is skipped if its        */
+/* sub-period doesn't fit the camera timer (131 ms). The trigger pin is */
+/* driven by the inverted compare output of the camera timer in single  */
+/* slope, so each pulse spans CCA to PER and its edges don't depend on  */
+/* the interrupts. The DI0 interrupt only arms the pulses to generate,  */
+/* so the delay must be longer than its latency, and the edges it comes */
+/* too late for are counted in EXT_CLK_SKIPS. The first period lasts    */
+/* delay + width, the next ones the DI0 period over the multiplier, and */
+/* the timer is parked before the last one ends. The compare and        */
+/* overflow interrupts only count the pulses and send the events.       */
+/* The one-shot mode uses the same hardware but arms a single pulse on  */
+/* the first edge and stops the camera after it.                        */
+#define EXT_CLOCK_MIN_DELAY_US 20
+
+bool camera0_ext_running = false;
+bool camera1_ext_running = false;
+uint8_t camera0_ext_edges;
+uint8_t camera1_ext_edges;
+uint8_t camera0_ext_pulses;
+uint8_t camera1_ext_pulses;
+uint16_t camera0_ext_delay;						// Timer ticks
+uint16_t camera1_ext_delay;
+uint16_t camera0_ext_width;
+uint16_t camera1_ext_width;
+bool camera0_ext_one_shot = false;
+bool camera1_ext_one_shot = false;
+
+bool ext_clock_in_use = false;
+uint32_t ext_clock_period;						// 2 us ticks, 0 if unknown
+uint8_t ext_clock_captures;
+uint8_t ext_clock_overflows;
+uint16_t camera0_ext_sub_period;				// 2 us ticks, 0 if out of range
+uint16_t camera1_ext_sub_period;
+
+static void ext_clock_acquire_input(void)
+{
+	if (ext_clock_in_use)
+		return;
+	
+	/* The external clock takes TCE0 over from the jitter measurement */
+	if (app_regs.REG_TIMER_OWNERS[TIMER_TCE0] == GM_TIMER_OWNER_JITTER)
+	{
+		jitter_stop();
+		app_regs.REG_JITTER_MODE = GM_JITTER_OFF;
+	}
+	
+	ext_clock_in_use = true;
+	ext_clock_period = 0;
+	ext_clock_captures = 0;
+	ext_clock_overflows = 0;
+	camera0_ext_sub_period = 0;
+	camera1_ext_sub_period = 0;
+	
+	/* Only the rising edge of DI0 generates events from now on */
+	io_pin2in(&PORTA, 0, PULL_IO_TRISTATE, SENSE_IO_EDGE_RISING);
+	EVSYS_CH0MUX = EVSYS_CHMUX_PORTA_PIN0_gc;
+	
+	/* TCE0 measures the DI0 period */
+	TCE0_CTRLA = 0;
+	TCE0_CNT = 0;
+	TCE0_PER = 0xFFFF;
+	TCE0_CTRLB = TC0_CCAEN_bm;
+	TCE0_CTRLD = TC_EVACT_FRQ_gc | TC_EVSEL_CH0_gc;
+	TCE0_INTFLAGS = TC0_CCAIF_bm | TC0_OVFIF_bm;
+	TCE0_INTCTRLA = TC_OVFINTLVL_LO_gc;
+	TCE0_CTRLA = TIMER_PRESCALER_DIV64;
+	app_regs.REG_TIMER_OWNERS[TIMER_TCE0] = GM_TIMER_OWNER_EXT_CLK;
+}
+
+static void ext_clock_release_input(void)
+{
+	if (camera0_ext_running || camera1_ext_running)
+		return;
+	
+	ext_clock_in_use = false;
+	
+	TCE0_INTCTRLA = 0;
+	TCE0_CTRLD = 0;
+	timer_type0_stop(&TCE0);
+	app_regs.REG_TIMER_OWNERS[TIMER_TCE0] = GM_TIMER_OWNER_FREE;
+	
+	io_pin2in(&PORTA, 0, PULL_IO_TRISTATE, SENSE_IO_EDGES_BOTH);
+}
+
+/* Moves the trigger pin between the port and the inverted compare      */
+/* output, on top of the polarity selected in OUT_INVERT. Both keep the */
+/* line low, and the pin floats for a few cycles while the source and   */
+/* the inversion are swapped, so no edge is driven meanwhile.           */
+static void ext_clock_drive_pin(TC0_t* timer, PORT_t* port, bool invert, bool compare)
+{
+	uint8_t sreg = SREG;
+	cli();
+	timer->CTRLC = TC0_CMPA_bm;								// Compare output high while the timer is off
+	port->OUTCLR = (1 << 0);
+	port->DIRCLR = (1 << 0);
+	if (invert != compare)
+		port->PIN0CTRL |= PORT_INVEN_bm;
+	else
+		port->PIN0CTRL &= ~PORT_INVEN_bm;
+	timer->CTRLB = compare ? (TC_WGMODE_SS_gc | TC0_CCAEN_bm) : 0;
+	port->DIRSET = (1 << 0);
+	SREG = sreg;
+}
+
+/* The compare never matches, so the pin stays low until armed */
+void ext_clock_park(TC0_t* timer, bool now)
+{
+	if (now)
+	{
+		timer->CCA = 0xFFFF;
+		timer->PER = 0xFFFE;
+	}
+	
+	timer->CCABUF = 0xFFFF;
+	timer->PERBUF = 0xFFFE;
+}
+
+static uint8_t ext_clock_config_timer(TC0_t* timer, uint8_t mul, uint16_t delay, uint16_t width, uint16_t * delay_ticks, uint16_t * width_ticks)
+{
+	timer->CTRLA = 0;
+	timer->CTRLB = 0;
+	timer->INTCTRLA = 0;
+	timer->INTCTRLB = 0;
+	timer->CNT = 0;
+	ext_clock_park(timer, true);
+	
+	if (delay < EXT_CLOCK_MIN_DELAY_US)
+		delay = EXT_CLOCK_MIN_DELAY_US;
+	
+	timer->CTRLD = TC_EVACT_RESTART_gc | TC_EVSEL_CH0_gc;
+	timer->INTFLAGS = TC0_OVFIF_bm | TC0_CCAIF_bm;
+	timer->INTCTRLA = TC_OVFINTLVL_LO_gc;
+	timer->INTCTRLB = TC_CCAINTLVL_LO_gc;
+	
+	if (mul == 1 && ((uint32_t)delay + width) < 16384)
+	{
+		/* 0.25 us resolution */
+		*delay_ticks = delay << 2;
+		*width_ticks = width << 2;
+		return TIMER_PRESCALER_DIV8;
+	}
+	else
+	{
+		/* 2 us resolution, same time base as TCE0 */
+		*delay_ticks = delay >> 1;
+		*width_ticks = (width + 1) >> 1;
+		return TIMER_PRESCALER_DIV64;
+	}
+}
+
+/* Returns 0 if the period is unknown or the sub-period too long */
+static uint16_t ext_clock_sub_period(uint8_t mul)
+{
+	uint32_t sub_period = ext_clock_period / mul;
+	
+	return (sub_period > 0xFFFF) ? 0 : sub_period;
+}
+
+static bool ext_clock_arm(TC0_t* timer, uint8_t mul, uint16_t sub_period, uint16_t delay, uint16_t width, uint8_t * pulses)
+{
+	if (mul > 1)
+	{
+		/* Need a valid period to split it */
+		if (sub_period == 0)
+			return false;
+		
+		if (sub_period <= width)
+			sub_period = width + 1;
+	}
+	
+	/* Too late to arm the trigger of this edge */
+	if (timer->CNT >= delay)
+		return false;
+	
+	timer->CCA = delay;
+	timer->PER = delay + width - 1;
+	
+	if (mul > 1)
+	{
+		timer->CCABUF = sub_period - width;
+		timer->PERBUF = sub_period - 1;
+	}
+	else
+	{
+		ext_clock_park(timer, false);
+	}
+	
+	/* The counter may have passed the delay meanwhile */
+	if (timer->CNT >= delay)
+	{
+		ext_clock_park(timer, true);
+		return false;
+	}
+	
+	*pulses = mul;
+	
+	return true;
+}
+
+/* Counts the edges whose trigger couldn't be armed */
+static void ext_clock_skipped(uint8_t camera)
+{
+	if (app_regs.REG_EXT_CLK_SKIPS[camera] < 0xFFFF)
+		app_regs.REG_EXT_CLK_SKIPS[camera]++;
+}
+
+/* Sets the user timestamp to the time of the last DI0 rising edge */
+static void ext_clock_mark_edge(void)
+{
+	uint32_t seconds;
+	uint16_t useconds;
+	
+	core_func_mark_user_timestamp();
+	uint16_t elapsed = TCE0_CNT;							// 2 us ticks since the edge
+	core_func_read_user_timestamp(&seconds, &useconds);
+	
+	/* The timestamp is counted in 32 us units */
+	elapsed = (elapsed + 8) >> 4;
+	
+	if (useconds < elapsed)
+	{
+		seconds--;
+		useconds += 31250;
+	}
+	
+	core_func_update_user_timestamp(seconds, useconds - elapsed);
+}
+
+void ext_clock_stop_camera0(void)
+{
+	timer_type0_stop(&TCC0);
+	TCC0_CTRLD = 0;
+	TCC0_INTCTRLA = 0;
+	TCC0_INTCTRLB = 0;
+	ext_clock_drive_pin(&TCC0, &PORTC, app_regs.REG_OUT_INVERT & B_OUT_CAM_TRIG0, false);
+	app_regs.REG_TIMER_OWNERS[TIMER_TCC0] = GM_TIMER_OWNER_FREE;
+	camera0_ext_running = false;
+	camera0_ext_pulses = 0;
+	channel_set_state(0, GM_CHANNEL_IDLE);
+	
+	if (read_CAM0_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
+	{
+		app_regs.REG_SYNC0 = 0;
+		core_func_send_event(ADD_REG_SYNC0, true);
+	}
+	
+	clr_CAM0_SYNC;
+	clr_CAM0_TRIG;
+	
+	ext_clock_release_input();
+}
+
+void ext_clock_stop_camera1(void)
+{
+	timer_type0_stop(&TCD0);
+	TCD0_CTRLD = 0;
+	TCD0_INTCTRLA = 0;
+	TCD0_INTCTRLB = 0;
+	ext_clock_drive_pin(&TCD0, &PORTD, app_regs.REG_OUT_INVERT & B_OUT_CAM_TRIG1, false);
+	app_regs.REG_TIMER_OWNERS[TIMER_TCD0] = GM_TIMER_OWNER_FREE;
+	camera1_ext_running = false;
+	camera1_ext_pulses = 0;
+	channel_set_state(1, GM_CHANNEL_IDLE);
+	
+	if (read_CAM1_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
+	{
+		app_regs.REG_SYNC1 = 0;
+		core_func_send_event(ADD_REG_SYNC1, true);
+	}
+	
+	clr_CAM1_SYNC;
+	clr_CAM1_TRIG;
+	
+	ext_clock_release_input();
+}
+
+void start_camera0_ext(void)
+{
+	if (channel_transition(0, GM_CHANNEL_STOPPING, GM_CHANNEL_STARTING))
+		return;
+	
+	if (!channel_is_camera(0))							// Not running or running a servo
+	{
+		channel_release_servo(0);
+		
+		camera0_sync_sec_counter = -1;
+		camera0_ext_edges = 0;
+		camera0_ext_pulses = 0;
+		camera0_ext_one_shot = (app_regs.REG_CAM0_MODE == GM_CAM0_MODE_ONE_SHOT);
+		app_regs.REG_EXT_CLK_SKIPS[0] = 0;
+
+		if (read_CAM0_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
+		{
+			app_regs.REG_SYNC0 = 0;
+			core_func_send_event(ADD_REG_SYNC0, true);
+		}
+		clr_CAM0_SYNC;
+		clr_CAM0_TRIG;
+		
+		ext_clock_acquire_input();
+		uint8_t prescaler = ext_clock_config_timer(&TCC0, camera0_ext_one_shot ? 1 : app_regs.REG_CAM0_CLK_MUL, app_regs.REG_CAM0_TRIG_DELAY, app_regs.REG_CAM0_TRIG_WIDTH, &camera0_ext_delay, &camera0_ext_width);
+		app_regs.REG_TIMER_OWNERS[TIMER_TCC0] = GM_TIMER_OWNER_EXT_CLK;
+		ext_clock_drive_pin(&TCC0, &PORTC, app_regs.REG_OUT_INVERT & B_OUT_CAM_TRIG0, true);
+		TCC0_CTRLA = prescaler;
+		camera0_ext_running = true;
+		channel_set_state(0, GM_CHANNEL_RUNNING);
+	}
+}
+
+void start_camera1_ext(void)
+{
+	if (channel_transition(1, GM_CHANNEL_STOPPING, GM_CHANNEL_STARTING))
+		return;
+	
+	if (!channel_is_camera(1))							// Not running or running a servo
+	{
+		channel_release_servo(1);
+		
+		camera1_sync_sec_counter = -1;
+		camera1_ext_edges = 0;
+		camera1_ext_pulses = 0;
+		camera1_ext_one_shot = (app_regs.REG_CAM1_MODE == GM_CAM1_MODE_ONE_SHOT);
+		app_regs.REG_EXT_CLK_SKIPS[1] = 0;
+
+		if (read_CAM1_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
+		{
+			app_regs.REG_SYNC1 = 0;
+			core_func_send_event(ADD_REG_SYNC1, true);
+		}
+		clr_CAM1_SYNC;
+		clr_CAM1_TRIG;
+		
+		ext_clock_acquire_input();
+		uint8_t prescaler = ext_clock_config_timer(&TCD0, camera1_ext_one_shot ? 1 : app_regs.REG_CAM1_CLK_MUL, app_regs.REG_CAM1_TRIG_DELAY, app_regs.REG_CAM1_TRIG_WIDTH, &camera1_ext_delay, &camera1_ext_width);
+		app_regs.REG_TIMER_OWNERS[TIMER_TCD0] = GM_TIMER_OWNER_EXT_CLK;
+		ext_clock_drive_pin(&TCD0, &PORTD, app_regs.REG_OUT_INVERT & B_OUT_CAM_TRIG1, true);
+		TCD0_CTRLA = prescaler;
+		camera1_ext_running = true;
+		channel_set_state(1, GM_CHANNEL_RUNNING);
+	}
+}
+
+/* Called from the TCE0 overflow, saturates at 33 s */
+void ext_clock_overflow(void)
+{
+	if (ext_clock_overflows < 0xFF)
+		ext_clock_overflows++;
+}
+
+/* Called from the DI0 interrupt on each rising edge */
+/* If the trigger can't be armed, it's tried again on the next edge */
+void ext_clock_rising_edge(void)
+{
+	bool edge_marked = false;
+	
+	if (TCE0_INTFLAGS & TC0_CCAIF_bm)
+	{
+		uint32_t capture = TCE0_CCA;
+		
+		/* A pending overflow came before the edge restarted the counter */
+		if (TCE0_INTFLAGS & TC0_OVFIF_bm)
+		{
+			TCE0_INTFLAGS = TC0_OVFIF_bm;
+			ext_clock_overflow();
+		}
+		capture |= (uint32_t)ext_clock_overflows << 16;
+		
+		/* The first capture only holds the time since TCE0 was started */
+		/* and a period that saturated the overflows starts over        */
+		if (ext_clock_overflows == 0xFF)
+		{
+			ext_clock_period = 0;
+			ext_clock_captures = 1;
+		}
+		else if (ext_clock_captures < 2)
+		{
+			if (++ext_clock_captures == 2)
+				ext_clock_period = capture;
+		}
+		else
+		{
+			ext_clock_period += ((int32_t)capture - (int32_t)ext_clock_period) >> 2;
+		}
+		
+		ext_clock_overflows = 0;
+	}
+	
+	if (camera0_ext_running && camera0_ext_one_shot)
+	{
+		if (camera0_ext_pulses == 0)
+		{
+			if (ext_clock_arm(&TCC0, 1, 0, camera0_ext_delay, camera0_ext_width, &camera0_ext_pulses))
+			{
+				TCC0_CTRLD = 0;									// Next edges don't restart the delay
+				
+				if (!edge_marked)
+				{
+					ext_clock_mark_edge();
+					edge_marked = true;
+				}
+			}
+			else
+				ext_clock_skipped(0);
+		}
+	}
+	else if (camera0_ext_running && ++camera0_ext_edges >= app_regs.REG_CAM0_CLK_DIV)
+	{
+		if (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_STOPPING || app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_STARTING)
+		{
+			bool restart = (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_STARTING);
+			ext_clock_stop_camera0();
+			if (restart)
+				channel_start(0);
+		}
+		else if (ext_clock_arm(&TCC0, app_regs.REG_CAM0_CLK_MUL, camera0_ext_sub_period, camera0_ext_delay, camera0_ext_width, &camera0_ext_pulses))
+			camera0_ext_edges = 0;
+		else
+		{
+			camera0_ext_edges = app_regs.REG_CAM0_CLK_DIV - 1;
+			ext_clock_skipped(0);
+		}
+	}
+	
+	if (camera1_ext_running && camera1_ext_one_shot)
+	{
+		if (camera1_ext_pulses == 0)
+		{
+			if (ext_clock_arm(&TCD0, 1, 0, camera1_ext_delay, camera1_ext_width, &camera1_ext_pulses))
+			{
+				TCD0_CTRLD = 0;									// Next edges don't restart the delay
+				
+				if (!edge_marked)
+				{
+					ext_clock_mark_edge();
+					edge_marked = true;
+				}
+			}
+			else
+				ext_clock_skipped(1);
+		}
+	}
+	else if (camera1_ext_running && ++camera1_ext_edges >= app_regs.REG_CAM1_CLK_DIV)
+	{
+		if (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_STOPPING || app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_STARTING)
+		{
+			bool restart = (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_STARTING);
+			ext_clock_stop_camera1();
+			if (restart)
+				channel_start(1);
+		}
+		else if (ext_clock_arm(&TCD0, app_regs.REG_CAM1_CLK_MUL, camera1_ext_sub_period, camera1_ext_delay, camera1_ext_width, &camera1_ext_pulses))
+			camera1_ext_edges = 0;
+		else
+		{
+			camera1_ext_edges = app_regs.REG_CAM1_CLK_DIV - 1;
+			ext_clock_skipped(1);
+		}
+	}
+	
+	/* Kept out of the path to the trigger, the division takes a few us */
+	camera0_ext_sub_period = ext_clock_sub_period(app_regs.REG_CAM0_CLK_MUL);
+	camera1_ext_sub_period = ext_clock_sub_period(app_regs.REG_CAM1_CLK_MUL);
+}
+
+
+/************************************************************************/
+/* Sequence mode                                                        */
+/************************************************************************/
+/* The camera timer runs in single slope PWM, so the trigger pin is     */
+/* driven by the compare output, and a DMA channel triggered by the     */
+/* timer overflow copies the next interval into PERBUF. The CPU only    */
+/* sends the events and counts the triggers of finite sequences. The    */
+/* clock discipline doesn't apply since the DMA owns PERBUF.            */
+/* The table holds up to 16 intervals and the DMA repeat count is 8     */
+/* bits, so a finite sequence is played up to 255 times, 4080 triggers  */
+/* at most, and a longer one must loop until stopped.                   */
+#define SEQ_MAX_LEN 16
+
+bool camera0_seq_running = false;
+bool camera1_seq_running = false;
+uint16_t camera0_seq_triggers;		// Triggers left, 0 when looping forever
+uint16_t camera1_seq_triggers;
+uint16_t camera0_seq_ticks[SEQ_MAX_LEN];
+uint16_t camera1_seq_ticks[SEQ_MAX_LEN];
+
+static void seq_start(TC0_t* timer, DMA_CH_t* dma, uint8_t trigsrc, uint16_t* seq, uint8_t len, uint8_t repeat, uint16_t width, uint16_t* ticks)
+{
+	uint16_t min_interval = 0xFFFF;
+	
+	/* PERBUF is loaded one period ahead, so the table starts on the second interval */
+	for (uint8_t i = 0; i < len; i++)
+	{
+		ticks[i] = (seq[(i + 1) % len] >> 1) - 1;
+		
+		if (seq[i] < min_interval)
+			min_interval = seq[i];
+	}
+	
+	/* The pulse can't be longer than half of the shortest interval */
+	if (width > (min_interval >> 1))
+		width = min_interval >> 1;
+	
+	timer->CTRLA = 0;
+	timer->CTRLB = TC_WGMODE_SS_gc | TC0_CCAEN_bm;
+	timer->INTCTRLA = 0;
+	timer->INTCTRLB = 0;
+	timer->PER = (seq[0] >> 1) - 1;
+	timer->CCA = (width < 2) ? 1 : (width >> 1);
+	timer->CNT = timer->PER;								// Overflow on the first tick
+	
+	DMA_CTRL |= DMA_ENABLE_bm;
+	dma->CTRLA = 0;
+	dma->ADDRCTRL = DMA_CH_SRCRELOAD_BLOCK_gc | DMA_CH_SRCDIR_INC_gc | DMA_CH_DESTRELOAD_BURST_gc | DMA_CH_DESTDIR_INC_gc;
+	dma->TRIGSRC = trigsrc;
+	dma->TRFCNT = len * 2;
+	dma->REPCNT = repeat;									// Zero repeats forever
+	dma->SRCADDR0 = (uint8_t)((uint16_t)ticks);
+	dma->SRCADDR1 = (uint8_t)((uint16_t)ticks >> 8);
+	dma->SRCADDR2 = 0;
+	dma->DESTADDR0 = (uint8_t)((uint16_t)&timer->PERBUF);
+	dma->DESTADDR1 = (uint8_t)((uint16_t)&timer->PERBUF >> 8);
+	dma->DESTADDR2 = 0;
+	dma->CTRLA = DMA_CH_ENABLE_bm | DMA_CH_REPEAT_bm | DMA_CH_SINGLE_bm | DMA_CH_BURSTLEN_2BYTE_gc;
+	
+	timer->INTFLAGS = TC0_OVFIF_bm | TC0_CCAIF_bm;
+	timer->INTCTRLA = TC_OVFINTLVL_LO_gc;
+	timer->CTRLA = TIMER_PRESCALER_DIV64;
+}
+
+void seq_stop_camera0(void)
+{
+	DMA.CH0.CTRLA = 0;
+	timer_type0_stop(&TCC0);
+	app_regs.REG_TIMER_OWNERS[TIMER_TCC0] = GM_TIMER_OWNER_FREE;
+	TCC0_CTRLB = 0;
+	TCC0_INTCTRLA = 0;
+	TCC0_INTCTRLB = 0;
+	camera0_seq_running = false;
+	channel_set_state(0, GM_CHANNEL_IDLE);
+	
+	if (read_CAM0_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
+	{
+		app_regs.REG_SYNC0 = 0;
+		core_func_send_event(ADD_REG_SYNC0, true);
+	}
+	
+	clr_CAM0_SYNC;
+	clr_CAM0_TRIG;
+}
+
+void seq_stop_camera1(void)
+{
+	DMA.CH1.CTRLA = 0;
+	timer_type0_stop(&TCD0);
+	app_regs.REG_TIMER_OWNERS[TIMER_TCD0] = GM_TIMER_OWNER_FREE;
+	TCD0_CTRLB = 0;
+	TCD0_INTCTRLA = 0;
+	TCD0_INTCTRLB = 0;
+	camera1_seq_running = false;
+	channel_set_state(1, GM_CHANNEL_IDLE);
+	
+	if (read_CAM1_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
+	{
+		app_regs.REG_SYNC1 = 0;
+		core_func_send_event(ADD_REG_SYNC1, true);
+	}
+	
+	clr_CAM1_SYNC;
+	clr_CAM1_TRIG;
+}
+
+/* Stops at the end of the current trigger pulse */
+void seq_stop_after_pulse(TC0_t* timer)
+{
+	timer->INTFLAGS = TC0_CCAIF_bm;
+	timer->INTCTRLB = TC_CCAINTLVL_LO_gc;
+}
+
+void start_camera0_seq(void)
+{
+	if (channel_transition(0, GM_CHANNEL_STOPPING, GM_CHANNEL_STARTING))
+		return;
+	
+	if (!channel_is_camera(0))							// Not running or running a servo
+	{
+		channel_release_servo(0);
+		
+		camera0_sync_sec_counter = -1;
+		camera0_seq_triggers = (uint16_t)app_regs.REG_CAM0_SEQ_LEN * app_regs.REG_CAM0_SEQ_REPEAT;
+		
+		if (read_CAM0_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
+		{
+			app_regs.REG_SYNC0 = 0;
+			core_func_send_event(ADD_REG_SYNC0, true);
+		}
+		clr_CAM0_SYNC;
+		clr_CAM0_TRIG;
+		
+		camera0_seq_running = true;
+		app_regs.REG_TIMER_OWNERS[TIMER_TCC0] = GM_TIMER_OWNER_SEQUENCE;
+		channel_set_state(0, GM_CHANNEL_RUNNING);
+		seq_start(&TCC0, &DMA.CH0, DMA_CH_TRIGSRC_TCC0_OVF_gc, app_regs.REG_CAM0_SEQ, app_regs.REG_CAM0_SEQ_LEN, app_regs.REG_CAM0_SEQ_REPEAT, app_regs.REG_CAM0_TRIG_WIDTH, camera0_seq_ticks);
+	}
+}
+
+void start_camera1_seq(void)
+{
+	if (channel_transition(1, GM_CHANNEL_STOPPING, GM_CHANNEL_STARTING))
+		return;
+	
+	if (!channel_is_camera(1))							// Not running or running a servo
+	{
+		channel_release_servo(1);
+		
+		camera1_sync_sec_counter = -1;
+		camera1_seq_triggers = (uint16_t)app_regs.REG_CAM1_SEQ_LEN * app_regs.REG_CAM1_SEQ_REPEAT;
+		
+		if (read_CAM1_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
+		{
+			app_regs.REG_SYNC1 = 0;
+			core_func_send_event(ADD_REG_SYNC1, true);
+		}
+		clr_CAM1_SYNC;
+		clr_CAM1_TRIG;
+		
+		camera1_seq_running = true;
+		app_regs.REG_TIMER_OWNERS[TIMER_TCD0] = GM_TIMER_OWNER_SEQUENCE;
+		channel_set_state(1, GM_CHANNEL_RUNNING);
+		seq_start(&TCD0, &DMA.CH1, DMA_CH_TRIGSRC_TCD0_OVF_gc, app_regs.REG_CAM1_SEQ, app_regs.REG_CAM1_SEQ_LEN, app_regs.REG_CAM1_SEQ_REPEAT, app_regs.REG_CAM1_TRIG_WIDTH, camera1_seq_ticks);
+	}
+}
+
+/************************************************************************/
+/* Software trigger                                                     */
+/************************************************************************/
+/* A single pulse is started on the selected idle lines while the write */
+/* is handled, so the edge follows the command by the time taken to     */
+/* decode it, claim the lines and configure the timers. The lines are   */
+/* checked and claimed through their state, and the edges of both lines */
+/* set back to back, a few CPU cycles apart, all with interrupts        */
+/* disabled, so no start from an interrupt can take a line in between.  */
+/* The state events are sent as the lines are claimed. The camera timer */
+/* ends the pulse from its compare interrupt and the line is stopping   */
+/* during the pulse, so a start received in the meantime is applied     */
+/* when the pulse ends. The sync is untouched.                          */
+bool camera0_soft_pulse = false;
+bool camera1_soft_pulse = false;
+
+static uint8_t soft_trigger_config_timer(TC0_t* timer, uint16_t width)
+{
+	timer->CTRLA = 0;
+	timer->CTRLB = 0;
+	timer->CTRLD = 0;
+	timer->INTCTRLA = 0;
+	timer->INTCTRLB = 0;
+	timer->CNT = 0;
+	timer->PER = 0xFFFF;
+	timer->INTFLAGS = TC0_CCAIF_bm;
+	timer->INTCTRLB = TC_CCAINTLVL_LO_gc;
+	
+	if (width < 16384)
+	{
+		timer->CCA = width << 2;							// 0.25 us resolution
+		return TIMER_PRESCALER_DIV8;
+	}
+	else
+	{
+		timer->CCA = width >> 1;							// 2 us resolution
+		return TIMER_PRESCALER_DIV64;
+	}
+}
+
+/* Returns false if a selected line isn't idle */
+bool soft_trigger(uint8_t cameras)
+{
+	uint8_t prescaler0 = 0;
+	uint8_t prescaler1 = 0;
+	
+	uint8_t sreg = SREG;
+	cli();
+	
+	if (((cameras & B_TRIG_CAM0) && app_regs.REG_CHANNEL_STATE[0] != GM_CHANNEL_IDLE) ||
+		((cameras & B_TRIG_CAM1) && app_regs.REG_CHANNEL_STATE[1] != GM_CHANNEL_IDLE))
+	{
+		SREG = sreg;
+		return false;
+	}
+	
+	if ((cameras & B_TRIG_CAM0) && channel_transition(0, GM_CHANNEL_IDLE, GM_CHANNEL_STOPPING))
+	{
+		app_regs.REG_TIMER_OWNERS[TIMER_TCC0] = GM_TIMER_OWNER_SOFT_TRIG;
+		camera0_soft_pulse = true;
+		prescaler0 = soft_trigger_config_timer(&TCC0, app_regs.REG_CAM0_TRIG_WIDTH);
+	}
+	if ((cameras & B_TRIG_CAM1) && channel_transition(1, GM_CHANNEL_IDLE, GM_CHANNEL_STOPPING))
+	{
+		app_regs.REG_TIMER_OWNERS[TIMER_TCD0] = GM_TIMER_OWNER_SOFT_TRIG;
+		camera1_soft_pulse = true;
+		prescaler1 = soft_trigger_config_timer(&TCD0, app_regs.REG_CAM1_TRIG_WIDTH);
+	}
+	
+	if (prescaler0)
+		set_CAM0_TRIG;
+	if (prescaler1)
+		set_CAM1_TRIG;
+	if (prescaler0)
+		camera0_triggers++;
+	if (prescaler1)
+		camera1_triggers++;
+	if (prescaler0)
+		TCC0_CTRLA = prescaler0;
+	if (prescaler1)
+		TCD0_CTRLA = prescaler1;
+	SREG = sreg;
+	
+	/* Events are sent after the edges */
+	if (app_regs.REG_EVT_EN & B_EVT_CAMS)
+	{
+		if (prescaler0)
+		{
+			app_regs.REG_CAM0 = 1;
+			core_func_send_event(ADD_REG_CAM0, true);
+		}
+		if (prescaler1)
+		{
+			app_regs.REG_CAM1 = 1;
+			core_func_send_event(ADD_REG_CAM1, true);
+		}
+	}
+	
+	return true;
+}
+
+/* Called from the camera timer compare at the end of the pulse */
+void soft_trigger_end_camera0(void)
+{
+	bool restart = (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_STARTING);
+	
+	clr_CAM0_TRIG;
+	timer_type0_stop(&TCC0);
+	TCC0_INTCTRLB = 0;
+	camera0_soft_pulse = false;
+	app_regs.REG_TIMER_OWNERS[TIMER_TCC0] = GM_TIMER_OWNER_FREE;
+	channel_set_state(0, GM_CHANNEL_IDLE);
+	
+	if (restart)
+		channel_start(0);
+}
+
+void soft_trigger_end_camera1(void)
+{
+	bool restart = (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_STARTING);
+	
+	clr_CAM1_TRIG;
+	timer_type0_stop(&TCD0);
+	TCD0_INTCTRLB = 0;
+	camera1_soft_pulse = false;
+	app_regs.REG_TIMER_OWNERS[TIMER_TCD0] = GM_TIMER_OWNER_FREE;
+	channel_set_state(1, GM_CHANNEL_IDLE);
+	
+	if (restart)
+		channel_start(1);
+}
+
+/* Called from the camera timer overflow once the last pulse of a stop ended */
+void stop_end_camera0(void)
+{
+	bool restart = (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_STARTING);
+	
+	if (read_CAM0_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
+	{
+		app_regs.REG_SYNC0 = 0;
+		core_func_send_event(ADD_REG_SYNC0, true);
+	}
+	
+	clr_CAM0_SYNC;
+	clr_CAM0_TRIG;
+	
+	timer_type0_stop(&TCC0);
+	app_regs.REG_TIMER_OWNERS[TIMER_TCC0] = GM_TIMER_OWNER_FREE;
+	channel_set_state(0, GM_CHANNEL_IDLE);
+	
+	if (restart)
+		channel_start(0);
+}
+
+void stop_end_camera1(void)
+{
+	bool restart = (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_STARTING);
+	
+	if (read_CAM1_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
+	{
+		app_regs.REG_SYNC1 = 0;
+		core_func_send_event(ADD_REG_SYNC1, true);
+	}
+	
+	clr_CAM1_SYNC;
+	clr_CAM1_TRIG;
+	
+	timer_type0_stop(&TCD0);
+	app_regs.REG_TIMER_OWNERS[TIMER_TCD0] = GM_TIMER_OWNER_FREE;
+	channel_set_state(1, GM_CHANNEL_IDLE);
+	
+	if (restart)
+		channel_start(1);
+}
+
+/* Called from the sequence timer compare once the last interval ended */
+void seq_end_camera0(void)
+{
+	bool restart = (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_STARTING);
+	
+	seq_stop_camera0();
+	
+	if (restart)
+		channel_start(0);
+}
+
+void seq_end_camera1(void)
+{
+	bool restart = (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_STARTING);
+	
+	seq_stop_camera1();
+	
+	if (restart)
+		channel_start(1);
+}
+
+/* Called from the camera timer overflow once the last external pulse ended */
+void ext_clock_end_camera0(void)
+{
+	bool restart = (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_STARTING);
+	
+	ext_clock_stop_camera0();
+	
+	if (restart)
+		channel_start(0);
+}
+
+void ext_clock_end_camera1(void)
+{
+	bool restart = (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_STARTING);
+	
+	ext_clock_stop_camera1();
+	
+	if (restart)
+		channel_start(1);
+}
+
+void stop_camera0(void)
+{
+	/* A pending start is dropped and the stop in progress continues */
+	if (channel_transition(0, GM_CHANNEL_STARTING, GM_CHANNEL_STOPPING))
+		return;
+	
+	if (channel_transition(0, GM_CHANNEL_RUNNING, GM_CHANNEL_STOPPING))
+	{
+		if (camera0_seq_running)
+			seq_stop_after_pulse(&TCC0);
+		else if (camera0_ext_running && camera0_ext_pulses == 0)
+			ext_clock_stop_camera0();
+	}
+}
+void stop_camera1(void)
+{
+	/* A pending start is dropped and the stop in progress continues */
+	if (channel_transition(1, GM_CHANNEL_STARTING, GM_CHANNEL_STOPPING))
+		return;
+	
+	if (channel_transition(1, GM_CHANNEL_RUNNING, GM_CHANNEL_STOPPING))
+	{
+		if (camera1_seq_running)
+			seq_stop_after_pulse(&TCD0);
+		else if (camera1_ext_running && camera1_ext_pulses == 0)
+			ext_clock_stop_camera1();
+	}
+}
+
+/* Starts the camera mode configured on the line */
+void channel_start(uint8_t channel)
+{
+	if (channel == 0)
+	{
+		if (app_regs.REG_CAM0_MODE == GM_CAM0_MODE_SEQUENCE)
+			start_camera0_seq();
+		else if (app_regs.REG_CAM0_MODE == GM_CAM0_MODE_EXT_CLK || app_regs.REG_CAM0_MODE == GM_CAM0_MODE_ONE_SHOT)
+			start_camera0_ext();
+		else if (app_regs.REG_CAM0_MODE == GM_CAM0_MODE_CAM)
+			start_camera0(camera0_freq);
+	}
+	else
+	{
+		if (app_regs.REG_CAM1_MODE == GM_CAM1_MODE_SEQUENCE)
+			start_camera1_seq();
+		else if (app_regs.REG_CAM1_MODE == GM_CAM1_MODE_EXT_CLK || app_regs.REG_CAM1_MODE == GM_CAM1_MODE_ONE_SHOT)
+			start_camera1_ext();
+		else if (app_regs.REG_CAM1_MODE == GM_CAM1_MODE_CAM)
+			start_camera1(camera1_freq);
+	}
+}
+
+/************************************************************************/
+/* Servo PWM                                                            */
+/************************************************************************/
+/* The finest prescaler that fits the period is used, giving 0.25 us or */
+/* better up to 16384 us, 0.5 us up to 32767 us and 1 us above. The two */
+/* coarser timebases are the peripheral clock divided by 16 and 32 on   */
+/* event channels 2 and 3, as the timer prescaler jumps from 8 to 64.   */
+/* Pulse widths are kept in 1/8 us and the registers report the value   */
+/* applied after rounding to the timer resolution. While running, PER   */
+/* and CCA are only updated through PERBUF and CCABUF, so the new       */
+/* values start on the next period. Only a period change that needs     */
+/* another prescaler restarts the timer.                                */
+
+/* Returns log2 of the timer ticks per 1/8 us */
+static int8_t servo_timebase(uint16_t period, uint8_t * prescaler)
+{
+	if (period <= 2048)  { *prescaler = TIMER_PRESCALER_DIV1;  return  2; }	// 1/32 us
+	if (period <= 4096)  { *prescaler = TIMER_PRESCALER_DIV2;  return  1; }	// 1/16 us
+	if (period <= 8192)  { *prescaler = TIMER_PRESCALER_DIV4;  return  0; }	// 1/8 us
+	if (period <= 16384) { *prescaler = TIMER_PRESCALER_DIV8;  return -1; }	// 1/4 us
+	if (period <= 32767) { *prescaler = TC_CLKSEL_EVCH2_gc;    return -2; }	// 1/2 us
+	*prescaler = TC_CLKSEL_EVCH3_gc;
+	return -3;																	// 1 us
+}
+
+static uint32_t servo_ticks(uint32_t eighths, int8_t shift)
+{
+	if (shift >= 0)
+		return eighths << shift;
+	else
+		return (eighths + (1 << (-shift - 1))) >> -shift;
+}
+
+static uint16_t servo_period_ticks(uint16_t period)
+{
+	uint8_t prescaler;
+	return servo_ticks((uint32_t)period << 3, servo_timebase(period, &prescaler)) - 1;
+}
+
+/* Limited to the period, where the output stays high */
+static uint16_t servo_pulse_ticks(uint16_t period, uint32_t eighths)
+{
+	uint8_t prescaler;
+	uint32_t ticks = servo_ticks(eighths, servo_timebase(period, &prescaler));
+	uint32_t max_ticks = (uint32_t)servo_period_ticks(period) + 1;
+	
+	if (ticks > max_ticks)
+		ticks = max_ticks;
+	
+	return (ticks > 0xFFFF) ? 0xFFFF : ticks;
+}
+
+static void servo_report_pulse(uint16_t period, uint16_t ticks, uint16_t * pulse, uint16_t * pulse_fine)
+{
+	uint8_t prescaler;
+	int8_t shift = servo_timebase(period, &prescaler);
+	uint32_t eighths = (shift >= 0) ? (uint32_t)ticks >> shift : (uint32_t)ticks << -shift;
+	
+	*pulse = (eighths + 4) >> 3;
+	*pulse_fine = (eighths > 0xFFFF) ? 0xFFFF : eighths;
+}
+
+static void servo_pwm_start(TC0_t* timer, uint16_t period, uint16_t pulse_fine)
+{
+	uint8_t prescaler;
+	servo_timebase(period, &prescaler);
+	
+	EVSYS_CH2MUX = EVSYS_CHMUX_PRESCALER_16_gc;
+	EVSYS_CH3MUX = EVSYS_CHMUX_PRESCALER_32_gc;
+	
+	timer->CTRLA = 0;
+	timer->CTRLB = TC_WGMODE_SS_gc | TC0_CCAEN_bm;
+	timer->INTCTRLB = 0;
+	timer->CTRLGCLR = TC0_PERBV_bm | TC0_CCABV_bm;
+	timer->CNT = 0;
+	timer->PER = servo_period_ticks(period);
+	timer->CCA = servo_pulse_ticks(period, pulse_fine);
+	timer->CTRLA = prescaler;
+}
+
+/* Applied on the next period if running, otherwise when enabled */
+void servo_set_pulse_motor0(uint32_t eighths)
+{
+	uint16_t ticks = servo_pulse_ticks(app_regs.REG_CAM0_MMODE_PERIOD, eighths);
+	
+	if (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_SERVO)
+		TCC0_CCABUF = ticks;
+	
+	servo_report_pulse(app_regs.REG_CAM0_MMODE_PERIOD, ticks, &app_regs.REG_CAM0_MMODE_PULSE, &app_regs.REG_CAM0_MMODE_PULSE_FINE);
+}
+
+void servo_set_pulse_motor1(uint32_t eighths)
+{
+	uint16_t ticks = servo_pulse_ticks(app_regs.REG_CAM1_MMODE_PERIOD, eighths);
+	
+	if (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_SERVO)
+		TCD0_CCABUF = ticks;
+	
+	servo_report_pulse(app_regs.REG_CAM1_MMODE_PERIOD, ticks, &app_regs.REG_CAM1_MMODE_PULSE, &app_regs.REG_CAM1_MMODE_PULSE_FINE);
+}
+
+/* Called after the period register changes */
+void servo_set_period_motor0(void)
+{
+	uint8_t prescaler;
+	servo_timebase(app_regs.REG_CAM0_MMODE_PERIOD, &prescaler);
+	
+	if (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_SERVO)
+	{
+		if (TCC0_CTRLA == prescaler)
+			TCC0_PERBUF = servo_period_ticks(app_regs.REG_CAM0_MMODE_PERIOD);
+		else
+			servo_pwm_start(&TCC0, app_regs.REG_CAM0_MMODE_PERIOD, app_regs.REG_CAM0_MMODE_PULSE_FINE);
+	}
+	
+	servo_set_pulse_motor0(app_regs.REG_CAM0_MMODE_PULSE_FINE);
+}
+
+void servo_set_period_motor1(void)
+{
+	uint8_t prescaler;
+	servo_timebase(app_regs.REG_CAM1_MMODE_PERIOD, &prescaler);
+	
+	if (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_SERVO)
+	{
+		if (TCD0_CTRLA == prescaler)
+			TCD0_PERBUF = servo_period_ticks(app_regs.REG_CAM1_MMODE_PERIOD);
+		else
+			servo_pwm_start(&TCD0, app_regs.REG_CAM1_MMODE_PERIOD, app_regs.REG_CAM1_MMODE_PULSE_FINE);
+	}
+	
+	servo_set_pulse_motor1(app_regs.REG_CAM1_MMODE_PULSE_FINE);
+}
+
+/************************************************************************/
+/* Servo motion profiles                                                */
+/************************************************************************/
+/* The move is stepped on each PWM overflow and the new pulse width is  */
+/* written to CCABUF, so it's applied on the next period. Velocity and  */
+/* acceleration are converted to us per period when the move starts.   */
+/* The trapezoidal profile uses Q8 fixed point and decelerates when the */
+/* stopping distance reaches the remaining distance. The stopping       */
+/* distance v^2 / 2a is updated with the velocity, by v + a/2 for each  */
+/* change of a, so each period only takes 32 bit additions. The S-curve */
+/* follows 6x^5 - 15x^4 + 10x^3 over the shortest number of periods     */
+/* that respects both limits, so it starts and ends with no velocity    */
+/* and no acceleration.                                                 */
+typedef struct {
+	bool moving;
+	uint8_t profile;
+	int32_t pos;				// Q8 us
+	int32_t target;				// Q8 us
+	int32_t vel;				// Q8 us/period
+	int32_t vel_max;			// Q8 us/period
+	int32_t acc;				// Q8 us/period^2
+	int32_t brake;				// Q8 us, stopping distance at vel
+	int32_t brake_max;			// Q8 us, stopping distance at vel_max
+	int32_t start;				// us
+	int32_t distance;			// us
+	uint16_t step;
+	uint16_t n_steps;
+} servo_motion_t;
+
+servo_motion_t servo0_motion = {.moving = false};
+servo_motion_t servo1_motion = {.moving = false};
+
+static uint16_t isqrt32(uint32_t x)
+{
+	uint32_t root = 0;
+	uint32_t bit = 1UL << 30;
+	
+	while (bit > x)
+		bit >>= 2;
+	
+	while (bit)
+	{
+		if (x >= root + bit)
+		{
+			x -= root + bit;
+			root = (root >> 1) + bit;
+		}
+		else
+		{
+			root >>= 1;
+		}
+		bit >>= 2;
+	}
+	
+	return root;
+}
+
+/* Returns false if the target should be applied at once */
+static bool servo_motion_start(servo_motion_t * m, uint16_t pulse, uint16_t target, uint16_t period, uint16_t vel_max, uint16_t acc, uint8_t profile)
+{
+	m->moving = false;
+	
+	if ((vel_max == 0 && acc == 0) || pulse == target)
+		return false;
+	
+	m->profile = profile;
+	m->pos = (int32_t)pulse << 8;
+	m->target = (int32_t)target << 8;
+	m->vel = 0;
+	m->vel_max = vel_max ? (int32_t)(((uint64_t)vel_max * period * 256) / 1000000) : 0x7FFFFFFF;
+	m->acc = acc ? (int32_t)(((uint64_t)acc * period * period * 256) / 1000000000000ULL) : 0;
+	
+	if (m->vel_max == 0)
+		m->vel_max = 1;
+	if (acc && m->acc == 0)
+		m->acc = 1;
+	
+	m->brake = 0;
+	m->brake_max = 0x7FFFFFFF;
+	if (m->acc)
+	{
+		uint64_t brake_max = ((uint64_t)m->vel_max * m->vel_max) / (2 * (uint32_t)m->acc);
+		if (brake_max < 0x7FFFFFFF)
+			m->brake_max = brake_max;
+	}
+	
+	if (profile == GM_MMODE_PROFILE_SCURVE)
+	{
+		uint32_t distance = (target > pulse) ? target - pulse : pulse - target;
+		uint32_t n_vel = 0;
+		uint32_t n_acc = 0;
+		
+		/* Peak velocity is 1.875 d/n and peak acceleration is 5.77 d/n^2 */
+		if (vel_max)
+			n_vel = (distance * 480 + m->vel_max - 1) / m->vel_max;
+		if (acc)
+			n_acc = isqrt32((distance * 1478 + m->acc - 1) / m->acc) + 1;
+		
+		uint32_t n_steps = (n_vel > n_acc) ? n_vel : n_acc;
+		
+		m->start = pulse;
+		m->distance = (int32_t)target - pulse;
+		m->step = 0;
+		m->n_steps = (n_steps > 0xFFFF) ? 0xFFFF : ((n_steps < 1) ? 1 : n_steps);
+	}
+	
+	m->moving = true;
+	return true;
+}
+
+/* Returns the pulse width (1/8 us) for the next period */
+static uint32_t servo_motion_step(servo_motion_t * m)
+{
+	if (m->profile == GM_MMODE_PROFILE_SCURVE)
+	{
+		int32_t x = ((uint32_t)(++m->step) << 15) / m->n_steps;	// Q15
+		int32_t x2 = (x * x) >> 15;
+		int32_t x3 = (x2 * x) >> 15;
+		int32_t x4 = (x3 * x) >> 15;
+		int32_t x5 = (x4 * x) >> 15;
+		int32_t smooth = 6 * x5 - 15 * x4 + 10 * x3;
+		
+		m->pos = (m->start + ((m->distance * smooth) >> 15)) << 8;
+		
+		if (m->step >= m->n_steps)
+		{
+			m->pos = m->target;
+			m->moving = false;
+		}
+	}
+	else
+	{
+		int32_t remaining = m->target - m->pos;
+		uint32_t distance = (remaining < 0) ? -remaining : remaining;
+		
+		if (m->acc == 0)
+		{
+			m->vel = m->vel_max;
+		}
+		else if ((uint32_t)m->brake >= distance)
+		{
+			if (m->vel - m->acc < m->acc)
+			{
+				m->vel = m->acc;
+				m->brake = m->acc >> 1;
+			}
+			else
+			{
+				m->brake -= m->vel - (m->acc >> 1);
+				m->vel -= m->acc;
+			}
+		}
+		else if (m->vel < m->vel_max)
+		{
+			if (m->vel > m->vel_max - m->acc)
+			{
+				m->vel = m->vel_max;
+				m->brake = m->brake_max;
+			}
+			else
+			{
+				m->brake += m->vel + (m->acc >> 1);
+				m->vel += m->acc;
+			}
+		}
+		
+		if ((uint32_t)m->vel >= distance)
+		{
+			m->pos = m->target;
+			m->moving = false;
+		}
+		else
+		{
+			m->pos += (remaining < 0) ? -m->vel : m->vel;
+		}
+	}
+	
+	return (m->pos + 16) >> 5;
+}
+
+/* Trajectories are uploaded to the waypoints register and copied when */
+/* the playback starts, so the next one can be uploaded while playing.  */
+/* A play received while playing is queued and the upload is swapped in */
+/* on the period that ends the current trajectory, with no gap between  */
+/* them. The waypoints can't be written while a swap is queued. The     */
+/* pulse width is linearly interpolated on each PWM period, and the     */
+/* playback starts on the next period. The slope of each segment is     */
+/* computed once when the segment is entered, so the overflow interrupt */
+/* only adds it to the pulse width in 16.16 fixed point.                */
+#define TRAJ_MAX_WAYPOINTS 8
+
+typedef struct {
+	bool playing;
+	bool queued;				// Upload swapped in at the end
+	bool rising;
+	uint8_t n_waypoints;
+	uint8_t segment;
+	uint32_t time;				// us
+	uint32_t t_next;			// us
+	uint32_t pulse;			// us, Q16
+	uint32_t slope;			// us per period, Q16
+	uint32_t target;			// us, Q16
+	uint16_t * upload;			// Waypoints register
+	uint8_t * upload_len;
+	uint16_t waypoints[TRAJ_MAX_WAYPOINTS * 2];
+} servo_trajectory_t;
+
+servo_trajectory_t servo0_trajectory = {.playing = false, .upload = app_regs.REG_CAM0_MMODE_WP, .upload_len = &app_regs.REG_CAM0_MMODE_WP_LEN};
+servo_trajectory_t servo1_trajectory = {.playing = false, .upload = app_regs.REG_CAM1_MMODE_WP, .upload_len = &app_regs.REG_CAM1_MMODE_WP_LEN};
+
+bool servo_trajectory_playing(uint8_t motor)
+{
+	return (motor ? servo1_trajectory.playing : servo0_trajectory.playing);
+}
+
+bool servo_trajectory_queued(uint8_t motor)
+{
+	return (motor ? servo1_trajectory.queued : servo0_trajectory.queued);
+}
+
+static void servo_trajectory_segment(servo_trajectory_t * tr, uint16_t period)
+{
+	uint16_t * wp = tr->waypoints;
+	
+	while (tr->segment + 1 < tr->n_waypoints && tr->time >= (uint32_t)wp[(tr->segment + 1) * 2] * 1000)
+		tr->segment++;
+	
+	uint32_t t0 = (uint32_t)wp[tr->segment * 2] * 1000;
+	uint16_t p0 = wp[tr->segment * 2 + 1];
+	
+	tr->pulse = (uint32_t)p0 << 16;
+	tr->target = tr->pulse;
+	tr->slope = 0;
+	
+	if (tr->segment + 1 >= tr->n_waypoints)
+	{
+		tr->playing = false;
+	}
+	else if (tr->time < t0)
+	{
+		/* Hold the first waypoint until its time is reached */
+		tr->t_next = t0;
+	}
+	else
+	{
+		uint32_t t1 = (uint32_t)wp[(tr->segment + 1) * 2] * 1000;
+		uint16_t p1 = wp[(tr->segment + 1) * 2 + 1];
+		uint32_t dt = t1 - t0;
+		
+		/* Less than one period elapsed since t0, so this fits 32 bits */
+		uint32_t frac = ((tr->time - t0) << 16) / dt;
+		
+		tr->rising = (p1 >= p0);
+		uint16_t delta = tr->rising ? p1 - p0 : p0 - p1;
+		uint32_t offset = (uint32_t)delta * frac;
+		
+		tr->pulse = tr->rising ? tr->pulse + offset : tr->pulse - offset;
+		
+		/* Q16 us per ms, scaled to one period in two parts so it stays */
+		/* in 32 bits. A segment shorter than a period is done in one.  */
+		uint16_t dt_ms = wp[(tr->segment + 1) * 2] - wp[tr->segment * 2];
+		uint32_t rate = (((uint32_t)delta << 16) + dt_ms / 2) / dt_ms;
+		uint32_t whole = rate / 1000;
+		
+		if (whole >= UINT32_MAX / period)
+			tr->slope = (uint32_t)delta << 16;
+		else
+			tr->slope = whole * period + ((rate % 1000) * period + 500) / 1000;
+		
+		tr->target = (uint32_t)p1 << 16;
+		tr->t_next = t1;
+	}
+}
+
+/* Returns the pulse width in 1/8 us */
+static uint16_t servo_trajectory_pulse(servo_trajectory_t * tr)
+{
+	uint16_t eighths = (tr->pulse + 0x1000) >> 13;
+	
+	return (eighths < 16) ? 16 : eighths;
+}
+
+static void servo_trajectory_load(servo_trajectory_t * tr, uint16_t period)
+{
+	for (uint8_t i = 0; i < TRAJ_MAX_WAYPOINTS * 2; i++)
+		tr->waypoints[i] = tr->upload[i];
+	
+	tr->n_waypoints = *tr->upload_len;
+	tr->segment = 0;
+	tr->time = 0;
+	tr->playing = true;
+	tr->queued = false;
+	servo_trajectory_segment(tr, period);
+}
+
+static uint16_t servo_trajectory_start(servo_trajectory_t * tr, uint16_t period)
+{
+	servo_trajectory_load(tr, period);
+	
+	return servo_trajectory_pulse(tr);
+}
+
+static uint16_t servo_trajectory_step(servo_trajectory_t * tr, uint16_t period)
+{
+	tr->time += period;
+	
+	if (tr->time >= tr->t_next)
+	{
+		servo_trajectory_segment(tr, period);
+		
+		if (!tr->playing && tr->queued)
+			servo_trajectory_load(tr, period);
+	}
+	else if (tr->rising)
+	{
+		tr->pulse += tr->slope;
+		if (tr->pulse > tr->target)
+			tr->pulse = tr->target;
+	}
+	else
+	{
+		tr->pulse -= tr->slope;
+		if (tr->pulse < tr->target)
+			tr->pulse = tr->target;
+	}
+	
+	return servo_trajectory_pulse(tr);
+}
+
+/* Setpoints written to the FIFO register are queued and one is applied */
+/* per PWM period through CCABUF, so the update rate follows the PWM    */
+/* period and not the host writes. When the queue runs empty the last   */
+/* pulse width is kept, the underrun is reported and the streaming      */
+/* stops until new setpoints arrive.                                    */
+#define SERVO_FIFO_LEN 16								// Power of 2
+
+typedef struct {
+	uint8_t head;										// Written by the register write
+	uint8_t tail;										// Written by the PWM overflow
+	uint16_t setpoints[SERVO_FIFO_LEN];					// 1/8 us
+} servo_fifo_t;
+
+servo_fifo_t servo0_fifo;
+servo_fifo_t servo1_fifo;
+bool servo0_fifo_streaming = false;
+bool servo1_fifo_streaming = false;
+
+static uint8_t servo_fifo_free(servo_fifo_t * f)
+{
+	return (SERVO_FIFO_LEN - 1) - ((f->head - f->tail) & (SERVO_FIFO_LEN - 1));
+}
+
+/* Returns false if there's no room for the whole batch */
+static bool servo_fifo_push(servo_fifo_t * f, uint16_t * setpoints, uint8_t n)
+{
+	uint8_t count = 0;
+	
+	for (uint8_t i = 0; i < n; i++)
+		if (setpoints[i])
+			count++;
+	
+	if (count > servo_fifo_free(f))
+		return false;
+	
+	for (uint8_t i = 0; i < n; i++)
+	{
+		if (setpoints[i])
+		{
+			f->setpoints[f->head] = setpoints[i];
+			f->head = (f->head + 1) & (SERVO_FIFO_LEN - 1);
+		}
+	}
+	
+	return true;
+}
+
+static void servo_fifo_underrun(uint8_t motor)
+{
+	app_regs.REG_MOTORS_UNDERRUN[motor]++;
+	
+	if (app_regs.REG_EVT_EN & B_EVT_UNDERRUN)
+		core_func_send_event(ADD_REG_MOTORS_UNDERRUN, true);
+}
+
+/* Drops the queued setpoints */
+void servo_fifo_stop_motor0(void)
+{
+	if (servo0_fifo_streaming)
+	{
+		servo0_fifo_streaming = false;
+		TCC0_INTCTRLA = 0;
+	}
+	
+	servo0_fifo.tail = servo0_fifo.head;
+}
+
+void servo_fifo_stop_motor1(void)
+{
+	if (servo1_fifo_streaming)
+	{
+		servo1_fifo_streaming = false;
+		TCD0_INTCTRLA = 0;
+	}
+	
+	servo1_fifo.tail = servo1_fifo.head;
+}
+
+static void servo_motion_done(uint8_t motor_bit)
+{
+	app_regs.REG_MOTORS_MOVING &= ~motor_bit;
+	
+	if (app_regs.REG_EVT_EN & B_EVT_MOTORS)
+		core_func_send_event(ADD_REG_MOTORS_MOVING, true);
+}
+
+/* Called from the PWM overflow while moving */
+void servo_motion_step_motor0(void)
+{
+	if (servo0_fifo_streaming)
+	{
+		if (servo0_fifo.head != servo0_fifo.tail)
+		{
+			servo_set_pulse_motor0(servo0_fifo.setpoints[servo0_fifo.tail]);
+			servo0_fifo.tail = (servo0_fifo.tail + 1) & (SERVO_FIFO_LEN - 1);
+		}
+		else
+		{
+			servo0_fifo_streaming = false;
+			TCC0_INTCTRLA = 0;
+			servo_fifo_underrun(0);
+		}
+		return;
+	}
+	
+	if (servo0_trajectory.playing)
+		servo_set_pulse_motor0(servo_trajectory_step(&servo0_trajectory, app_regs.REG_CAM0_MMODE_PERIOD));
+	else if (servo0_motion.moving)
+		servo_set_pulse_motor0(servo_motion_step(&servo0_motion));
+	
+	if (!servo0_motion.moving && !servo0_trajectory.playing)
+	{
+		TCC0_INTCTRLA = 0;
+		servo_motion_done(B_MOTOR0);
+	}
+}
+
+void servo_motion_step_motor1(void)
+{
+	if (servo1_fifo_streaming)
+	{
+		if (servo1_fifo.head != servo1_fifo.tail)
+		{
+			servo_set_pulse_motor1(servo1_fifo.setpoints[servo1_fifo.tail]);
+			servo1_fifo.tail = (servo1_fifo.tail + 1) & (SERVO_FIFO_LEN - 1);
+		}
+		else
+		{
+			servo1_fifo_streaming = false;
+			TCD0_INTCTRLA = 0;
+			servo_fifo_underrun(1);
+		}
+		return;
+	}
+	
+	if (servo1_trajectory.playing)
+		servo_set_pulse_motor1(servo_trajectory_step(&servo1_trajectory, app_regs.REG_CAM1_MMODE_PERIOD));
+	else if (servo1_motion.moving)
+		servo_set_pulse_motor1(servo_motion_step(&servo1_motion));
+	
+	if (!servo1_motion.moving && !servo1_trajectory.playing)
+	{
+		TCD0_INTCTRLA = 0;
+		servo_motion_done(B_MOTOR1);
+	}
+}
+
+void servo_motion_move_motor0(void)
+{
+	bool running = (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_SERVO);
+	
+	if (running)
+		TCC0_INTCTRLA = 0;
+	
+	servo0_trajectory.playing = false;
+	servo0_trajectory.queued = false;
+	servo_fifo_stop_motor0();
+	
+	/* Only moves if the servo is running, otherwise the target is used when enabled */
+	if (running && servo_motion_start(&servo0_motion, app_regs.REG_CAM0_MMODE_PULSE, app_regs.REG_CAM0_MMODE_TARGET, app_regs.REG_CAM0_MMODE_PERIOD, app_regs.REG_CAM0_MMODE_MAX_VEL, app_regs.REG_CAM0_MMODE_ACCEL, app_regs.REG_CAM0_MMODE_PROFILE))
+	{
+		app_regs.REG_MOTORS_MOVING |= B_MOTOR0;
+		TCC0_INTFLAGS = TC0_OVFIF_bm;
+		TCC0_INTCTRLA = TC_OVFINTLVL_LO_gc;
+	}
+	else
+	{
+		servo_set_pulse_motor0((uint32_t)app_regs.REG_CAM0_MMODE_TARGET << 3);
+		
+		if (app_regs.REG_MOTORS_MOVING & B_MOTOR0)
+			servo_motion_done(B_MOTOR0);
+	}
+}
+
+void servo_motion_move_motor1(void)
+{
+	bool running = (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_SERVO);
+	
+	if (running)
+		TCD0_INTCTRLA = 0;
+	
+	servo1_trajectory.playing = false;
+	servo1_trajectory.queued = false;
+	servo_fifo_stop_motor1();
+	
+	/* Only moves if the servo is running, otherwise the target is used when enabled */
+	if (running && servo_motion_start(&servo1_motion, app_regs.REG_CAM1_MMODE_PULSE, app_regs.REG_CAM1_MMODE_TARGET, app_regs.REG_CAM1_MMODE_PERIOD, app_regs.REG_CAM1_MMODE_MAX_VEL, app_regs.REG_CAM1_MMODE_ACCEL, app_regs.REG_CAM1_MMODE_PROFILE))
+	{
+		app_regs.REG_MOTORS_MOVING |= B_MOTOR1;
+		TCD0_INTFLAGS = TC0_OVFIF_bm;
+		TCD0_INTCTRLA = TC_OVFINTLVL_LO_gc;
+	}
+	else
+	{
+		servo_set_pulse_motor1((uint32_t)app_regs.REG_CAM1_MMODE_TARGET << 3);
+		
+		if (app_regs.REG_MOTORS_MOVING & B_MOTOR1)
+			servo_motion_done(B_MOTOR1);
+	}
+}
+
+/* Stops a move where it is */
+void servo_motion_cancel_motor0(void)
+{
+	servo_fifo_stop_motor0();
+	
+	if (servo0_motion.moving || servo0_trajectory.playing)
+	{
+		servo0_motion.moving = false;
+		servo0_trajectory.playing = false;
+		servo0_trajectory.queued = false;
+		TCC0_INTCTRLA = 0;
+		servo_motion_done(B_MOTOR0);
+	}
+}
+
+void servo_motion_cancel_motor1(void)
+{
+	servo_fifo_stop_motor1();
+	
+	if (servo1_motion.moving || servo1_trajectory.playing)
+	{
+		servo1_motion.moving = false;
+		servo1_trajectory.playing = false;
+		servo1_trajectory.queued = false;
+		TCD0_INTCTRLA = 0;
+		servo_motion_done(B_MOTOR1);
+	}
+}
+
+void servo_trajectory_play_motor0(void)
+{
+	if (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_SERVO)
+	{
+		uint8_t sreg = SREG;
+		cli();
+		if (servo0_trajectory.playing)
+		{
+			servo0_trajectory.queued = true;
+			SREG = sreg;
+			return;
+		}
+		SREG = sreg;
+		
+		TCC0_INTCTRLA = 0;
+		servo0_motion.moving = false;
+		servo_fifo_stop_motor0();
+		
+		servo_set_pulse_motor0(servo_trajectory_start(&servo0_trajectory, app_regs.REG_CAM0_MMODE_PERIOD));
+		
+		app_regs.REG_MOTORS_MOVING |= B_MOTOR0;
+		TCC0_INTFLAGS = TC0_OVFIF_bm;
+		TCC0_INTCTRLA = TC_OVFINTLVL_LO_gc;
+	}
+}
+
+void servo_trajectory_play_motor1(void)
+{
+	if (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_SERVO)
+	{
+		uint8_t sreg = SREG;
+		cli();
+		if (servo1_trajectory.playing)
+		{
+			servo1_trajectory.queued = true;
+			SREG = sreg;
+			return;
+		}
+		SREG = sreg;
+		
+		TCD0_INTCTRLA = 0;
+		servo1_motion.moving = false;
+		servo_fifo_stop_motor1();
+		
+		servo_set_pulse_motor1(servo_trajectory_start(&servo1_trajectory, app_regs.REG_CAM1_MMODE_PERIOD));
+		
+		app_regs.REG_MOTORS_MOVING |= B_MOTOR1;
+		TCD0_INTFLAGS = TC0_OVFIF_bm;
+		TCD0_INTCTRLA = TC_OVFINTLVL_LO_gc;
+	}
+}
+
+bool servo_fifo_write_motor0(uint16_t * setpoints)
+{
+	if (app_regs.REG_CHANNEL_STATE[0] != GM_CHANNEL_SERVO)
+		return false;
+	
+	if (!servo0_fifo_streaming)
+		servo_motion_cancel_motor0();
+	
+	if (!servo_fifo_push(&servo0_fifo, setpoints, 8))
+		return false;
+	
+	uint8_t sreg = SREG;
+	cli();
+	if (!servo0_fifo_streaming && servo0_fifo.head != servo0_fifo.tail)
+	{
+		servo0_fifo_streaming = true;
+		TCC0_INTFLAGS = TC0_OVFIF_bm;
+		TCC0_INTCTRLA = TC_OVFINTLVL_LO_gc;
+	}
+	SREG = sreg;
+	
+	return true;
+}
+
+bool servo_fifo_write_motor1(uint16_t * setpoints)
+{
+	if (app_regs.REG_CHANNEL_STATE[1] != GM_CHANNEL_SERVO)
+		return false;
+	
+	if (!servo1_fifo_streaming)
+		servo_motion_cancel_motor1();
+	
+	if (!servo_fifo_push(&servo1_fifo, setpoints, 8))
+		return false;
+	
+	uint8_t sreg = SREG;
+	cli();
+	if (!servo1_fifo_streaming && servo1_fifo.head != servo1_fifo.tail)
+	{
+		servo1_fifo_streaming = true;
+		TCD0_INTFLAGS = TC0_OVFIF_bm;
+		TCD0_INTCTRLA = TC_OVFINTLVL_LO_gc;
+	}
+	SREG = sreg;
+	
+	return true;
+}
+
+/* Called from the DI0 interrupt on each rising edge */
+void servo_trajectory_rising_edge(void)
+{
+	if (app_regs.REG_MOTORS_PLAY_IN0 & B_MOTOR0)
+		servo_trajectory_play_motor0();
+	if (app_regs.REG_MOTORS_PLAY_IN0 & B_MOTOR1)
+		servo_trajectory_play_motor1();
+}
+
+/* Restarts the selected servo timers with a manual event on channel 7, */
+/* so their periods start on the same clock cycle. The period in        */
+/* progress is cut short on each line restarted, so on both lines when  */
+/* both servos are selected. Servos with the same period stay aligned.  */
+void servo_align(uint8_t motors)
+{
+	uint8_t sreg = SREG;
+	cli();
+	
+	if ((motors & B_MOTOR0) && app_regs.REG_TIMER_OWNERS[TIMER_TCC0] == GM_TIMER_OWNER_SERVO)
+		TCC0_CTRLD = TC_EVACT_RESTART_gc | TC_EVSEL_CH7_gc;
+	if ((motors & B_MOTOR1) && app_regs.REG_TIMER_OWNERS[TIMER_TCD0] == GM_TIMER_OWNER_SERVO)
+		TCD0_CTRLD = TC_EVACT_RESTART_gc | TC_EVSEL_CH7_gc;
+	
+	EVSYS_STROBE = (1 << 7);
+	
+	if (app_regs.REG_TIMER_OWNERS[TIMER_TCC0] == GM_TIMER_OWNER_SERVO)
+		TCC0_CTRLD = 0;
+	if (app_regs.REG_TIMER_OWNERS[TIMER_TCD0] == GM_TIMER_OWNER_SERVO)
+		TCD0_CTRLD = 0;
+	
+	SREG = sreg;
+}
+
+void enable_motor0(void)
+{
+	if (app_regs.REG_CHANNEL_STATE[0] != GM_CHANNEL_SERVO)
+	{
+		if (camera0_ext_running)
+			ext_clock_stop_camera0();
+		if (camera0_seq_running)
+			seq_stop_camera0();
+		
+		servo_motion_cancel_motor0();
+		camera0_soft_pulse = false;
+		TCC0_INTCTRLA = 0;
+		servo_pwm_start(&TCC0, app_regs.REG_CAM0_MMODE_PERIOD, app_regs.REG_CAM0_MMODE_PULSE_FINE);
+		app_regs.REG_TIMER_OWNERS[TIMER_TCC0] = GM_TIMER_OWNER_SERVO;
+		channel_set_state(0, GM_CHANNEL_SERVO);
+		clr_CAM0_TRIG;
+	}
+}
+void enable_motor1(void)
+{
+	if (app_regs.REG_CHANNEL_STATE[1] != GM_CHANNEL_SERVO)
+	{
+		if (camera1_ext_running)
+			ext_clock_stop_camera1();
+		if (camera1_seq_running)
+			seq_stop_camera1();
+		
+		servo_motion_cancel_motor1();
+		camera1_soft_pulse = false;
+		TCD0_INTCTRLA = 0;
+		servo_pwm_start(&TCD0, app_regs.REG_CAM1_MMODE_PERIOD, app_regs.REG_CAM1_MMODE_PULSE_FINE);
+		app_regs.REG_TIMER_OWNERS[TIMER_TCD0] = GM_TIMER_OWNER_SERVO;
+		channel_set_state(1, GM_CHANNEL_SERVO);
+		clr_CAM1_TRIG;
+	}
+}
+void disable_motor0(void)
+{
+	if (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_SERVO)
+	{
+		servo_motion_cancel_motor0();
+		timer_type0_stop(&TCC0);
+		app_regs.REG_TIMER_OWNERS[TIMER_TCC0] = GM_TIMER_OWNER_FREE;
+		channel_set_state(0, GM_CHANNEL_IDLE);
+	}
+}
+void disable_motor1(void)
 {
-	timer_type0_stop(&TCC0);	// Stop Cam0 or Motor0
-	timer_type0_stop(&TCD0);	// Stop Cam1 or Motor1
-
-	clr_CAM0_TRIG;
-	clr_CAM1_TRIG;
-	clr_CAM0_SYNC;
-	clr_CAM1_SYNC;
+	if (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_SERVO)
+	{
+		servo_motion_cancel_motor1();
+		timer_type0_stop(&TCD0);
+		app_regs.REG_TIMER_OWNERS[TIMER_TCD0] = GM_TIMER_OWNER_FREE;
+		channel_set_state(1, GM_CHANNEL_IDLE);
+	}
 }
 
 /************************************************************************/
-/* General definitions                                                  */
+/* Acquisition schedule                                                 */
 /************************************************************************/
-// #define NBYTES 23
+/* Evaluated on each Harp second. Each entry opens a window of          */
+/* <duration> seconds at <offset> seconds into every schedule period,   */
+/* counted from the Harp time origin. Windows open on the Harp second   */
+/* and close through the usual stop, so the last frame is completed.    */
+/* A window only opens on an idle line in camera mode, so it never      */
+/* takes over a running camera or a servo, and a window that follows    */
+/* another one opens on the first Harp second after the stop completes. */
+/* The window runs at its own frequency, which the frequency register   */
+/* reads back while the window is open, and the value written by the    */
+/* host is used again for the next start.                               */
+#define SCHED_N_ENTRIES 4
 
-/************************************************************************/
-/* General used functions                                               */
-/************************************************************************/
-/* Load external functions if needed */
-//#include "hwbp_app_pwm_gen_funcs.c"
+int8_t camera0_sched_window = -1;		// Open entry or -1
+int8_t camera1_sched_window = -1;
 
-bool camera0_pulse;
-int8_t camera0_sync_sec_counter;
+static int8_t sched_find_window(uint32_t * sched, uint32_t period, uint32_t seconds)
+{
+	uint32_t position = seconds % period;
+	
+	for (uint8_t i = 0; i < SCHED_N_ENTRIES; i++)
+	{
+		uint32_t offset = sched[i * 3] % period;
+		uint32_t duration = sched[i * 3 + 1];
+		
+		if (duration && ((position + period - offset) % period) < duration)
+			return i;
+	}
+	
+	return -1;
+}
 
-#define rise_cam0_trig_now	set_CAM0_TRIG; \
-                            if (app_regs.REG_EVT_EN & B_EVT_CAMS) \
-                            {   \
-                                app_regs.REG_CAM0 = 1;  \
-                                core_func_send_event(ADD_REG_CAM0, true);   \
-                            }
+static void sched_send_windows(void)
+{
+	if (app_regs.REG_EVT_EN & B_EVT_SCHED)
+		core_func_send_event(ADD_REG_SCHED_WINDOWS, true);
+}
 
-void start_camera0(void)
+void sched_close_camera0(void)
 {
-	uint16_t camera_freq = app_regs.REG_CAM0_FREQ << 1;	// Multiply CAM_FREQ x 2
+	if (camera0_sched_window < 0)
+		return;
+	
+	camera0_sched_window = -1;
+	stop_camera0();
+	
+	app_regs.REG_SCHED_WINDOWS &= ~B_SCHED_CAM0;
+	sched_send_windows();
+}
 
-	if (TCC0_CTRLA == 0 || TCC0_CTRLB != 0)					// Timer not running or in PWM mode
-	{
-		camera0_pulse = false;
-		camera0_sync_sec_counter = -1;
+void sched_close_camera1(void)
+{
+	if (camera1_sched_window < 0)
+		return;
+	
+	camera1_sched_window = -1;
+	stop_camera1();
+	
+	app_regs.REG_SCHED_WINDOWS &= ~B_SCHED_CAM1;
+	sched_send_windows();
+}
 
-		if (read_CAM0_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
-		{
-			app_regs.REG_SYNC0 = 0;
-			core_func_send_event(ADD_REG_SYNC0, true);
-		}		
-		clr_CAM0_SYNC;
+static void sched_open_camera0(int8_t window)
+{
+	if (app_regs.REG_CAM0_MODE != GM_CAM0_MODE_CAM || app_regs.REG_CHANNEL_STATE[0] != GM_CHANNEL_IDLE)
+		return;
+	
+	camera0_sched_window = window;
+	clr_CAM0_TRIG;
+	start_camera0(app_regs.REG_CAM0_SCHED[window * 3 + 2]);
+	
+	app_regs.REG_SCHED_WINDOWS |= B_SCHED_CAM0;
+	sched_send_windows();
+}
 
-		if (camera_freq < 8)
-		{
-			timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV256, (32000000/256)/camera_freq, INT_LEVEL_LOW);
-            rise_cam0_trig_now;
-		}
-		else if (camera_freq < 64)
-		{
-			timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV64, (32000000/64)/camera_freq, INT_LEVEL_LOW);
-			rise_cam0_trig_now;
-		}
-		else if (camera_freq < 128)
+static void sched_open_camera1(int8_t window)
+{
+	if (app_regs.REG_CAM1_MODE != GM_CAM1_MODE_CAM || app_regs.REG_CHANNEL_STATE[1] != GM_CHANNEL_IDLE)
+		return;
+	
+	camera1_sched_window = window;
+	clr_CAM1_TRIG;
+	start_camera1(app_regs.REG_CAM1_SCHED[window * 3 + 2]);
+	
+	app_regs.REG_SCHED_WINDOWS |= B_SCHED_CAM1;
+	sched_send_windows();
+}
+
+static void sched_update(uint32_t seconds)
+{
+	int8_t window0 = -1;
+	int8_t window1 = -1;
+	
+	if (app_regs.REG_SCHED_EN & B_SCHED_CAM0)
+		window0 = sched_find_window(app_regs.REG_CAM0_SCHED, app_regs.REG_CAM0_SCHED_PERIOD, seconds);
+	if (app_regs.REG_SCHED_EN & B_SCHED_CAM1)
+		window1 = sched_find_window(app_regs.REG_CAM1_SCHED, app_regs.REG_CAM1_SCHED_PERIOD, seconds);
+	
+	if (window0 != camera0_sched_window)
+	{
+		if (camera0_sched_window >= 0)
 		{
-			timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV8, (32000000/8)/camera_freq, INT_LEVEL_LOW);
-			rise_cam0_trig_now;
+			sched_close_camera0();
 		}
-		else if (camera_freq < 256)
+		else
 		{
-			timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV4, (32000000/4)/camera_freq, INT_LEVEL_LOW);
-			rise_cam0_trig_now;
+			sched_open_camera0(window0);
 		}
-		else /*if (camera_freq <= 512)*/
+	}
+	
+	if (window1 != camera1_sched_window)
+	{
+		if (camera1_sched_window >= 0)
 		{
-			timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV2, (32000000/2)/camera_freq, INT_LEVEL_LOW);
-			rise_cam0_trig_now;
+			sched_close_camera1();
 		}
-		/*
-		else if (camera_freq <= 1024)
+		else
 		{
-			timer_type0_enable(&TCC0, TIMER_PRESCALER_DIV1, (32000000/1)/camera_freq, INT_LEVEL_LOW);
+			sched_open_camera1(window1);
 		}
-		*/
 	}
 }
-bool camera1_pulse;
-int8_t camera1_sync_sec_counter;
 
-#define rise_cam1_trig_now	set_CAM1_TRIG; \
-                            if (app_regs.REG_EVT_EN & B_EVT_CAMS) \
-                            {   \
-                                app_regs.REG_CAM1 = 1;  \
-                                core_func_send_event(ADD_REG_CAM1, true);   \
-                            }
+/************************************************************************/
+/* Staged configuration                                                 */
+/************************************************************************/
+/* While staging, each write is checked for address, type, length and   */
+/* value, and queued without being applied. Only configuration          */
+/* registers can be staged, the commands and actions like starts,       */
+/* stops, soft triggers, moves and playbacks are rejected. The commit   */
+/* replays the queued writes in order through the usual handlers with   */
+/* the interrupts disabled, so no trigger or servo period sees part of  */
+/* the new configuration. The modes take effect after the last write,   */
+/* from the final values, so intermediate modes never stop or drive the */
+/* lines. Checks that depend on the device state, like a queued         */
+/* trajectory, are still made by the handlers and counted as rejected.  */
+/* The queue holds the largest stageable register, a schedule.          */
+#define CONFIG_STAGE_BYTES 48
+#define CONFIG_STAGE_WRITES 6
 
-void start_camera1(void)
+uint8_t config_stage_data[CONFIG_STAGE_BYTES];
+uint8_t config_stage_add[CONFIG_STAGE_WRITES];
+uint8_t config_stage_bytes = 0;
+uint8_t config_stage_writes = 0;
+bool config_commit_on_second = false;
+bool config_committing = false;
+
+static uint8_t config_reg_size(uint8_t add)
 {
-	uint16_t camera_freq = app_regs.REG_CAM1_FREQ << 1;	// Multiply CAM_FREQ x 2
+	return (app_regs_type[add-APP_REGS_ADD_MIN] & 0x0F) * app_regs_n_elements[add-APP_REGS_ADD_MIN];
+}
 
-	if (TCD0_CTRLA == 0 || TCD0_CTRLB != 0)					// Timer not running or in PWM mode
+static bool config_check_u16(uint8_t * content, uint8_t n, uint16_t min, uint16_t max)
+{
+	for (uint8_t i = 0; i < n; i++)
 	{
-		camera1_pulse = false;
-		camera1_sync_sec_counter = -1;
-
-		if (read_CAM1_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
-		{
-			app_regs.REG_SYNC1 = 0;
-			core_func_send_event(ADD_REG_SYNC1, true);
-		}		
-		clr_CAM1_SYNC;
-
-		if (camera_freq < 8)
-		{
-			timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV256, (32000000/256)/camera_freq, INT_LEVEL_LOW);
-			rise_cam1_trig_now;
-		}
-		else if (camera_freq < 64)
-		{
-			timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV64, (32000000/64)/camera_freq, INT_LEVEL_LOW);
-			rise_cam1_trig_now;
-		}
-		else if (camera_freq < 128)
-		{
-			timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV8, (32000000/8)/camera_freq, INT_LEVEL_LOW);
-			rise_cam1_trig_now;
-		}
-		else if (camera_freq < 256)
-		{
-			timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV4, (32000000/4)/camera_freq, INT_LEVEL_LOW);
-			rise_cam1_trig_now;
-		}
-		else /*if (camera_freq <= 512)*/
-		{
-			timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV2, (32000000/2)/camera_freq, INT_LEVEL_LOW);
-			rise_cam1_trig_now;
-		}
-		/*
-		else if (camera_freq <= 1024)
-		{
-			timer_type0_enable(&TCD0, TIMER_PRESCALER_DIV1, (32000000/1)/camera_freq, INT_LEVEL_LOW);
-		}
-		*/
+		uint16_t value = ((uint16_t*)content)[i];
+		
+		if (value < min || value > max)
+			return false;
 	}
+	
+	return true;
 }
 
-bool stop_cam0 = false;
-bool stop_cam1 = false;
+static bool config_check_sched(uint32_t * entries, uint16_t min, uint16_t max)
+{
+	for (uint8_t i = 0; i < SCHED_N_ENTRIES * 3; i += 3)
+		if (entries[i + 1] && (entries[i + 2] < min || entries[i + 2] > max))
+			return false;
+	
+	return true;
+}
 
-void stop_camera0(void)
+/* The masks and ranges of device.yml are checked by the dispatcher, so */
+/* only the checks left to the write handlers are made here. False if   */
+/* the register can't be staged.                                        */
+static bool config_stage_check(uint8_t add, uint8_t * content)
 {
-	if (TCC0_CTRLA != 0 && TCC0_CTRLB == 0)	// Running but not running PWM mode
+	uint8_t reg = content[0];
+	
+	switch (add)
 	{
-		stop_cam0 = true;
+		case ADD_REG_SYNC_INTERVAL:			return reg >= 1 && reg <= 100;
+		case ADD_REG_CAM0_MMODE_PERIOD:
+		case ADD_REG_CAM0_MMODE_PULSE:
+		case ADD_REG_CAM1_MMODE_PERIOD:
+		case ADD_REG_CAM1_MMODE_PULSE:
+		case ADD_REG_CAM0_MMODE_PULSE_FINE:
+		case ADD_REG_CAM1_MMODE_PULSE_FINE:	return config_check_u16(content, 1, 1, 0xFFFF);
+		case ADD_REG_CAM0_SEQ:
+		case ADD_REG_CAM1_SEQ:				return config_check_u16(content, SEQ_MAX_LEN, 1000, 0xFFFF);
+		case ADD_REG_CAM0_SCHED:			return config_check_sched((uint32_t*)content, CAMERA0_FREQUENCY_MIN, CAMERA0_FREQUENCY_MAX);
+		case ADD_REG_CAM1_SCHED:			return config_check_sched((uint32_t*)content, CAMERA1_FREQUENCY_MIN, CAMERA1_FREQUENCY_MAX);
+		case ADD_REG_IN0_MODE:
+		case ADD_REG_CAM0_MODE:
+		case ADD_REG_CAM1_MODE:
+		case ADD_REG_CAM0_FREQ:
+		case ADD_REG_CAM1_FREQ:
+		case ADD_REG_EVT_EN:
+		case ADD_REG_CAM0_CLK_DIV:
+		case ADD_REG_CAM1_CLK_DIV:
+		case ADD_REG_CAM0_CLK_MUL:
+		case ADD_REG_CAM1_CLK_MUL:
+		case ADD_REG_CAM0_TRIG_DELAY:
+		case ADD_REG_CAM1_TRIG_DELAY:
+		case ADD_REG_CAM0_TRIG_WIDTH:
+		case ADD_REG_CAM1_TRIG_WIDTH:
+		case ADD_REG_CLK_DISCIPLINE:
+		case ADD_REG_CAM0_SEQ_LEN:
+		case ADD_REG_CAM1_SEQ_LEN:
+		case ADD_REG_CAM0_SEQ_REPEAT:
+		case ADD_REG_CAM1_SEQ_REPEAT:
+		case ADD_REG_SCHED_EN:
+		case ADD_REG_CAM0_SCHED_PERIOD:
+		case ADD_REG_CAM1_SCHED_PERIOD:
+		case ADD_REG_CAM0_MMODE_MAX_VEL:
+		case ADD_REG_CAM0_MMODE_ACCEL:
+		case ADD_REG_CAM1_MMODE_MAX_VEL:
+		case ADD_REG_CAM1_MMODE_ACCEL:
+		case ADD_REG_CAM0_MMODE_PROFILE:
+		case ADD_REG_CAM1_MMODE_PROFILE:
+		case ADD_REG_CAM0_MMODE_WP:
+		case ADD_REG_CAM1_MMODE_WP:
+		case ADD_REG_CAM0_MMODE_WP_LEN:
+		case ADD_REG_CAM1_MMODE_WP_LEN:
+		case ADD_REG_MOTORS_PLAY_IN0:
+		case ADD_REG_OUT_INVERT:
+		case ADD_REG_JITTER_MODE:
+		case ADD_REG_JITTER_THRESHOLD:		return true;
+		default:							return false;
 	}
 }
-void stop_camera1(void)
+
+/* Returns false if the write can't be staged or there's no room left */
+static bool config_stage_write(uint8_t add, uint8_t * content)
 {
-	if (TCD0_CTRLA != 0 && TCD0_CTRLB == 0)	// Running but not running PWM mode
-	{
-    	stop_cam1 = true;
-	}
+	uint8_t size = config_reg_size(add);
+	
+	if (!config_stage_check(add, content))
+		return false;
+	
+	if (config_stage_writes == CONFIG_STAGE_WRITES || config_stage_bytes + size > CONFIG_STAGE_BYTES)
+		return false;
+	
+	for (uint8_t i = 0; i < size; i++)
+		config_stage_data[config_stage_bytes + i] = content[i];
+	
+	config_stage_add[config_stage_writes++] = add;
+	config_stage_bytes += size;
+	
+	return true;
 }
 
-void enable_motor0(void)
+void config_discard(void)
+{
+	config_stage_writes = 0;
+	config_stage_bytes = 0;
+	config_commit_on_second = false;
+}
+
+void config_commit(void)
 {
-	if (TCC0_CTRLA == 0 || TCC0_CTRLB == 0)	// Not running or not in PWM mode
+	uint8_t rejected = 0;
+	uint8_t offset = 0;
+	
+	uint8_t sreg = SREG;
+	cli();
+	config_committing = true;
+	
+	for (uint8_t i = 0; i < config_stage_writes; i++)
 	{
-		timer_type0_pwm(&TCC0, TIMER_PRESCALER_DIV64, (app_regs.REG_CAM0_MMODE_PERIOD >> 1), (app_regs.REG_CAM0_MMODE_PULSE >> 1), INT_LEVEL_OFF, INT_LEVEL_OFF);
-		clr_CAM0_TRIG;
+		uint8_t add = config_stage_add[i];
+		
+		if (!((bool (*)(void*))pgm_read_word(&app_func_wr_pointer[add-APP_REGS_ADD_MIN]))(&config_stage_data[offset]))
+			rejected++;
+		
+		offset += config_reg_size(add);
 	}
+	
+	config_committing = false;
+	config_discard();
+	
+	app_write_REG_CAM0_MODE(&app_regs.REG_CAM0_MODE);
+	app_write_REG_CAM1_MODE(&app_regs.REG_CAM1_MODE);
+	SREG = sreg;
+	
+	app_regs.REG_CONFIG_COMMIT = rejected;
+	
+	if (app_regs.REG_EVT_EN & B_EVT_CONFIG)
+		core_func_send_event(ADD_REG_CONFIG_COMMIT, true);
 }
-void enable_motor1(void)
+
+/************************************************************************/
+/* ISR profiling                                                        */
+/************************************************************************/
+#ifdef ISR_PROFILING
+typedef struct
+{
+	uint32_t sum;
+	uint32_t count;
+	uint16_t min;
+	uint16_t max;
+	uint16_t bins[ISR_PROF_BINS];
+} isr_prof_t;
+
+isr_prof_t isr_prof[ISR_PROF_SLOTS];
+uint16_t isr_prof_t0[ISR_PROF_SLOTS];
+
+/* Called at the end of the ISRs, so the interrupts are disabled */
+void isr_prof_record(uint8_t slot)
 {
-	if (TCD0_CTRLA == 0 || TCD0_CTRLB == 0)	// Not running or not in PWM mode
+	uint16_t cycles = TCD1_CNT - isr_prof_t0[slot];
+	isr_prof_t * p = &isr_prof[slot];
+	
+	/* Halving keeps the mean once the sum gets too large */
+	if (p->sum > 0xF0000000)
 	{
-		timer_type0_pwm(&TCD0, TIMER_PRESCALER_DIV64, (app_regs.REG_CAM1_MMODE_PERIOD >> 1), (app_regs.REG_CAM1_MMODE_PULSE >> 1), INT_LEVEL_OFF, INT_LEVEL_OFF);
-		clr_CAM1_TRIG;
+		p->sum >>= 1;
+		p->count >>= 1;
 	}
+	
+	p->sum += cycles;
+	p->count++;
+	
+	if (cycles < p->min)
+		p->min = cycles;
+	if (cycles > p->max)
+		p->max = cycles;
+	
+	uint8_t bin = 0;
+	for (uint16_t t = cycles >> 5; t && bin < ISR_PROF_BINS - 1; t >>= 1)
+		bin++;
+	
+	if (p->bins[bin] != 0xFFFF)
+		p->bins[bin]++;
 }
-void disable_motor0(void)
+
+void isr_prof_reset(void)
 {
-	if (TCC0_CTRLA != 0 && TCC0_CTRLB != 0)	// Running PWM mode
+	uint8_t sreg = SREG;
+	cli();
+	for (uint8_t i = 0; i < ISR_PROF_SLOTS; i++)
 	{
-		timer_type0_stop(&TCC0);
+		isr_prof[i].sum = 0;
+		isr_prof[i].count = 0;
+		isr_prof[i].min = 0xFFFF;
+		isr_prof[i].max = 0;
+		for (uint8_t j = 0; j < ISR_PROF_BINS; j++)
+			isr_prof[i].bins[j] = 0;
 	}
+	SREG = sreg;
 }
-void disable_motor1(void)
+
+/* Copies the statistics of the slot with the interrupts disabled */
+void isr_prof_read(uint8_t slot, uint16_t * dest)
+{
+	uint8_t sreg = SREG;
+	cli();
+	isr_prof_t p = isr_prof[slot];
+	SREG = sreg;
+	
+	dest[0] = (p.count > 0xFFFF) ? 0xFFFF : p.count;
+	dest[1] = p.count ? p.min : 0;
+	dest[2] = p.max;
+	dest[3] = p.count ? p.sum / p.count : 0;
+	for (uint8_t j = 0; j < ISR_PROF_BINS; j++)
+		dest[4 + j] = p.bins[j];
+}
+#endif
+
+/************************************************************************/
+/* Stack usage                                                          */
+/************************************************************************/
+/* The RAM between the end of the variables and the top of the stack is */
+/* painted before the C runtime starts. The bytes still painted were    */
+/* never reached by the stack, so they give the headroom left after the */
+/* deepest nesting of ISRs seen since the reset.                        */
+#define STACK_PAINT 0xC5
+
+extern uint8_t _end;
+extern uint8_t __stack;
+
+void stack_paint(void) __attribute__ ((naked, used, section (".init1")));
+void stack_paint(void)
+{
+	__asm volatile (
+		"    ldi r30, lo8(_end)      \n"
+		"    ldi r31, hi8(_end)      \n"
+		"    ldi r24, %0             \n"
+		"    ldi r25, hi8(__stack)   \n"
+		"    rjmp 2f                 \n"
+		"1:  st Z+, r24              \n"
+		"2:  cpi r30, lo8(__stack)   \n"
+		"    cpc r31, r25            \n"
+		"    brlo 1b                 \n"
+		"    breq 1b                 \n"
+		: : "i" (STACK_PAINT));
+}
+
+uint16_t stack_free(void)
 {
-	if (TCD0_CTRLA != 0 && TCD0_CTRLB != 0)	// Running PWM mode
+	const uint8_t * p = &_end;
+	uint16_t count = 0;
+	
+	while (p <= &__stack && *p == STACK_PAINT)
 	{
-		timer_type0_stop(&TCD0);
+		p++;
+		count++;
 	}
+	
+	return count;
 }
 
-
 /************************************************************************/
 /* Initialization Callbacks                                             */
 /************************************************************************/
@@ -253,6 +2881,15 @@ void core_callback_initialize_hardware(void)
 	/* Initialize IOs */
 	/* Don't delete this function!!! */
 	init_ios();
+	
+#ifdef ISR_PROFILING
+	/* Free-running time base for the ISR profiling, shared with the clock discipline */
+	TCD1_CTRLA = 0;
+	TCD1_CNT = 0;
+	TCD1_PER = 0xFFFF;
+	TCD1_CTRLA = TIMER_PRESCALER_DIV1;
+	isr_prof_reset();
+#endif
 }
 
 void core_callback_reset_registers(void)
@@ -275,17 +2912,101 @@ void core_callback_reset_registers(void)
 	
 	app_regs.REG_CAM0_MODE = GM_CAM0_MODE_CAM;
 	app_regs.REG_CAM0_FREQ = 30;
+	camera0_freq = camera0_freq_host = 30;
 	app_regs.REG_CAM0_MMODE_PERIOD = 20000;
 	app_regs.REG_CAM0_MMODE_PULSE = 1500;
+	app_regs.REG_CAM0_MMODE_PULSE_FINE = 1500 * 8;
 	app_regs.REG_CAM1_MODE = GM_CAM1_MODE_CAM;
 	app_regs.REG_CAM1_FREQ = 30;
+	camera1_freq = camera1_freq_host = 30;
 	app_regs.REG_CAM1_MMODE_PERIOD = 20000;
 	app_regs.REG_CAM1_MMODE_PULSE = 1500;
+	app_regs.REG_CAM1_MMODE_PULSE_FINE = 1500 * 8;
 	
 	app_regs.REG_RESERVED2 = 0;
 	app_regs.REG_RESERVED3 = 0;
 	
-	app_regs.REG_EVT_EN = B_EVT_CAMS | B_EVT_IN0;
+	app_regs.REG_EVT_EN = B_EVT_CAMS | B_EVT_IN0 | B_EVT_SCHED | B_EVT_MOTORS | B_EVT_UNDERRUN | B_EVT_CHANNELS | B_EVT_CONFIG | B_EVT_JITTER;
+	
+	app_regs.REG_CAM0_CLK_DIV = 1;
+	app_regs.REG_CAM0_CLK_MUL = 1;
+	app_regs.REG_CAM0_TRIG_DELAY = EXT_CLOCK_MIN_DELAY_US;
+	app_regs.REG_CAM0_TRIG_WIDTH = 500;
+	app_regs.REG_CAM1_CLK_DIV = 1;
+	app_regs.REG_CAM1_CLK_MUL = 1;
+	app_regs.REG_CAM1_TRIG_DELAY = EXT_CLOCK_MIN_DELAY_US;
+	app_regs.REG_CAM1_TRIG_WIDTH = 500;
+	
+	app_regs.REG_CLK_DISCIPLINE = GM_CLK_DISCIPLINE_OFF;
+	app_regs.REG_CLK_DRIFT[0] = 0;
+	app_regs.REG_CLK_DRIFT[1] = 0;
+	app_regs.REG_CLK_DRIFT[2] = 0;
+	app_regs.REG_CLK_DRIFT[3] = 0;
+	
+	for (uint8_t i = 0; i < SEQ_MAX_LEN; i++)
+	{
+		app_regs.REG_CAM0_SEQ[i] = 10000;
+		app_regs.REG_CAM1_SEQ[i] = 10000;
+	}
+	app_regs.REG_CAM0_SEQ_LEN = 1;
+	app_regs.REG_CAM0_SEQ_REPEAT = 0;
+	app_regs.REG_CAM1_SEQ_LEN = 1;
+	app_regs.REG_CAM1_SEQ_REPEAT = 0;
+	
+	app_regs.REG_CAM0_MMODE_TARGET = 1500;
+	app_regs.REG_CAM0_MMODE_MAX_VEL = 0;
+	app_regs.REG_CAM0_MMODE_ACCEL = 0;
+	app_regs.REG_CAM0_MMODE_PROFILE = GM_MMODE_PROFILE_TRAPEZOIDAL;
+	app_regs.REG_CAM1_MMODE_TARGET = 1500;
+	app_regs.REG_CAM1_MMODE_MAX_VEL = 0;
+	app_regs.REG_CAM1_MMODE_ACCEL = 0;
+	app_regs.REG_CAM1_MMODE_PROFILE = GM_MMODE_PROFILE_TRAPEZOIDAL;
+	app_regs.REG_MOTORS_MOVING = 0;
+	
+	for (uint8_t i = 0; i < TRAJ_MAX_WAYPOINTS * 2; i++)
+	{
+		app_regs.REG_CAM0_MMODE_WP[i] = (i & 1) ? 1500 : 0;
+		app_regs.REG_CAM1_MMODE_WP[i] = (i & 1) ? 1500 : 0;
+	}
+	app_regs.REG_CAM0_MMODE_WP_LEN = 1;
+	app_regs.REG_CAM1_MMODE_WP_LEN = 1;
+	app_regs.REG_MOTORS_PLAY = 0;
+	app_regs.REG_MOTORS_PLAY_IN0 = 0;
+	app_regs.REG_MOTORS_UNDERRUN[0] = 0;
+	app_regs.REG_MOTORS_UNDERRUN[1] = 0;
+	app_regs.REG_MOTORS_ALIGN = 0;
+	app_regs.REG_SOFT_TRIG = 0;
+	app_regs.REG_CONFIG_STAGE = 0;
+	app_regs.REG_CONFIG_COMMIT = 0;
+	config_discard();
+	app_regs.REG_OUT_INVERT = 0;
+	app_regs.REG_JITTER_MODE = GM_JITTER_OFF;
+	app_regs.REG_JITTER_THRESHOLD = 1000;
+	for (uint8_t i = 0; i < 6; i++)
+		app_regs.REG_JITTER_STATS[i] = 0;
+	app_regs.REG_ISR_PROF_RESET = 0;
+	app_regs.REG_ISR_PROF_SLOT = 0;
+	for (uint8_t i = 0; i < ISR_PROF_SLOT_SIZE; i++)
+		app_regs_shared.REG_ISR_PROF[i] = 0;
+#ifdef ISR_PROFILING
+	isr_prof_reset();
+#endif
+	
+	for (uint8_t i = 0; i < 5; i++)
+		app_regs.REG_TIMER_OWNERS[i] = GM_TIMER_OWNER_FREE;
+	app_regs.REG_TIMER_OWNERS[TIMER_TCC1] = GM_TIMER_OWNER_CORE;
+	app_regs.REG_CHANNEL_STATE[0] = GM_CHANNEL_IDLE;
+	app_regs.REG_CHANNEL_STATE[1] = GM_CHANNEL_IDLE;
+	
+	app_regs.REG_SCHED_EN = 0;
+	app_regs.REG_SCHED_WINDOWS = 0;
+	app_regs.REG_CAM0_SCHED_PERIOD = 3600;
+	app_regs.REG_CAM1_SCHED_PERIOD = 3600;
+	for (uint8_t i = 0; i < SCHED_N_ENTRIES * 3; i++)
+	{
+		app_regs.REG_CAM0_SCHED[i] = 0;
+		app_regs.REG_CAM1_SCHED[i] = 0;
+	}
 }
 
 void core_callback_registers_were_reinitialized(void)
@@ -298,11 +3019,38 @@ void core_callback_registers_were_reinitialized(void)
 	app_regs.REG_SET_OUTPUTS = 0;
 	app_regs.REG_CLR_OUTPUTS = 0;
 	
-	/* Update outputs */
+	/* Update outputs, with the stored polarity */
+	app_write_REG_OUT_INVERT(&app_regs.REG_OUT_INVERT);
 	app_write_REG_OUTPUTS(&app_regs.REG_OUTPUTS);
     
     /* Update modes */
     app_write_REG_IN0_MODE(&app_regs.REG_IN0_MODE);
+	
+	/* Windows are opened again by the schedule */
+	app_regs.REG_SCHED_WINDOWS = 0;
+	app_regs.REG_MOTORS_MOVING = 0;
+	app_regs.REG_MOTORS_PLAY = 0;
+	app_regs.REG_MOTORS_ALIGN = 0;
+	app_regs.REG_SOFT_TRIG = 0;
+	app_regs.REG_CONFIG_STAGE = 0;
+	app_regs.REG_CONFIG_COMMIT = 0;
+	config_discard();
+	
+	jitter_stop();
+	
+	/* No timer or line is running yet */
+	for (uint8_t i = 0; i < 5; i++)
+		app_regs.REG_TIMER_OWNERS[i] = GM_TIMER_OWNER_FREE;
+	app_regs.REG_TIMER_OWNERS[TIMER_TCC1] = GM_TIMER_OWNER_CORE;
+	app_regs.REG_CHANNEL_STATE[0] = GM_CHANNEL_IDLE;
+	app_regs.REG_CHANNEL_STATE[1] = GM_CHANNEL_IDLE;
+	
+	/* Restart the trigger jitter measurement if enabled */
+	app_write_REG_JITTER_MODE(&app_regs.REG_JITTER_MODE);
+	
+	/* Restart the clock discipline if enabled */
+	if (app_regs.REG_CLK_DISCIPLINE == GM_CLK_DISCIPLINE_HARP)
+		clock_discipline_start();
 }
 
 /************************************************************************/
@@ -334,7 +3082,7 @@ void core_callback_t_before_exec(void)
 {
 	if (++_2000ms_counter == 2000)
 	{
-		if ((TCC0_CTRLA != 0) && (TCC0_CTRLB == 0))
+		if (channel_is_camera(0))
 		{
 			if (++camera0_sync_sec_counter == app_regs.REG_SYNC_INTERVAL)
 			{
@@ -349,7 +3097,7 @@ void core_callback_t_before_exec(void)
 			}
 		}
 
-		if ((TCD0_CTRLA != 0) && (TCD0_CTRLB == 0))
+		if (channel_is_camera(1))
 		{
 			if (++camera1_sync_sec_counter == app_regs.REG_SYNC_INTERVAL)
 			{
@@ -366,7 +3114,22 @@ void core_callback_t_before_exec(void)
 	}
 }
 void core_callback_t_after_exec(void) {}
-void core_callback_t_new_second(void) { _2000ms_counter = 0; }
+void core_callback_t_new_second(void)
+{
+	_2000ms_counter = 0;
+	
+	if (clock_discipline_on)
+		clock_discipline_new_second();
+	
+	if (app_regs.REG_SCHED_EN || app_regs.REG_SCHED_WINDOWS)
+		sched_update(core_func_read_R_TIMESTAMP_SECOND());
+	
+	if (config_commit_on_second)
+		config_commit();
+	
+	if (app_regs.REG_TIMER_OWNERS[TIMER_TCE0] == GM_TIMER_OWNER_JITTER)
+		jitter_new_second();
+}
 void core_callback_t_500us(void) {}
 void core_callback_t_1ms(void) {}
 
@@ -402,7 +3165,7 @@ bool core_read_app_register(uint8_t add, uint8_t type)
 		return false;
 	
 	/* Receive data */
-	(*app_func_rd_pointer[add-APP_REGS_ADD_MIN])();	
+	((void (*)(void))pgm_read_word(&app_func_rd_pointer[add-APP_REGS_ADD_MIN]))();
 
 	/* Return success */
 	return true;
@@ -411,6 +3174,35 @@ bool core_read_app_register(uint8_t add, uint8_t type)
 /************************************************************************/
 /* Callbacks: Write app register                                        */
 /************************************************************************/
+/* Every element must fit the mask and range given in device.yml */
+static bool app_regs_check_values(uint8_t add, uint8_t * content, uint16_t n_elements)
+{
+	const AppRegsCheck * check = &app_regs_check[add-APP_REGS_ADD_MIN];
+	uint32_t mask = pgm_read_dword(&check->mask);
+	uint32_t min = pgm_read_dword(&check->min);
+	uint32_t max = pgm_read_dword(&check->max);
+	uint8_t size = app_regs_type[add-APP_REGS_ADD_MIN] & MSK_TYPE_LEN;
+	
+	for (uint16_t i = 0; i < n_elements; i++)
+	{
+		uint32_t value;
+		
+		if (size == 1)
+			value = content[i];
+		else if (size == 2)
+			value = ((uint16_t*)content)[i];
+		else if (size == 4)
+			value = ((uint32_t*)content)[i];
+		else
+			return true;
+		
+		if ((value & ~mask) || value < min || value > max)
+			return false;
+	}
+	
+	return true;
+}
+
 bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint16_t n_elements)
 {
 	/* Check if it will not access forbidden memory */
@@ -425,6 +3217,14 @@ bool core_write_app_register(uint8_t add, uint8_t type, uint8_t * content, uint1
 	if (app_regs_n_elements[add-APP_REGS_ADD_MIN] != n_elements)
 		return false;
 
+	/* Check the values against device.yml */
+	if (!app_regs_check_values(add, content, n_elements))
+		return false;
+
+	/* Staged writes are applied by the commit */
+	if (app_regs.REG_CONFIG_STAGE && add != ADD_REG_CONFIG_STAGE && add != ADD_REG_CONFIG_COMMIT)
+		return config_stage_write(add, content);
+
 	/* Process data and return false if write is not allowed or contains errors */
-	return (*app_func_wr_pointer[add-APP_REGS_ADD_MIN])(content);
+	return ((bool (*)(void*))pgm_read_word(&app_func_wr_pointer[add-APP_REGS_ADD_MIN]))(content);
 }
\ No newline at end of file
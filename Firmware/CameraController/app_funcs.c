@@ -1,86 +1,85 @@
 #include "app_funcs.h"
 #include "app_ios_and_regs.h"
+#include "app_regs_tables.h"
 #include "hwbp_core.h"
 
 #define F_CPU 32000000
 #include <util/delay.h>
+#include <avr/pgmspace.h>
 
 
 /************************************************************************/
 /* Create pointers to functions                                         */
 /************************************************************************/
+/* Kept in flash and read with pgm_read_word, they are only used here.  */
+/* The lists are generated from device.yml, see app_regs_tables.h.      */
 extern AppRegs app_regs;
+extern AppRegsShared app_regs_shared;
 
-void (*app_func_rd_pointer[])(void) = {
-	&app_read_REG_START_CAMS,
-	&app_read_REG_STOP_CAMS,
-	&app_read_REG_ENABLE_MOTORS,
-	&app_read_REG_DISABLE_MOTORS,
-	&app_read_REG_SET_OUTPUTS,
-	&app_read_REG_CLR_OUTPUTS,
-	&app_read_REG_OUTPUTS,
-	&app_read_REG_INPUT0,
-	&app_read_REG_CAM0,
-	&app_read_REG_CAM1,
-	&app_read_REG_SYNC0,
-	&app_read_REG_SYNC1,
-	&app_read_REG_MOTORS_STATE,
-	&app_read_REG_RESERVED0,
-	&app_read_REG_SYNC_INTERVAL,
-	&app_read_REG_RESERVED1,
-	&app_read_REG_IN0_MODE,
-	&app_read_REG_CAM0_MODE,
-	&app_read_REG_CAM0_FREQ,
-	&app_read_REG_CAM0_MMODE_PERIOD,
-	&app_read_REG_CAM0_MMODE_PULSE,
-	&app_read_REG_CAM1_MODE,
-	&app_read_REG_CAM1_FREQ,
-	&app_read_REG_CAM1_MMODE_PERIOD,
-	&app_read_REG_CAM1_MMODE_PULSE,
-	&app_read_REG_RESERVED2,
-	&app_read_REG_RESERVED3,
-	&app_read_REG_EVT_EN
+void (* const app_func_rd_pointer[])(void) PROGMEM = {
+	YML_REGS_RD_FUNCS
 };
 
-bool (*app_func_wr_pointer[])(void*) = {
-	&app_write_REG_START_CAMS,
-	&app_write_REG_STOP_CAMS,
-	&app_write_REG_ENABLE_MOTORS,
-	&app_write_REG_DISABLE_MOTORS,
-	&app_write_REG_SET_OUTPUTS,
-	&app_write_REG_CLR_OUTPUTS,
-	&app_write_REG_OUTPUTS,
-	&app_write_REG_INPUT0,
-	&app_write_REG_CAM0,
-	&app_write_REG_CAM1,
-	&app_write_REG_SYNC0,
-	&app_write_REG_SYNC1,
-	&app_write_REG_MOTORS_STATE,
-	&app_write_REG_RESERVED0,
-	&app_write_REG_SYNC_INTERVAL,
-	&app_write_REG_RESERVED1,
-	&app_write_REG_IN0_MODE,
-	&app_write_REG_CAM0_MODE,
-	&app_write_REG_CAM0_FREQ,
-	&app_write_REG_CAM0_MMODE_PERIOD,
-	&app_write_REG_CAM0_MMODE_PULSE,
-	&app_write_REG_CAM1_MODE,
-	&app_write_REG_CAM1_FREQ,
-	&app_write_REG_CAM1_MMODE_PERIOD,
-	&app_write_REG_CAM1_MMODE_PULSE,
-	&app_write_REG_RESERVED2,
-	&app_write_REG_RESERVED3,
-	&app_write_REG_EVT_EN
+_Static_assert(sizeof(app_func_rd_pointer) / sizeof(app_func_rd_pointer[0]) == APP_REGS_ADD_MAX - APP_REGS_ADD_MIN + 1, "Missing read functions");
+
+bool (* const app_func_wr_pointer[])(void*) PROGMEM = {
+	YML_REGS_WR_FUNCS
 };
 
-extern void start_camera0(void);
-extern void start_camera1(void);
+_Static_assert(sizeof(app_func_wr_pointer) / sizeof(app_func_wr_pointer[0]) == APP_REGS_ADD_MAX - APP_REGS_ADD_MIN + 1, "Missing write functions");
+
+extern void start_camera0(uint16_t freq);
+extern void start_camera1(uint16_t freq);
+extern uint16_t camera0_freq, camera1_freq;
+extern uint16_t camera0_freq_host, camera1_freq_host;
 extern void stop_camera0(void);
 extern void stop_camera1(void);
 extern void enable_motor0(void);
 extern void enable_motor1(void);
 extern void disable_motor0(void);
 extern void disable_motor1(void);
+extern void start_camera0_ext(void);
+extern void start_camera1_ext(void);
+extern void clock_discipline_start(void);
+extern void clock_discipline_stop(void);
+extern void start_camera0_seq(void);
+extern void start_camera1_seq(void);
+extern void seq_stop_camera0(void);
+extern void seq_stop_camera1(void);
+extern bool camera0_seq_running;
+extern bool camera1_seq_running;
+extern void sched_close_camera0(void);
+extern void sched_close_camera1(void);
+extern void servo_motion_move_motor0(void);
+extern void servo_motion_move_motor1(void);
+extern void servo_motion_cancel_motor0(void);
+extern void servo_motion_cancel_motor1(void);
+extern void servo_set_pulse_motor0(uint32_t eighths);
+extern void servo_set_pulse_motor1(uint32_t eighths);
+extern void servo_set_period_motor0(void);
+extern void servo_set_period_motor1(void);
+extern void servo_trajectory_play_motor0(void);
+extern void servo_trajectory_play_motor1(void);
+extern bool servo_fifo_write_motor0(uint16_t * setpoints);
+extern bool servo_fifo_write_motor1(uint16_t * setpoints);
+extern void servo_align(uint8_t motors);
+extern bool channel_is_camera(uint8_t channel);
+extern bool servo_trajectory_playing(uint8_t motor);
+extern bool servo_trajectory_queued(uint8_t motor);
+extern bool soft_trigger(uint8_t cameras);
+extern bool config_committing;
+extern void config_commit(void);
+extern void config_discard(void);
+extern bool config_commit_on_second;
+extern uint32_t camera0_triggers;
+extern uint32_t camera1_triggers;
+extern bool jitter_start(void);
+extern uint16_t stack_free(void);
+extern void jitter_stop(void);
+#ifdef ISR_PROFILING
+extern void isr_prof_reset(void);
+extern void isr_prof_read(uint8_t slot, uint16_t * dest);
+#endif
 
 /************************************************************************/
 /* REG_START_CAMS                                                       */
@@ -90,20 +89,42 @@ bool app_write_REG_START_CAMS(void *a)
 {
 	if (*((uint8_t*)a) & B_START_CAM0)
 	{
-        clr_CAM0_TRIG;
-        _delay_us(16);      // Measured, gives around 55us before the the first trigger pulse
-                
-		start_camera0();
-		app_regs.REG_CAM0_MODE = GM_CAM0_MODE_CAM;
+		if (app_regs.REG_CAM0_MODE == GM_CAM0_MODE_SEQUENCE)
+		{
+			start_camera0_seq();
+		}
+		else if (app_regs.REG_CAM0_MODE == GM_CAM0_MODE_EXT_CLK || app_regs.REG_CAM0_MODE == GM_CAM0_MODE_ONE_SHOT)
+		{
+			start_camera0_ext();
+		}
+		else
+		{
+			clr_CAM0_TRIG;
+			_delay_us(16);      // Measured, gives around 55us before the the first trigger pulse
+			
+			start_camera0(camera0_freq_host);
+			app_regs.REG_CAM0_MODE = GM_CAM0_MODE_CAM;
+		}
 	}
 
 	if (*((uint8_t*)a) & B_START_CAM1)
 	{
-        clr_CAM1_TRIG;
-        _delay_us(16);      // Measured, gives around 55us before the the first trigger pulse
-
-		start_camera1();
-		app_regs.REG_CAM1_MODE = GM_CAM1_MODE_CAM;
+		if (app_regs.REG_CAM1_MODE == GM_CAM1_MODE_SEQUENCE)
+		{
+			start_camera1_seq();
+		}
+		else if (app_regs.REG_CAM1_MODE == GM_CAM1_MODE_EXT_CLK || app_regs.REG_CAM1_MODE == GM_CAM1_MODE_ONE_SHOT)
+		{
+			start_camera1_ext();
+		}
+		else
+		{
+			clr_CAM1_TRIG;
+			_delay_us(16);      // Measured, gives around 55us before the the first trigger pulse
+			
+			start_camera1(camera1_freq_host);
+			app_regs.REG_CAM1_MODE = GM_CAM1_MODE_CAM;
+		}
 	}
 
 	return true;
@@ -256,7 +277,7 @@ bool app_write_REG_INPUT0(void *a) { return false; }
 /************************************************************************/
 void app_read_REG_CAM0(void)
 {
-	app_regs.REG_CAM0 = ((TCC0_CTRLA != 0) && (TCC0_CTRLB == 0)) ? B_CAM0 : 0;
+	app_regs.REG_CAM0 = channel_is_camera(0) ? B_CAM0 : 0;
 }
 bool app_write_REG_CAM0(void *a) { return false; }
 
@@ -266,7 +287,7 @@ bool app_write_REG_CAM0(void *a) { return false; }
 /************************************************************************/
 void app_read_REG_CAM1(void)
 {
-	app_regs.REG_CAM1 = ((TCD0_CTRLA != 0) && (TCD0_CTRLB == 0)) ? B_CAM1 : 0;
+	app_regs.REG_CAM1 = channel_is_camera(1) ? B_CAM1 : 0;
 }
 bool app_write_REG_CAM1(void *a) { return false; }
 
@@ -296,8 +317,8 @@ bool app_write_REG_SYNC1(void *a) { return false; }
 /************************************************************************/
 void app_read_REG_MOTORS_STATE(void)
 {
-	app_regs.REG_MOTORS_STATE = ((TCC0_CTRLA != 0) && (TCC0_CTRLB != 0)) ? B_MOTOR0 : 0;
-	app_regs.REG_MOTORS_STATE |= ((TCD0_CTRLA != 0) && (TCD0_CTRLB != 0)) ? B_MOTOR1 : 0;
+	app_regs.REG_MOTORS_STATE = (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_SERVO) ? B_MOTOR0 : 0;
+	app_regs.REG_MOTORS_STATE |= (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_SERVO) ? B_MOTOR1 : 0;
 }
 bool app_write_REG_MOTORS_STATE(void *a) { return false; }
 
@@ -350,6 +371,10 @@ bool app_write_REG_IN0_MODE(void *a)
 		return false;
 
 	app_regs.REG_IN0_MODE = reg;
+	
+	/* The motors are updated once the commit completes */
+	if (config_committing)
+		return true;
     
     if ((app_regs.REG_IN0_MODE == GM_IN0_H_CAM0) || (app_regs.REG_IN0_MODE == GM_IN0_L_CAM0) || (app_regs.REG_IN0_MODE == GM_IN0_NOT_USED))
     {
@@ -379,10 +404,17 @@ bool app_write_REG_CAM0_MODE(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
 
-	if (reg & ~MSK_CAM0_MODE)
+	if ((reg & ~MSK_CAM0_MODE) || reg > GM_CAM0_MODE_SEQUENCE)
 		return false;
 
 	app_regs.REG_CAM0_MODE = reg;
+	
+	/* The lines are updated once the commit completes */
+	if (config_committing)
+		return true;
+	
+	if (app_regs.REG_CAM0_MODE != GM_CAM0_MODE_SEQUENCE && camera0_seq_running)
+		seq_stop_camera0();
     
     if (app_regs.REG_CAM0_MODE == GM_CAM0_MODE_MOTOR)
     {
@@ -403,13 +435,20 @@ bool app_write_REG_CAM0_MODE(void *a)
 /************************************************************************/
 /* REG_CAM0_FREQ                                                        */
 /************************************************************************/
-void app_read_REG_CAM0_FREQ(void) {}
+void app_read_REG_CAM0_FREQ(void)
+{
+	if (app_regs.REG_CAM0_MODE == GM_CAM0_MODE_CAM && channel_is_camera(0))
+		app_regs.REG_CAM0_FREQ = camera0_freq;
+	else
+		app_regs.REG_CAM0_FREQ = camera0_freq_host;
+}
 bool app_write_REG_CAM0_FREQ(void *a)
 {
-	if (*((uint16_t*)a) < 2 || *((uint16_t*)a) > 1000)
+	if (*((uint16_t*)a) < CAMERA0_FREQUENCY_MIN || *((uint16_t*)a) > CAMERA0_FREQUENCY_MAX)
 		return false;
 	
-	app_regs.REG_CAM0_FREQ = *((uint16_t*)a);
+	camera0_freq_host = *((uint16_t*)a);
+	app_read_REG_CAM0_FREQ();
 	return true;
 }
 
@@ -424,10 +463,7 @@ bool app_write_REG_CAM0_MMODE_PERIOD(void *a)
 		return false;
 	
 	app_regs.REG_CAM0_MMODE_PERIOD = *((uint16_t*)a);
-	if (TCC0_CTRLA != 0 && TCC0_CTRLB != 0)
-	{
-		TCC0_PER = (app_regs.REG_CAM0_MMODE_PERIOD >> 1) - 1;
-	}
+	servo_set_period_motor0();
 
 	return true;
 }
@@ -442,8 +478,8 @@ bool app_write_REG_CAM0_MMODE_PULSE(void *a)
 	if (*((uint16_t*)a) < 1)
 		return false;
 	
-	app_regs.REG_CAM0_MMODE_PULSE = *((uint16_t*)a);
-	TCC0_CCA = (app_regs.REG_CAM0_MMODE_PULSE >> 1) - 1;
+	servo_motion_cancel_motor0();
+	servo_set_pulse_motor0((uint32_t)*((uint16_t*)a) << 3);
 
 	return true;
 }
@@ -457,11 +493,18 @@ bool app_write_REG_CAM1_MODE(void *a)
 {
 	uint8_t reg = *((uint8_t*)a);
 
-	if (reg & ~MSK_CAM1_MODE)
+	if ((reg & ~MSK_CAM1_MODE) || reg > GM_CAM1_MODE_SEQUENCE)
 		return false;
 
 	app_regs.REG_CAM1_MODE = reg;
 	
+	/* The lines are updated once the commit completes */
+	if (config_committing)
+		return true;
+	
+	if (app_regs.REG_CAM1_MODE != GM_CAM1_MODE_SEQUENCE && camera1_seq_running)
+		seq_stop_camera1();
+	
 	if (app_regs.REG_CAM1_MODE == GM_CAM1_MODE_MOTOR)
 	{
     	if ((app_regs.REG_IN0_MODE == GM_IN0_H_CAM0) || (app_regs.REG_IN0_MODE == GM_IN0_L_CAM0) || (app_regs.REG_IN0_MODE == GM_IN0_NOT_USED))
@@ -481,13 +524,20 @@ bool app_write_REG_CAM1_MODE(void *a)
 /************************************************************************/
 /* REG_CAM1_FREQ                                                        */
 /************************************************************************/
-void app_read_REG_CAM1_FREQ(void) {}
+void app_read_REG_CAM1_FREQ(void)
+{
+	if (app_regs.REG_CAM1_MODE == GM_CAM1_MODE_CAM && channel_is_camera(1))
+		app_regs.REG_CAM1_FREQ = camera1_freq;
+	else
+		app_regs.REG_CAM1_FREQ = camera1_freq_host;
+}
 bool app_write_REG_CAM1_FREQ(void *a)
 {
-	if (*((uint16_t*)a) < 2 || *((uint16_t*)a) > 1000)
+	if (*((uint16_t*)a) < CAMERA1_FREQUENCY_MIN || *((uint16_t*)a) > CAMERA1_FREQUENCY_MAX)
 		return false;
 	
-	app_regs.REG_CAM1_FREQ = *((uint16_t*)a);
+	camera1_freq_host = *((uint16_t*)a);
+	app_read_REG_CAM1_FREQ();
 	return true;
 }
 
@@ -502,10 +552,7 @@ bool app_write_REG_CAM1_MMODE_PERIOD(void *a)
 		return false;
 
 	app_regs.REG_CAM1_MMODE_PERIOD = *((uint16_t*)a);
-	if (TCD0_CTRLA != 0 && TCD0_CTRLB != 0)
-	{
-		TCD0_PER = (app_regs.REG_CAM1_MMODE_PERIOD >> 1) - 1;
-	}
+	servo_set_period_motor1();
 
 	return true;
 }
@@ -520,8 +567,8 @@ bool app_write_REG_CAM1_MMODE_PULSE(void *a)
 	if (*((uint16_t*)a) < 1)
 		return false;
 	
-	app_regs.REG_CAM1_MMODE_PULSE = *((uint16_t*)a);
-	TCD0_CCA = (app_regs.REG_CAM1_MMODE_PULSE >> 1) - 1;
+	servo_motion_cancel_motor1();
+	servo_set_pulse_motor1((uint32_t)*((uint16_t*)a) << 3);
 
 	return true;
 }
@@ -557,4 +604,899 @@ bool app_write_REG_EVT_EN(void *a)
 {
 	app_regs.REG_EVT_EN = *((uint8_t*)a);
 	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_CLK_DIV                                                     */
+/************************************************************************/
+void app_read_REG_CAM0_CLK_DIV(void) {}
+bool app_write_REG_CAM0_CLK_DIV(void *a)
+{
+	if (*((uint8_t*)a) < CAMERA0_CLOCK_DIVIDER_MIN)
+		return false;
+
+	app_regs.REG_CAM0_CLK_DIV = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_CLK_MUL                                                     */
+/************************************************************************/
+void app_read_REG_CAM0_CLK_MUL(void) {}
+bool app_write_REG_CAM0_CLK_MUL(void *a)
+{
+	if (*((uint8_t*)a) < CAMERA0_CLOCK_MULTIPLIER_MIN || *((uint8_t*)a) > CAMERA0_CLOCK_MULTIPLIER_MAX)
+		return false;
+
+	app_regs.REG_CAM0_CLK_MUL = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_TRIG_DELAY                                                  */
+/************************************************************************/
+void app_read_REG_CAM0_TRIG_DELAY(void) {}
+bool app_write_REG_CAM0_TRIG_DELAY(void *a)
+{
+	if (*((uint16_t*)a) < CAMERA0_TRIGGER_DELAY_MIN)
+		return false;
+
+	app_regs.REG_CAM0_TRIG_DELAY = *((uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_TRIG_WIDTH                                                  */
+/************************************************************************/
+void app_read_REG_CAM0_TRIG_WIDTH(void) {}
+bool app_write_REG_CAM0_TRIG_WIDTH(void *a)
+{
+	if (*((uint16_t*)a) < CAMERA0_TRIGGER_WIDTH_MIN)
+		return false;
+
+	app_regs.REG_CAM0_TRIG_WIDTH = *((uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_CLK_DIV                                                     */
+/************************************************************************/
+void app_read_REG_CAM1_CLK_DIV(void) {}
+bool app_write_REG_CAM1_CLK_DIV(void *a)
+{
+	if (*((uint8_t*)a) < CAMERA1_CLOCK_DIVIDER_MIN)
+		return false;
+
+	app_regs.REG_CAM1_CLK_DIV = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_CLK_MUL                                                     */
+/************************************************************************/
+void app_read_REG_CAM1_CLK_MUL(void) {}
+bool app_write_REG_CAM1_CLK_MUL(void *a)
+{
+	if (*((uint8_t*)a) < CAMERA1_CLOCK_MULTIPLIER_MIN || *((uint8_t*)a) > CAMERA1_CLOCK_MULTIPLIER_MAX)
+		return false;
+
+	app_regs.REG_CAM1_CLK_MUL = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_TRIG_DELAY                                                  */
+/************************************************************************/
+void app_read_REG_CAM1_TRIG_DELAY(void) {}
+bool app_write_REG_CAM1_TRIG_DELAY(void *a)
+{
+	if (*((uint16_t*)a) < CAMERA1_TRIGGER_DELAY_MIN)
+		return false;
+
+	app_regs.REG_CAM1_TRIG_DELAY = *((uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_TRIG_WIDTH                                                  */
+/************************************************************************/
+void app_read_REG_CAM1_TRIG_WIDTH(void) {}
+bool app_write_REG_CAM1_TRIG_WIDTH(void *a)
+{
+	if (*((uint16_t*)a) < CAMERA1_TRIGGER_WIDTH_MIN)
+		return false;
+
+	app_regs.REG_CAM1_TRIG_WIDTH = *((uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CLK_DISCIPLINE                                                   */
+/************************************************************************/
+void app_read_REG_CLK_DISCIPLINE(void) {}
+bool app_write_REG_CLK_DISCIPLINE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~MSK_CLK_DISCIPLINE)
+		return false;
+	
+	if (reg == GM_CLK_DISCIPLINE_HARP && app_regs.REG_CLK_DISCIPLINE != GM_CLK_DISCIPLINE_HARP)
+		clock_discipline_start();
+	
+	if (reg == GM_CLK_DISCIPLINE_OFF && app_regs.REG_CLK_DISCIPLINE != GM_CLK_DISCIPLINE_OFF)
+		clock_discipline_stop();
+
+	app_regs.REG_CLK_DISCIPLINE = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CLK_DRIFT                                                        */
+/************************************************************************/
+void app_read_REG_CLK_DRIFT(void) {}
+bool app_write_REG_CLK_DRIFT(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_CAM0_SEQ                                                         */
+/************************************************************************/
+void app_read_REG_CAM0_SEQ(void) {}
+bool app_write_REG_CAM0_SEQ(void *a)
+{
+	uint16_t * reg = ((uint16_t*)a);
+	
+	for (uint8_t i = 0; i < 16; i++)
+		if (reg[i] < 1000)
+			return false;
+
+	for (uint8_t i = 0; i < 16; i++)
+		app_regs.REG_CAM0_SEQ[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_SEQ_LEN                                                     */
+/************************************************************************/
+void app_read_REG_CAM0_SEQ_LEN(void) {}
+bool app_write_REG_CAM0_SEQ_LEN(void *a)
+{
+	if (*((uint8_t*)a) < CAMERA0_SEQUENCE_LENGTH_MIN || *((uint8_t*)a) > CAMERA0_SEQUENCE_LENGTH_MAX)
+		return false;
+
+	app_regs.REG_CAM0_SEQ_LEN = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_SEQ_REPEAT                                                  */
+/************************************************************************/
+void app_read_REG_CAM0_SEQ_REPEAT(void) {}
+bool app_write_REG_CAM0_SEQ_REPEAT(void *a)
+{
+	app_regs.REG_CAM0_SEQ_REPEAT = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_SEQ                                                         */
+/************************************************************************/
+void app_read_REG_CAM1_SEQ(void) {}
+bool app_write_REG_CAM1_SEQ(void *a)
+{
+	uint16_t * reg = ((uint16_t*)a);
+	
+	for (uint8_t i = 0; i < 16; i++)
+		if (reg[i] < 1000)
+			return false;
+
+	for (uint8_t i = 0; i < 16; i++)
+		app_regs.REG_CAM1_SEQ[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_SEQ_LEN                                                     */
+/************************************************************************/
+void app_read_REG_CAM1_SEQ_LEN(void) {}
+bool app_write_REG_CAM1_SEQ_LEN(void *a)
+{
+	if (*((uint8_t*)a) < CAMERA1_SEQUENCE_LENGTH_MIN || *((uint8_t*)a) > CAMERA1_SEQUENCE_LENGTH_MAX)
+		return false;
+
+	app_regs.REG_CAM1_SEQ_LEN = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_SEQ_REPEAT                                                  */
+/************************************************************************/
+void app_read_REG_CAM1_SEQ_REPEAT(void) {}
+bool app_write_REG_CAM1_SEQ_REPEAT(void *a)
+{
+	app_regs.REG_CAM1_SEQ_REPEAT = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SCHED_EN                                                         */
+/************************************************************************/
+void app_read_REG_SCHED_EN(void) {}
+bool app_write_REG_SCHED_EN(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(B_SCHED_CAM0 | B_SCHED_CAM1))
+		return false;
+	
+	if (!(reg & B_SCHED_CAM0))
+		sched_close_camera0();
+	if (!(reg & B_SCHED_CAM1))
+		sched_close_camera1();
+
+	app_regs.REG_SCHED_EN = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SCHED_WINDOWS                                                    */
+/************************************************************************/
+void app_read_REG_SCHED_WINDOWS(void) {}
+bool app_write_REG_SCHED_WINDOWS(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_CAM0_SCHED_PERIOD                                                */
+/************************************************************************/
+void app_read_REG_CAM0_SCHED_PERIOD(void) {}
+bool app_write_REG_CAM0_SCHED_PERIOD(void *a)
+{
+	if (*((uint32_t*)a) < CAMERA0_SCHEDULE_PERIOD_MIN)
+		return false;
+
+	app_regs.REG_CAM0_SCHED_PERIOD = *((uint32_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_SCHED                                                       */
+/************************************************************************/
+void app_read_REG_CAM0_SCHED(void) {}
+bool app_write_REG_CAM0_SCHED(void *a)
+{
+	uint32_t * reg = ((uint32_t*)a);
+	
+	/* Entries with duration must have a valid frequency */
+	for (uint8_t i = 0; i < 12; i += 3)
+		if (reg[i + 1] && (reg[i + 2] < CAMERA0_FREQUENCY_MIN || reg[i + 2] > CAMERA0_FREQUENCY_MAX))
+			return false;
+
+	for (uint8_t i = 0; i < 12; i++)
+		app_regs.REG_CAM0_SCHED[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_SCHED_PERIOD                                                */
+/************************************************************************/
+void app_read_REG_CAM1_SCHED_PERIOD(void) {}
+bool app_write_REG_CAM1_SCHED_PERIOD(void *a)
+{
+	if (*((uint32_t*)a) < CAMERA1_SCHEDULE_PERIOD_MIN)
+		return false;
+
+	app_regs.REG_CAM1_SCHED_PERIOD = *((uint32_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_SCHED                                                       */
+/************************************************************************/
+void app_read_REG_CAM1_SCHED(void) {}
+bool app_write_REG_CAM1_SCHED(void *a)
+{
+	uint32_t * reg = ((uint32_t*)a);
+	
+	/* Entries with duration must have a valid frequency */
+	for (uint8_t i = 0; i < 12; i += 3)
+		if (reg[i + 1] && (reg[i + 2] < CAMERA1_FREQUENCY_MIN || reg[i + 2] > CAMERA1_FREQUENCY_MAX))
+			return false;
+
+	for (uint8_t i = 0; i < 12; i++)
+		app_regs.REG_CAM1_SCHED[i] = reg[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_MMODE_TARGET                                                */
+/************************************************************************/
+void app_read_REG_CAM0_MMODE_TARGET(void) {}
+bool app_write_REG_CAM0_MMODE_TARGET(void *a)
+{
+	if (*((uint16_t*)a) < SERVO0_TARGET_MIN)
+		return false;
+	
+	app_regs.REG_CAM0_MMODE_TARGET = *((uint16_t*)a);
+	servo_motion_move_motor0();
+
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_MMODE_MAX_VEL                                               */
+/************************************************************************/
+void app_read_REG_CAM0_MMODE_MAX_VEL(void) {}
+bool app_write_REG_CAM0_MMODE_MAX_VEL(void *a)
+{
+	app_regs.REG_CAM0_MMODE_MAX_VEL = *((uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_MMODE_ACCEL                                                 */
+/************************************************************************/
+void app_read_REG_CAM0_MMODE_ACCEL(void) {}
+bool app_write_REG_CAM0_MMODE_ACCEL(void *a)
+{
+	app_regs.REG_CAM0_MMODE_ACCEL = *((uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_MMODE_PROFILE                                               */
+/************************************************************************/
+void app_read_REG_CAM0_MMODE_PROFILE(void) {}
+bool app_write_REG_CAM0_MMODE_PROFILE(void *a)
+{
+	if (*((uint8_t*)a) & ~MSK_MMODE_PROFILE)
+		return false;
+
+	app_regs.REG_CAM0_MMODE_PROFILE = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_MMODE_TARGET                                                */
+/************************************************************************/
+void app_read_REG_CAM1_MMODE_TARGET(void) {}
+bool app_write_REG_CAM1_MMODE_TARGET(void *a)
+{
+	if (*((uint16_t*)a) < SERVO1_TARGET_MIN)
+		return false;
+	
+	app_regs.REG_CAM1_MMODE_TARGET = *((uint16_t*)a);
+	servo_motion_move_motor1();
+
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_MMODE_MAX_VEL                                               */
+/************************************************************************/
+void app_read_REG_CAM1_MMODE_MAX_VEL(void) {}
+bool app_write_REG_CAM1_MMODE_MAX_VEL(void *a)
+{
+	app_regs.REG_CAM1_MMODE_MAX_VEL = *((uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_MMODE_ACCEL                                                 */
+/************************************************************************/
+void app_read_REG_CAM1_MMODE_ACCEL(void) {}
+bool app_write_REG_CAM1_MMODE_ACCEL(void *a)
+{
+	app_regs.REG_CAM1_MMODE_ACCEL = *((uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_MMODE_PROFILE                                               */
+/************************************************************************/
+void app_read_REG_CAM1_MMODE_PROFILE(void) {}
+bool app_write_REG_CAM1_MMODE_PROFILE(void *a)
+{
+	if (*((uint8_t*)a) & ~MSK_MMODE_PROFILE)
+		return false;
+
+	app_regs.REG_CAM1_MMODE_PROFILE = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_MOTORS_MOVING                                                    */
+/************************************************************************/
+void app_read_REG_MOTORS_MOVING(void) {}
+bool app_write_REG_MOTORS_MOVING(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_CAM0_MMODE_WP                                                    */
+/************************************************************************/
+void app_read_REG_CAM0_MMODE_WP(void) {}
+bool app_write_REG_CAM0_MMODE_WP(void *a)
+{
+	/* Holds the upload swapped in at the end of the playing trajectory */
+	if (servo_trajectory_queued(0))
+		return false;
+	
+	for (uint8_t i = 0; i < 16; i++)
+		app_regs.REG_CAM0_MMODE_WP[i] = ((uint16_t*)a)[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_MMODE_WP_LEN                                                */
+/************************************************************************/
+void app_read_REG_CAM0_MMODE_WP_LEN(void) {}
+bool app_write_REG_CAM0_MMODE_WP_LEN(void *a)
+{
+	if (*((uint8_t*)a) < SERVO0_WAYPOINT_COUNT_MIN || *((uint8_t*)a) > SERVO0_WAYPOINT_COUNT_MAX)
+		return false;
+	
+	if (servo_trajectory_queued(0))
+		return false;
+
+	app_regs.REG_CAM0_MMODE_WP_LEN = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_MMODE_WP                                                    */
+/************************************************************************/
+void app_read_REG_CAM1_MMODE_WP(void) {}
+bool app_write_REG_CAM1_MMODE_WP(void *a)
+{
+	/* Holds the upload swapped in at the end of the playing trajectory */
+	if (servo_trajectory_queued(1))
+		return false;
+	
+	for (uint8_t i = 0; i < 16; i++)
+		app_regs.REG_CAM1_MMODE_WP[i] = ((uint16_t*)a)[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_MMODE_WP_LEN                                                */
+/************************************************************************/
+void app_read_REG_CAM1_MMODE_WP_LEN(void) {}
+bool app_write_REG_CAM1_MMODE_WP_LEN(void *a)
+{
+	if (*((uint8_t*)a) < SERVO1_WAYPOINT_COUNT_MIN || *((uint8_t*)a) > SERVO1_WAYPOINT_COUNT_MAX)
+		return false;
+	
+	if (servo_trajectory_queued(1))
+		return false;
+
+	app_regs.REG_CAM1_MMODE_WP_LEN = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_MOTORS_PLAY                                                      */
+/************************************************************************/
+void app_read_REG_MOTORS_PLAY(void) { app_regs.REG_MOTORS_PLAY = 0; }
+bool app_write_REG_MOTORS_PLAY(void *a)
+{
+	if (*((uint8_t*)a) & B_MOTOR0)
+		servo_trajectory_play_motor0();
+
+	if (*((uint8_t*)a) & B_MOTOR1)
+		servo_trajectory_play_motor1();
+
+	app_regs.REG_MOTORS_PLAY = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_MOTORS_PLAY_IN0                                                  */
+/************************************************************************/
+void app_read_REG_MOTORS_PLAY_IN0(void) {}
+bool app_write_REG_MOTORS_PLAY_IN0(void *a)
+{
+	if (*((uint8_t*)a) & ~(B_MOTOR0 | B_MOTOR1))
+		return false;
+
+	app_regs.REG_MOTORS_PLAY_IN0 = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_MMODE_PULSE_FINE                                            */
+/************************************************************************/
+void app_read_REG_CAM0_MMODE_PULSE_FINE(void) {}
+bool app_write_REG_CAM0_MMODE_PULSE_FINE(void *a)
+{
+	if (*((uint16_t*)a) < 1)
+		return false;
+	
+	servo_motion_cancel_motor0();
+	servo_set_pulse_motor0(*((uint16_t*)a));
+
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_MMODE_PULSE_FINE                                            */
+/************************************************************************/
+void app_read_REG_CAM1_MMODE_PULSE_FINE(void) {}
+bool app_write_REG_CAM1_MMODE_PULSE_FINE(void *a)
+{
+	if (*((uint16_t*)a) < 1)
+		return false;
+	
+	servo_motion_cancel_motor1();
+	servo_set_pulse_motor1(*((uint16_t*)a));
+
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM0_MMODE_FIFO                                                  */
+/************************************************************************/
+/* Write-only, the setpoints only live in the servo FIFO */
+void app_read_REG_CAM0_MMODE_FIFO(void)
+{
+	for (uint8_t i = 0; i < 8; i++)
+		app_regs_shared.REG_CAM0_MMODE_FIFO[i] = 0;
+}
+bool app_write_REG_CAM0_MMODE_FIFO(void *a)
+{
+	if (!servo_fifo_write_motor0((uint16_t*)a))
+		return false;
+
+	for (uint8_t i = 0; i < 8; i++)
+		app_regs_shared.REG_CAM0_MMODE_FIFO[i] = ((uint16_t*)a)[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CAM1_MMODE_FIFO                                                  */
+/************************************************************************/
+/* Write-only, the setpoints only live in the servo FIFO */
+void app_read_REG_CAM1_MMODE_FIFO(void)
+{
+	for (uint8_t i = 0; i < 8; i++)
+		app_regs_shared.REG_CAM1_MMODE_FIFO[i] = 0;
+}
+bool app_write_REG_CAM1_MMODE_FIFO(void *a)
+{
+	if (!servo_fifo_write_motor1((uint16_t*)a))
+		return false;
+
+	for (uint8_t i = 0; i < 8; i++)
+		app_regs_shared.REG_CAM1_MMODE_FIFO[i] = ((uint16_t*)a)[i];
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_MOTORS_UNDERRUN                                                  */
+/************************************************************************/
+void app_read_REG_MOTORS_UNDERRUN(void) {}
+bool app_write_REG_MOTORS_UNDERRUN(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_TIMER_OWNERS                                                     */
+/************************************************************************/
+void app_read_REG_TIMER_OWNERS(void) {}
+bool app_write_REG_TIMER_OWNERS(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_MOTORS_ALIGN                                                     */
+/************************************************************************/
+void app_read_REG_MOTORS_ALIGN(void) { app_regs.REG_MOTORS_ALIGN = 0; }
+bool app_write_REG_MOTORS_ALIGN(void *a)
+{
+	if (*((uint8_t*)a) & ~(B_MOTOR0 | B_MOTOR1))
+		return false;
+
+	servo_align(*((uint8_t*)a));
+
+	app_regs.REG_MOTORS_ALIGN = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CHANNEL_STATE                                                    */
+/************************************************************************/
+void app_read_REG_CHANNEL_STATE(void) {}
+bool app_write_REG_CHANNEL_STATE(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_SOFT_TRIG                                                        */
+/************************************************************************/
+void app_read_REG_SOFT_TRIG(void) { app_regs.REG_SOFT_TRIG = 0; }
+bool app_write_REG_SOFT_TRIG(void *a)
+{
+	if (*((uint8_t*)a) & ~(B_TRIG_CAM0 | B_TRIG_CAM1))
+		return false;
+
+	if (!soft_trigger(*((uint8_t*)a)))
+		return false;
+
+	app_regs.REG_SOFT_TRIG = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CONFIG_STAGE                                                     */
+/************************************************************************/
+void app_read_REG_CONFIG_STAGE(void) {}
+bool app_write_REG_CONFIG_STAGE(void *a)
+{
+	if (*((uint8_t*)a) > 1)
+		return false;
+
+	app_regs.REG_CONFIG_STAGE = *((uint8_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_CONFIG_COMMIT                                                    */
+/************************************************************************/
+void app_read_REG_CONFIG_COMMIT(void) {}
+bool app_write_REG_CONFIG_COMMIT(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+
+	if (reg == GM_COMMIT_DISCARD)
+		config_discard();
+	else if (reg == GM_COMMIT_NOW)
+		config_commit();
+	else if (reg == GM_COMMIT_NEXT_SECOND)
+		config_commit_on_second = true;
+	else
+		return false;
+
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_SNAPSHOT                                                         */
+/************************************************************************/
+/* Little-endian layout, see device.yml */
+static void snapshot_u16(uint8_t offset, uint16_t value)
+{
+	app_regs_shared.REG_SNAPSHOT[offset] = value;
+	app_regs_shared.REG_SNAPSHOT[offset + 1] = value >> 8;
+}
+
+static void snapshot_u32(uint8_t offset, uint32_t value)
+{
+	snapshot_u16(offset, value);
+	snapshot_u16(offset + 2, value >> 16);
+}
+
+void app_read_REG_SNAPSHOT(void)
+{
+	uint8_t sreg = SREG;
+	cli();
+	uint32_t triggers0 = camera0_triggers;
+	uint32_t triggers1 = camera1_triggers;
+	uint16_t underrun0 = app_regs.REG_MOTORS_UNDERRUN[0];
+	uint16_t underrun1 = app_regs.REG_MOTORS_UNDERRUN[1];
+	SREG = sreg;
+	
+	app_read_REG_OUTPUTS();
+	app_read_REG_INPUT0();
+	app_read_REG_CAM0_FREQ();
+	app_read_REG_CAM1_FREQ();
+	
+	app_regs_shared.REG_SNAPSHOT[0] = app_regs.REG_OUTPUTS;
+	app_regs_shared.REG_SNAPSHOT[1] = app_regs.REG_INPUT0;
+	app_regs_shared.REG_SNAPSHOT[2] = app_regs.REG_CHANNEL_STATE[0];
+	app_regs_shared.REG_SNAPSHOT[3] = app_regs.REG_CHANNEL_STATE[1];
+	app_regs_shared.REG_SNAPSHOT[4] = app_regs.REG_MOTORS_MOVING;
+	app_regs_shared.REG_SNAPSHOT[5] = app_regs.REG_IN0_MODE;
+	app_regs_shared.REG_SNAPSHOT[6] = app_regs.REG_CAM0_MODE;
+	app_regs_shared.REG_SNAPSHOT[7] = app_regs.REG_CAM1_MODE;
+	snapshot_u16(8, app_regs.REG_CAM0_FREQ);
+	snapshot_u16(10, app_regs.REG_CAM1_FREQ);
+	snapshot_u16(12, app_regs.REG_CAM0_MMODE_PERIOD);
+	snapshot_u16(14, app_regs.REG_CAM1_MMODE_PERIOD);
+	snapshot_u16(16, app_regs.REG_CAM0_MMODE_PULSE_FINE);
+	snapshot_u16(18, app_regs.REG_CAM1_MMODE_PULSE_FINE);
+	snapshot_u32(20, triggers0);
+	snapshot_u32(24, triggers1);
+	snapshot_u16(28, underrun0);
+	snapshot_u16(30, underrun1);
+	app_regs_shared.REG_SNAPSHOT[32] = app_regs.REG_EVT_EN;
+	app_regs_shared.REG_SNAPSHOT[33] = app_regs.REG_CLK_DISCIPLINE;
+	app_regs_shared.REG_SNAPSHOT[34] = app_regs.REG_SYNC_INTERVAL;
+	app_regs_shared.REG_SNAPSHOT[35] = app_regs.REG_SCHED_EN;
+}
+bool app_write_REG_SNAPSHOT(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_OUT_INVERT                                                       */
+/************************************************************************/
+/* The port inverts both the driven and the read level, so the firmware */
+/* and the timer waveforms keep working with the logic levels. The      */
+/* external clock already inverts the trigger pins it drives.           */
+static void set_pin_invert(PORT_t * port, uint8_t pin, bool invert)
+{
+	register8_t * pinctrl = &port->PIN0CTRL + pin;
+	
+	if (invert)
+		*pinctrl |= PORT_INVEN_bm;
+	else
+		*pinctrl &= ~PORT_INVEN_bm;
+}
+
+void app_read_REG_OUT_INVERT(void) {}
+bool app_write_REG_OUT_INVERT(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg & ~(B_OUT_CAM_TRIG0 | B_OUT_CAM_SYNC0 | B_OUT_CAM_TRIG1 | B_OUT_CAM_SYNC1))
+		return false;
+	
+	uint8_t sreg = SREG;
+	cli();
+	bool ext0 = (app_regs.REG_TIMER_OWNERS[TIMER_TCC0] == GM_TIMER_OWNER_EXT_CLK);
+	bool ext1 = (app_regs.REG_TIMER_OWNERS[TIMER_TCD0] == GM_TIMER_OWNER_EXT_CLK);
+	set_pin_invert(&PORTC, 0, (bool)(reg & B_OUT_CAM_TRIG0) != ext0);
+	set_pin_invert(&PORTC, 1, reg & B_OUT_CAM_SYNC0);
+	set_pin_invert(&PORTD, 0, (bool)(reg & B_OUT_CAM_TRIG1) != ext1);
+	set_pin_invert(&PORTD, 1, reg & B_OUT_CAM_SYNC1);
+	SREG = sreg;
+
+	app_regs.REG_OUT_INVERT = reg;
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_ISR_PROF                                                         */
+/************************************************************************/
+void app_read_REG_ISR_PROF(void)
+{
+#ifdef ISR_PROFILING
+	isr_prof_read(app_regs.REG_ISR_PROF_SLOT, app_regs_shared.REG_ISR_PROF);
+#endif
+}
+bool app_write_REG_ISR_PROF(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_ISR_PROF_RESET                                                   */
+/************************************************************************/
+void app_read_REG_ISR_PROF_RESET(void) {}
+bool app_write_REG_ISR_PROF_RESET(void *a)
+{
+	if (*((uint8_t*)a) != 1)
+		return false;
+
+#ifdef ISR_PROFILING
+	isr_prof_reset();
+#endif
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_JITTER_MODE                                                      */
+/************************************************************************/
+void app_read_REG_JITTER_MODE(void) {}
+bool app_write_REG_JITTER_MODE(void *a)
+{
+	uint8_t reg = *((uint8_t*)a);
+	
+	if (reg > GM_JITTER_CAM1)
+		return false;
+	
+	if (reg == GM_JITTER_OFF)
+	{
+		jitter_stop();
+		app_regs.REG_JITTER_MODE = reg;
+		return true;
+	}
+	
+	uint8_t previous = app_regs.REG_JITTER_MODE;
+	app_regs.REG_JITTER_MODE = reg;
+	
+	if (!jitter_start())
+	{
+		app_regs.REG_JITTER_MODE = previous;
+		return false;
+	}
+	
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_JITTER_THRESHOLD                                                 */
+/************************************************************************/
+void app_read_REG_JITTER_THRESHOLD(void) {}
+bool app_write_REG_JITTER_THRESHOLD(void *a)
+{
+	/* Applied from the next Harp second */
+	app_regs.REG_JITTER_THRESHOLD = *((uint16_t*)a);
+	return true;
+}
+
+
+/************************************************************************/
+/* REG_JITTER_STATS                                                     */
+/************************************************************************/
+void app_read_REG_JITTER_STATS(void) {}
+bool app_write_REG_JITTER_STATS(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_STACK_FREE                                                       */
+/************************************************************************/
+void app_read_REG_STACK_FREE(void)
+{
+	app_regs.REG_STACK_FREE = stack_free();
+}
+bool app_write_REG_STACK_FREE(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_EXT_CLK_SKIPS                                                    */
+/************************************************************************/
+void app_read_REG_EXT_CLK_SKIPS(void) {}
+bool app_write_REG_EXT_CLK_SKIPS(void *a) { return false; }
+
+
+/************************************************************************/
+/* REG_ISR_PROF_SLOT                                                    */
+/************************************************************************/
+void app_read_REG_ISR_PROF_SLOT(void) {}
+bool app_write_REG_ISR_PROF_SLOT(void *a)
+{
+	if (*((uint8_t*)a) > ISR_PROFILE_SLOT_MAX)
+		return false;
+
+	app_regs.REG_ISR_PROF_SLOT = *((uint8_t*)a);
+	return true;
 }
\ No newline at end of file
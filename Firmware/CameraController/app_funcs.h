@@ -48,6 +48,64 @@ void app_read_REG_CAM1_MMODE_PULSE(void);
 void app_read_REG_RESERVED2(void);
 void app_read_REG_RESERVED3(void);
 void app_read_REG_EVT_EN(void);
+void app_read_REG_CAM0_CLK_DIV(void);
+void app_read_REG_CAM0_CLK_MUL(void);
+void app_read_REG_CAM0_TRIG_DELAY(void);
+void app_read_REG_CAM0_TRIG_WIDTH(void);
+void app_read_REG_CAM1_CLK_DIV(void);
+void app_read_REG_CAM1_CLK_MUL(void);
+void app_read_REG_CAM1_TRIG_DELAY(void);
+void app_read_REG_CAM1_TRIG_WIDTH(void);
+void app_read_REG_CLK_DISCIPLINE(void);
+void app_read_REG_CLK_DRIFT(void);
+void app_read_REG_CAM0_SEQ(void);
+void app_read_REG_CAM0_SEQ_LEN(void);
+void app_read_REG_CAM0_SEQ_REPEAT(void);
+void app_read_REG_CAM1_SEQ(void);
+void app_read_REG_CAM1_SEQ_LEN(void);
+void app_read_REG_CAM1_SEQ_REPEAT(void);
+void app_read_REG_SCHED_EN(void);
+void app_read_REG_SCHED_WINDOWS(void);
+void app_read_REG_CAM0_SCHED_PERIOD(void);
+void app_read_REG_CAM0_SCHED(void);
+void app_read_REG_CAM1_SCHED_PERIOD(void);
+void app_read_REG_CAM1_SCHED(void);
+void app_read_REG_CAM0_MMODE_TARGET(void);
+void app_read_REG_CAM0_MMODE_MAX_VEL(void);
+void app_read_REG_CAM0_MMODE_ACCEL(void);
+void app_read_REG_CAM0_MMODE_PROFILE(void);
+void app_read_REG_CAM1_MMODE_TARGET(void);
+void app_read_REG_CAM1_MMODE_MAX_VEL(void);
+void app_read_REG_CAM1_MMODE_ACCEL(void);
+void app_read_REG_CAM1_MMODE_PROFILE(void);
+void app_read_REG_MOTORS_MOVING(void);
+void app_read_REG_CAM0_MMODE_WP(void);
+void app_read_REG_CAM0_MMODE_WP_LEN(void);
+void app_read_REG_CAM1_MMODE_WP(void);
+void app_read_REG_CAM1_MMODE_WP_LEN(void);
+void app_read_REG_MOTORS_PLAY(void);
+void app_read_REG_MOTORS_PLAY_IN0(void);
+void app_read_REG_CAM0_MMODE_PULSE_FINE(void);
+void app_read_REG_CAM1_MMODE_PULSE_FINE(void);
+void app_read_REG_CAM0_MMODE_FIFO(void);
+void app_read_REG_CAM1_MMODE_FIFO(void);
+void app_read_REG_MOTORS_UNDERRUN(void);
+void app_read_REG_TIMER_OWNERS(void);
+void app_read_REG_MOTORS_ALIGN(void);
+void app_read_REG_CHANNEL_STATE(void);
+void app_read_REG_SOFT_TRIG(void);
+void app_read_REG_CONFIG_STAGE(void);
+void app_read_REG_CONFIG_COMMIT(void);
+void app_read_REG_SNAPSHOT(void);
+void app_read_REG_OUT_INVERT(void);
+void app_read_REG_ISR_PROF(void);
+void app_read_REG_ISR_PROF_RESET(void);
+void app_read_REG_JITTER_MODE(void);
+void app_read_REG_JITTER_THRESHOLD(void);
+void app_read_REG_JITTER_STATS(void);
+void app_read_REG_STACK_FREE(void);
+void app_read_REG_EXT_CLK_SKIPS(void);
+void app_read_REG_ISR_PROF_SLOT(void);
 
 bool app_write_REG_START_CAMS(void *a);
 bool app_write_REG_STOP_CAMS(void *a);
@@ -77,6 +135,64 @@ bool app_write_REG_CAM1_MMODE_PULSE(void *a);
 bool app_write_REG_RESERVED2(void *a);
 bool app_write_REG_RESERVED3(void *a);
 bool app_write_REG_EVT_EN(void *a);
+bool app_write_REG_CAM0_CLK_DIV(void *a);
+bool app_write_REG_CAM0_CLK_MUL(void *a);
+bool app_write_REG_CAM0_TRIG_DELAY(void *a);
+bool app_write_REG_CAM0_TRIG_WIDTH(void *a);
+bool app_write_REG_CAM1_CLK_DIV(void *a);
+bool app_write_REG_CAM1_CLK_MUL(void *a);
+bool app_write_REG_CAM1_TRIG_DELAY(void *a);
+bool app_write_REG_CAM1_TRIG_WIDTH(void *a);
+bool app_write_REG_CLK_DISCIPLINE(void *a);
+bool app_write_REG_CLK_DRIFT(void *a);
+bool app_write_REG_CAM0_SEQ(void *a);
+bool app_write_REG_CAM0_SEQ_LEN(void *a);
+bool app_write_REG_CAM0_SEQ_REPEAT(void *a);
+bool app_write_REG_CAM1_SEQ(void *a);
+bool app_write_REG_CAM1_SEQ_LEN(void *a);
+bool app_write_REG_CAM1_SEQ_REPEAT(void *a);
+bool app_write_REG_SCHED_EN(void *a);
+bool app_write_REG_SCHED_WINDOWS(void *a);
+bool app_write_REG_CAM0_SCHED_PERIOD(void *a);
+bool app_write_REG_CAM0_SCHED(void *a);
+bool app_write_REG_CAM1_SCHED_PERIOD(void *a);
+bool app_write_REG_CAM1_SCHED(void *a);
+bool app_write_REG_CAM0_MMODE_TARGET(void *a);
+bool app_write_REG_CAM0_MMODE_MAX_VEL(void *a);
+bool app_write_REG_CAM0_MMODE_ACCEL(void *a);
+bool app_write_REG_CAM0_MMODE_PROFILE(void *a);
+bool app_write_REG_CAM1_MMODE_TARGET(void *a);
+bool app_write_REG_CAM1_MMODE_MAX_VEL(void *a);
+bool app_write_REG_CAM1_MMODE_ACCEL(void *a);
+bool app_write_REG_CAM1_MMODE_PROFILE(void *a);
+bool app_write_REG_MOTORS_MOVING(void *a);
+bool app_write_REG_CAM0_MMODE_WP(void *a);
+bool app_write_REG_CAM0_MMODE_WP_LEN(void *a);
+bool app_write_REG_CAM1_MMODE_WP(void *a);
+bool app_write_REG_CAM1_MMODE_WP_LEN(void *a);
+bool app_write_REG_MOTORS_PLAY(void *a);
+bool app_write_REG_MOTORS_PLAY_IN0(void *a);
+bool app_write_REG_CAM0_MMODE_PULSE_FINE(void *a);
+bool app_write_REG_CAM1_MMODE_PULSE_FINE(void *a);
+bool app_write_REG_CAM0_MMODE_FIFO(void *a);
+bool app_write_REG_CAM1_MMODE_FIFO(void *a);
+bool app_write_REG_MOTORS_UNDERRUN(void *a);
+bool app_write_REG_TIMER_OWNERS(void *a);
+bool app_write_REG_MOTORS_ALIGN(void *a);
+bool app_write_REG_CHANNEL_STATE(void *a);
+bool app_write_REG_SOFT_TRIG(void *a);
+bool app_write_REG_CONFIG_STAGE(void *a);
+bool app_write_REG_CONFIG_COMMIT(void *a);
+bool app_write_REG_SNAPSHOT(void *a);
+bool app_write_REG_OUT_INVERT(void *a);
+bool app_write_REG_ISR_PROF(void *a);
+bool app_write_REG_ISR_PROF_RESET(void *a);
+bool app_write_REG_JITTER_MODE(void *a);
+bool app_write_REG_JITTER_THRESHOLD(void *a);
+bool app_write_REG_JITTER_STATS(void *a);
+bool app_write_REG_STACK_FREE(void *a);
+bool app_write_REG_EXT_CLK_SKIPS(void *a);
+bool app_write_REG_ISR_PROF_SLOT(void *a);
 
 
 #endif /* _APP_FUNCTIONS_H_ */
\ No newline at end of file
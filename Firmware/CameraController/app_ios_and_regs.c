@@ -1,6 +1,8 @@
 #include <avr/io.h>
+#include <avr/pgmspace.h>
 #include "hwbp_core_types.h"
 #include "app_ios_and_regs.h"
+#include "app_regs_tables.h"
 
 /************************************************************************/
 /* Configure and initialize IOs                                         */
@@ -29,69 +31,31 @@ void init_ios(void)
 /* Registers' stuff                                                     */
 /************************************************************************/
 AppRegs app_regs;
+AppRegsShared app_regs_shared;
+
+/* The register bank must match device.yml */
+_Static_assert(APP_REGS_ADD_MIN == YML_REGS_ADD_MIN, "First register differs from device.yml");
+_Static_assert(APP_REGS_ADD_MAX == YML_REGS_ADD_MAX, "Last register differs from device.yml");
+_Static_assert(APP_NBYTES_OF_REG_BANK + APP_NBYTES_OF_SHARED_REGS == YML_NBYTES_OF_REG_BANK, "Register bank size differs from device.yml");
+_Static_assert(sizeof(AppRegs) == APP_NBYTES_OF_REG_BANK, "AppRegs size differs from APP_NBYTES_OF_REG_BANK");
+_Static_assert(sizeof(app_regs_shared.REG_CAM0_MMODE_FIFO) * 2 + sizeof(app_regs_shared.REG_SNAPSHOT) + sizeof(app_regs_shared.REG_ISR_PROF) == APP_NBYTES_OF_SHARED_REGS, "Shared registers differ from APP_NBYTES_OF_SHARED_REGS");
+_Static_assert(ISR_PROFILE_SLOT_MAX == ISR_PROF_SLOTS - 1, "IsrProfileSlot range differs from the ISR profiling slots");
 
 uint8_t app_regs_type[] = {
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U16,
-	TYPE_U16,
-	TYPE_U16,
-	TYPE_U8,
-	TYPE_U16,
-	TYPE_U16,
-	TYPE_U16,
-	TYPE_U8,
-	TYPE_U8,
-	TYPE_U8
+	YML_REGS_TYPE
 };
 
 uint16_t app_regs_n_elements[] = {
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1,
-	1
+	YML_REGS_N_ELEMENTS
+};
+
+/* Only read by the application, so it stays in flash */
+const AppRegsCheck app_regs_check[] PROGMEM = {
+	YML_REGS_CHECK
 };
 
+_Static_assert(sizeof(app_regs_check) / sizeof(app_regs_check[0]) == APP_REGS_ADD_MAX - APP_REGS_ADD_MIN + 1, "Missing register checks");
+
 uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_START_CAMS),
 	(uint8_t*)(&app_regs.REG_STOP_CAMS),
@@ -120,5 +84,65 @@ uint8_t *app_regs_pointer[] = {
 	(uint8_t*)(&app_regs.REG_CAM1_MMODE_PULSE),
 	(uint8_t*)(&app_regs.REG_RESERVED2),
 	(uint8_t*)(&app_regs.REG_RESERVED3),
-	(uint8_t*)(&app_regs.REG_EVT_EN)
-};
\ No newline at end of file
+	(uint8_t*)(&app_regs.REG_EVT_EN),
+	(uint8_t*)(&app_regs.REG_CAM0_CLK_DIV),
+	(uint8_t*)(&app_regs.REG_CAM0_CLK_MUL),
+	(uint8_t*)(&app_regs.REG_CAM0_TRIG_DELAY),
+	(uint8_t*)(&app_regs.REG_CAM0_TRIG_WIDTH),
+	(uint8_t*)(&app_regs.REG_CAM1_CLK_DIV),
+	(uint8_t*)(&app_regs.REG_CAM1_CLK_MUL),
+	(uint8_t*)(&app_regs.REG_CAM1_TRIG_DELAY),
+	(uint8_t*)(&app_regs.REG_CAM1_TRIG_WIDTH),
+	(uint8_t*)(&app_regs.REG_CLK_DISCIPLINE),
+	(uint8_t*)(app_regs.REG_CLK_DRIFT),
+	(uint8_t*)(app_regs.REG_CAM0_SEQ),
+	(uint8_t*)(&app_regs.REG_CAM0_SEQ_LEN),
+	(uint8_t*)(&app_regs.REG_CAM0_SEQ_REPEAT),
+	(uint8_t*)(app_regs.REG_CAM1_SEQ),
+	(uint8_t*)(&app_regs.REG_CAM1_SEQ_LEN),
+	(uint8_t*)(&app_regs.REG_CAM1_SEQ_REPEAT),
+	(uint8_t*)(&app_regs.REG_SCHED_EN),
+	(uint8_t*)(&app_regs.REG_SCHED_WINDOWS),
+	(uint8_t*)(&app_regs.REG_CAM0_SCHED_PERIOD),
+	(uint8_t*)(app_regs.REG_CAM0_SCHED),
+	(uint8_t*)(&app_regs.REG_CAM1_SCHED_PERIOD),
+	(uint8_t*)(app_regs.REG_CAM1_SCHED),
+	(uint8_t*)(&app_regs.REG_CAM0_MMODE_TARGET),
+	(uint8_t*)(&app_regs.REG_CAM0_MMODE_MAX_VEL),
+	(uint8_t*)(&app_regs.REG_CAM0_MMODE_ACCEL),
+	(uint8_t*)(&app_regs.REG_CAM0_MMODE_PROFILE),
+	(uint8_t*)(&app_regs.REG_CAM1_MMODE_TARGET),
+	(uint8_t*)(&app_regs.REG_CAM1_MMODE_MAX_VEL),
+	(uint8_t*)(&app_regs.REG_CAM1_MMODE_ACCEL),
+	(uint8_t*)(&app_regs.REG_CAM1_MMODE_PROFILE),
+	(uint8_t*)(&app_regs.REG_MOTORS_MOVING),
+	(uint8_t*)(app_regs.REG_CAM0_MMODE_WP),
+	(uint8_t*)(&app_regs.REG_CAM0_MMODE_WP_LEN),
+	(uint8_t*)(app_regs.REG_CAM1_MMODE_WP),
+	(uint8_t*)(&app_regs.REG_CAM1_MMODE_WP_LEN),
+	(uint8_t*)(&app_regs.REG_MOTORS_PLAY),
+	(uint8_t*)(&app_regs.REG_MOTORS_PLAY_IN0),
+	(uint8_t*)(&app_regs.REG_CAM0_MMODE_PULSE_FINE),
+	(uint8_t*)(&app_regs.REG_CAM1_MMODE_PULSE_FINE),
+	(uint8_t*)(app_regs_shared.REG_CAM0_MMODE_FIFO),
+	(uint8_t*)(app_regs_shared.REG_CAM1_MMODE_FIFO),
+	(uint8_t*)(app_regs.REG_MOTORS_UNDERRUN),
+	(uint8_t*)(app_regs.REG_TIMER_OWNERS),
+	(uint8_t*)(&app_regs.REG_MOTORS_ALIGN),
+	(uint8_t*)(app_regs.REG_CHANNEL_STATE),
+	(uint8_t*)(&app_regs.REG_SOFT_TRIG),
+	(uint8_t*)(&app_regs.REG_CONFIG_STAGE),
+	(uint8_t*)(&app_regs.REG_CONFIG_COMMIT),
+	(uint8_t*)(app_regs_shared.REG_SNAPSHOT),
+	(uint8_t*)(&app_regs.REG_OUT_INVERT),
+	(uint8_t*)(app_regs_shared.REG_ISR_PROF),
+	(uint8_t*)(&app_regs.REG_ISR_PROF_RESET),
+	(uint8_t*)(&app_regs.REG_JITTER_MODE),
+	(uint8_t*)(&app_regs.REG_JITTER_THRESHOLD),
+	(uint8_t*)(app_regs.REG_JITTER_STATS),
+	(uint8_t*)(&app_regs.REG_STACK_FREE),
+	(uint8_t*)(app_regs.REG_EXT_CLK_SKIPS),
+	(uint8_t*)(&app_regs.REG_ISR_PROF_SLOT)
+};
+
+_Static_assert(sizeof(app_regs_pointer) / sizeof(app_regs_pointer[0]) == APP_REGS_ADD_MAX - APP_REGS_ADD_MIN + 1, "Missing register pointers");
\ No newline at end of file
@@ -43,6 +43,40 @@ void init_ios(void);
 #define read_CAM1_SYNC read_io(PORTD, 1)
 
 
+/************************************************************************/
+/* ISR profiling                                                        */
+/************************************************************************/
+/* Uncomment to time the ISRs with TCD1, running at the CPU clock.      */
+/* ISR_PROF reports the statistics of the slot selected by              */
+/* ISR_PROF_SLOT, so its length doesn't grow with the number of slots.  */
+/* When commented out the ISRs are not instrumented and ISR_PROF reads  */
+/* all zeros.                                                           */
+// #define ISR_PROFILING
+
+#define ISR_PROF_IN0                       0            // PORTA_INT0, DI0 edges
+#define ISR_PROF_TCC0_OVF                  1            // Camera 0 trigger or servo 0 step
+#define ISR_PROF_TCD0_OVF                  2            // Camera 1 trigger or servo 1 step
+#define ISR_PROF_TCC0_CC                   3            // Camera 0 delayed, sequence and software pulses
+#define ISR_PROF_TCD0_CC                   4            // Camera 1 delayed, sequence and software pulses
+#define ISR_PROF_TCE0_CC                   5            // TCE0_CCA, trigger jitter capture
+#define ISR_PROF_SLOTS                     6
+#define ISR_PROF_BINS                      8            // Below 32, 64, ... 2048 and from 2048 cycles
+#define ISR_PROF_SLOT_SIZE                 12           // Count, min, max, mean and the bins
+
+/* The start times are globals since the ISRs are naked and have no     */
+/* stack frame for locals. An ISR doesn't nest in itself, so each one   */
+/* has its own.                                                         */
+#ifdef ISR_PROFILING
+	extern uint16_t isr_prof_t0[ISR_PROF_SLOTS];
+	void isr_prof_record(uint8_t slot);
+	#define isr_prof_start(slot)  isr_prof_t0[slot] = TCD1_CNT
+	#define isr_prof_end(slot)    isr_prof_record(slot)
+#else
+	#define isr_prof_start(slot)
+	#define isr_prof_end(slot)
+#endif
+
+
 /************************************************************************/
 /* Registers' structure                                                 */
 /************************************************************************/
@@ -76,8 +110,82 @@ typedef struct
 	uint8_t REG_RESERVED2;
 	uint8_t REG_RESERVED3;
 	uint8_t REG_EVT_EN;
+	uint8_t REG_CAM0_CLK_DIV;
+	uint8_t REG_CAM0_CLK_MUL;
+	uint16_t REG_CAM0_TRIG_DELAY;
+	uint16_t REG_CAM0_TRIG_WIDTH;
+	uint8_t REG_CAM1_CLK_DIV;
+	uint8_t REG_CAM1_CLK_MUL;
+	uint16_t REG_CAM1_TRIG_DELAY;
+	uint16_t REG_CAM1_TRIG_WIDTH;
+	uint8_t REG_CLK_DISCIPLINE;
+	int32_t REG_CLK_DRIFT[4];
+	uint16_t REG_CAM0_SEQ[16];
+	uint8_t REG_CAM0_SEQ_LEN;
+	uint8_t REG_CAM0_SEQ_REPEAT;
+	uint16_t REG_CAM1_SEQ[16];
+	uint8_t REG_CAM1_SEQ_LEN;
+	uint8_t REG_CAM1_SEQ_REPEAT;
+	uint8_t REG_SCHED_EN;
+	uint8_t REG_SCHED_WINDOWS;
+	uint32_t REG_CAM0_SCHED_PERIOD;
+	uint32_t REG_CAM0_SCHED[12];
+	uint32_t REG_CAM1_SCHED_PERIOD;
+	uint32_t REG_CAM1_SCHED[12];
+	uint16_t REG_CAM0_MMODE_TARGET;
+	uint16_t REG_CAM0_MMODE_MAX_VEL;
+	uint16_t REG_CAM0_MMODE_ACCEL;
+	uint8_t REG_CAM0_MMODE_PROFILE;
+	uint16_t REG_CAM1_MMODE_TARGET;
+	uint16_t REG_CAM1_MMODE_MAX_VEL;
+	uint16_t REG_CAM1_MMODE_ACCEL;
+	uint8_t REG_CAM1_MMODE_PROFILE;
+	uint8_t REG_MOTORS_MOVING;
+	uint16_t REG_CAM0_MMODE_WP[16];
+	uint8_t REG_CAM0_MMODE_WP_LEN;
+	uint16_t REG_CAM1_MMODE_WP[16];
+	uint8_t REG_CAM1_MMODE_WP_LEN;
+	uint8_t REG_MOTORS_PLAY;
+	uint8_t REG_MOTORS_PLAY_IN0;
+	uint16_t REG_CAM0_MMODE_PULSE_FINE;
+	uint16_t REG_CAM1_MMODE_PULSE_FINE;
+	uint16_t REG_MOTORS_UNDERRUN[2];
+	uint8_t REG_TIMER_OWNERS[5];
+	uint8_t REG_MOTORS_ALIGN;
+	uint8_t REG_CHANNEL_STATE[2];
+	uint8_t REG_SOFT_TRIG;
+	uint8_t REG_CONFIG_STAGE;
+	uint8_t REG_CONFIG_COMMIT;
+	uint8_t REG_OUT_INVERT;
+	uint8_t REG_ISR_PROF_RESET;
+	uint8_t REG_JITTER_MODE;
+	uint16_t REG_JITTER_THRESHOLD;
+	uint32_t REG_JITTER_STATS[6];
+	uint16_t REG_STACK_FREE;
+	uint16_t REG_EXT_CLK_SKIPS[2];
+	uint8_t REG_ISR_PROF_SLOT;
 } AppRegs;
 
+/* Mask, min and max of each element written to a register, generated  */
+/* from device.yml in app_regs_tables.h and kept in flash.              */
+typedef struct
+{
+	uint32_t mask;
+	uint32_t min;
+	uint32_t max;
+} AppRegsCheck;
+
+/* The write-only registers and the ones filled by their read handler   */
+/* keep nothing between two commands, so they share one buffer instead  */
+/* of taking room in AppRegs. None of them is sent as an event.         */
+typedef union
+{
+	uint16_t REG_CAM0_MMODE_FIFO[8];
+	uint16_t REG_CAM1_MMODE_FIFO[8];
+	uint8_t REG_SNAPSHOT[36];
+	uint16_t REG_ISR_PROF[ISR_PROF_SLOT_SIZE];
+} AppRegsShared;
+
 /************************************************************************/
 /* Registers' address                                                   */
 /************************************************************************/
@@ -100,16 +208,74 @@ typedef struct
 #define ADD_REG_RESERVED1                   47 // U8     Reserved
 #define ADD_REG_IN0_MODE                    48 // U8     Select the functionality of Input 0
 #define ADD_REG_CAM0_MODE                   49 // U8     Configures when the camera is triggered
-#define ADD_REG_CAM0_FREQ                   50 // U16    Configures the camera 0's sample frequency [1;600]
-#define ADD_REG_CAM0_MMODE_PERIOD           51 // U16    Configures the servo motor period (us) when using motor controller mode (sensitive to 2 us)
-#define ADD_REG_CAM0_MMODE_PULSE            52 // U16    Configures the servo motor pulse (us) when using motor controller mode (sensitive to 2 us)
+#define ADD_REG_CAM0_FREQ                   50 // U16    Configures the camera 0's sample frequency [1;1000]
+#define ADD_REG_CAM0_MMODE_PERIOD           51 // U16    Configures the servo motor period (us) when using motor controller mode (0.25 us resolution up to 16384 us, 0.5 us up to 32767 us, 1 us above)
+#define ADD_REG_CAM0_MMODE_PULSE            52 // U16    Configures the servo motor pulse (us) when using motor controller mode, reports the value applied
 #define ADD_REG_CAM1_MODE                   53 // U8     Configures when the camera is triggered
-#define ADD_REG_CAM1_FREQ                   54 // U16    Configures the camera 1's sample frequency [1;600]
-#define ADD_REG_CAM1_MMODE_PERIOD           55 // U16    Configures the servo motor period (us) when using motor controller mode (sensitive to 2 us)
-#define ADD_REG_CAM1_MMODE_PULSE            56 // U16    Configures the servo motor pulse (us) when using motor controller mode (sensitive to 2 us)
+#define ADD_REG_CAM1_FREQ                   54 // U16    Configures the camera 1's sample frequency [1;1000]
+#define ADD_REG_CAM1_MMODE_PERIOD           55 // U16    Configures the servo motor period (us) when using motor controller mode (0.25 us resolution up to 16384 us, 0.5 us up to 32767 us, 1 us above)
+#define ADD_REG_CAM1_MMODE_PULSE            56 // U16    Configures the servo motor pulse (us) when using motor controller mode, reports the value applied
 #define ADD_REG_RESERVED2                   57 // U8     Reserved for possible future use
 #define ADD_REG_RESERVED3                   58 // U8     Reserved for possible future use
 #define ADD_REG_EVT_EN                      59 // U8     Enable the Events
+#define ADD_REG_CAM0_CLK_DIV                60 // U8     Camera 0 external clock mode: trigger on every Nth DI0 rising edge [1;255]
+#define ADD_REG_CAM0_CLK_MUL                61 // U8     Camera 0 external clock mode: number of triggers per DI0 period [1;64]
+#define ADD_REG_CAM0_TRIG_DELAY             62 // U16    Camera 0 external clock and one-shot modes: delay (us) from the DI0 edge to the trigger
+#define ADD_REG_CAM0_TRIG_WIDTH             63 // U16    Camera 0 external clock and one-shot modes: trigger pulse width (us)
+#define ADD_REG_CAM1_CLK_DIV                64 // U8     Camera 1 external clock mode: trigger on every Nth DI0 rising edge [1;255]
+#define ADD_REG_CAM1_CLK_MUL                65 // U8     Camera 1 external clock mode: number of triggers per DI0 period [1;64]
+#define ADD_REG_CAM1_TRIG_DELAY             66 // U16    Camera 1 external clock and one-shot modes: delay (us) from the DI0 edge to the trigger
+#define ADD_REG_CAM1_TRIG_WIDTH             67 // U16    Camera 1 external clock and one-shot modes: trigger pulse width (us)
+#define ADD_REG_CLK_DISCIPLINE              68 // U8     Locks the camera trigger timebase to the Harp clock
+#define ADD_REG_CLK_DRIFT                   69 // I32    Clock discipline statistics (32 MHz ticks) [error, trim, phase, max phase]
+#define ADD_REG_CAM0_SEQ                    70 // U16    Camera 0 sequence mode: trigger intervals (us) [1000;65535]
+#define ADD_REG_CAM0_SEQ_LEN                71 // U8     Camera 0 sequence mode: number of intervals used [1;16]
+#define ADD_REG_CAM0_SEQ_REPEAT             72 // U8     Camera 0 sequence mode: number of times the sequence is played [0;255] (0 loops forever)
+#define ADD_REG_CAM1_SEQ                    73 // U16    Camera 1 sequence mode: trigger intervals (us) [1000;65535]
+#define ADD_REG_CAM1_SEQ_LEN                74 // U8     Camera 1 sequence mode: number of intervals used [1;16]
+#define ADD_REG_CAM1_SEQ_REPEAT             75 // U8     Camera 1 sequence mode: number of times the sequence is played [0;255] (0 loops forever)
+#define ADD_REG_SCHED_EN                    76 // U8     Enables the acquisition schedule of each camera
+#define ADD_REG_SCHED_WINDOWS               77 // U8     Acquisition schedule windows currently open
+#define ADD_REG_CAM0_SCHED_PERIOD           78 // U32    Camera 0 acquisition schedule period (s)
+#define ADD_REG_CAM0_SCHED                  79 // U32    Camera 0 acquisition schedule entries [offset (s), duration (s), frequency (Hz)]
+#define ADD_REG_CAM1_SCHED_PERIOD           80 // U32    Camera 1 acquisition schedule period (s)
+#define ADD_REG_CAM1_SCHED                  81 // U32    Camera 1 acquisition schedule entries [offset (s), duration (s), frequency (Hz)]
+#define ADD_REG_CAM0_MMODE_TARGET           82 // U16    Servo motor 0 target pulse width (us), reached with the configured profile
+#define ADD_REG_CAM0_MMODE_MAX_VEL          83 // U16    Servo motor 0 maximum velocity (us/s), 0 is unlimited
+#define ADD_REG_CAM0_MMODE_ACCEL            84 // U16    Servo motor 0 acceleration (us/s^2), 0 is unlimited
+#define ADD_REG_CAM0_MMODE_PROFILE          85 // U8     Servo motor 0 motion profile
+#define ADD_REG_CAM1_MMODE_TARGET           86 // U16    Servo motor 1 target pulse width (us), reached with the configured profile
+#define ADD_REG_CAM1_MMODE_MAX_VEL          87 // U16    Servo motor 1 maximum velocity (us/s), 0 is unlimited
+#define ADD_REG_CAM1_MMODE_ACCEL            88 // U16    Servo motor 1 acceleration (us/s^2), 0 is unlimited
+#define ADD_REG_CAM1_MMODE_PROFILE          89 // U8     Servo motor 1 motion profile
+#define ADD_REG_MOTORS_MOVING               90 // U8     Servo motors moving to their targets
+#define ADD_REG_CAM0_MMODE_WP               91 // U16    Servo motor 0 trajectory waypoints [time (ms), pulse width (us)]
+#define ADD_REG_CAM0_MMODE_WP_LEN           92 // U8     Servo motor 0 number of trajectory waypoints [1;8]
+#define ADD_REG_CAM1_MMODE_WP               93 // U16    Servo motor 1 trajectory waypoints [time (ms), pulse width (us)]
+#define ADD_REG_CAM1_MMODE_WP_LEN           94 // U8     Servo motor 1 number of trajectory waypoints [1;8]
+#define ADD_REG_MOTORS_PLAY                 95 // U8     Starts the trajectory playback of the servo motors
+#define ADD_REG_MOTORS_PLAY_IN0             96 // U8     Servo motors whose trajectory playback starts on DI0 rising edges
+#define ADD_REG_CAM0_MMODE_PULSE_FINE       97 // U16    Servo motor 0 pulse (1/8 us), reports the value applied at the timer resolution
+#define ADD_REG_CAM1_MMODE_PULSE_FINE       98 // U16    Servo motor 1 pulse (1/8 us), reports the value applied at the timer resolution
+#define ADD_REG_CAM0_MMODE_FIFO             99 // U16    Servo motor 0 pulse setpoints (1/8 us) applied one per period, zeros are skipped
+#define ADD_REG_CAM1_MMODE_FIFO             100 // U16    Servo motor 1 pulse setpoints (1/8 us) applied one per period, zeros are skipped
+#define ADD_REG_MOTORS_UNDERRUN             101 // U16    Number of setpoint FIFO underruns of each servo motor
+#define ADD_REG_TIMER_OWNERS                102 // U8     Function holding each timer (TCC0, TCC1, TCD0, TCD1, TCE0)
+#define ADD_REG_MOTORS_ALIGN                103 // U8     Restarts the PWM periods of the servo motors on the same clock cycle
+#define ADD_REG_CHANNEL_STATE               104 // U8     State of each camera/servo line
+#define ADD_REG_SOFT_TRIG                   105 // U8     Fires a single trigger pulse on the selected idle cameras
+#define ADD_REG_CONFIG_STAGE                106 // U8     Writes are staged until committed
+#define ADD_REG_CONFIG_COMMIT               107 // U8     Applies or discards the staged writes, reports the number rejected
+#define ADD_REG_SNAPSHOT                    108 // U8     Packed device state
+#define ADD_REG_OUT_INVERT                  109 // U8     Inverts the output lines
+#define ADD_REG_ISR_PROF                    110 // U16    ISR execution time statistics of the selected slot
+#define ADD_REG_ISR_PROF_RESET              111 // U8     Clears the ISR statistics
+#define ADD_REG_JITTER_MODE                 112 // U8     Trigger line measured through the loopback
+#define ADD_REG_JITTER_THRESHOLD            113 // U16    Outlier threshold of the trigger period (ns)
+#define ADD_REG_JITTER_STATS                114 // U32    Trigger period statistics of the last second
+#define ADD_REG_STACK_FREE                  115 // U16    RAM never reached by the stack since the reset
+#define ADD_REG_EXT_CLK_SKIPS               116 // U16    DI0 edges skipped by each camera in external clock and one-shot modes
+#define ADD_REG_ISR_PROF_SLOT               117 // U8     ISR whose statistics ISR_PROF reports [0;5]
 
 /************************************************************************/
 /* PWM Generator registers' memory limits                               */
@@ -119,8 +285,9 @@ typedef struct
 /************************************************************************/
 /* Memory limits */
 #define APP_REGS_ADD_MIN                    0x20
-#define APP_REGS_ADD_MAX                    0x3B
-#define APP_NBYTES_OF_REG_BANK              34
+#define APP_REGS_ADD_MAX                    0x75
+#define APP_NBYTES_OF_REG_BANK              375
+#define APP_NBYTES_OF_SHARED_REGS           92           // FIFOs, SNAPSHOT and ISR_PROF, see AppRegsShared
 
 /************************************************************************/
 /* Registers' bits                                                      */
@@ -152,13 +319,61 @@ typedef struct
 #define GM_IN0_L_CAM1                      (4<<0)       // When logic 0: enable camera 1 or motor 1
 #define GM_IN0_L_BOTH                      (5<<0)       // When logic 0: enable both cameras or motors
 #define GM_IN0_NOT_USED                    (6<<0)       // Used as a digital input only
-#define MSK_CAM0_MODE                      (1<<0)       // Options for CAM0
+#define MSK_CAM0_MODE                      (7<<0)       // Options for CAM0
 #define GM_CAM0_MODE_CAM                   (0<<0)       // The camera 0 is triggered at a configured frequency
 #define GM_CAM0_MODE_MOTOR                 (1<<0)       // Used in servo motor controller mode
-#define MSK_CAM1_MODE                      (1<<0)       // Options for CAM1
+#define GM_CAM0_MODE_EXT_CLK               (2<<0)       // The camera 0 is triggered from the DI0 rising edges
+#define GM_CAM0_MODE_ONE_SHOT              (3<<0)       // The camera 0 is triggered once after the next DI0 rising edge
+#define GM_CAM0_MODE_SEQUENCE              (4<<0)       // The camera 0 is triggered with the sequence of intervals
+#define MSK_CAM1_MODE                      (7<<0)       // Options for CAM1
 #define GM_CAM1_MODE_CAM                   (0<<0)       // The camera 1 is triggered at a configured frequency
 #define GM_CAM1_MODE_MOTOR                 (1<<0)       // Used in servo motor controller mode
+#define GM_CAM1_MODE_EXT_CLK               (2<<0)       // The camera 1 is triggered from the DI0 rising edges
+#define GM_CAM1_MODE_ONE_SHOT              (3<<0)       // The camera 1 is triggered once after the next DI0 rising edge
+#define GM_CAM1_MODE_SEQUENCE              (4<<0)       // The camera 1 is triggered with the sequence of intervals
+#define MSK_CLK_DISCIPLINE                 (1<<0)       // Clock discipline options
+#define GM_CLK_DISCIPLINE_OFF              (0<<0)       // Camera triggers use the local clock
+#define GM_CLK_DISCIPLINE_HARP             (1<<0)       // Camera triggers are locked to the Harp clock
 #define B_EVT_CAMS                         (1<<0)       // Events of registers CAMs and SYNCs
 #define B_EVT_IN0                          (1<<1)       // Event of register INPUT0
+#define B_EVT_SCHED                        (1<<2)       // Event of register SCHED_WINDOWS
+#define B_EVT_MOTORS                       (1<<3)       // Event of register MOTORS_MOVING
+#define B_EVT_UNDERRUN                     (1<<4)       // Event of register MOTORS_UNDERRUN
+#define B_EVT_CHANNELS                     (1<<5)       // Event of register CHANNEL_STATE
+#define B_EVT_CONFIG                       (1<<6)       // Event of register CONFIG_COMMIT
+#define B_EVT_JITTER                       (1<<7)       // Event of register JITTER_STATS
+#define MSK_MMODE_PROFILE                  (1<<0)       // Servo motor motion profiles
+#define GM_MMODE_PROFILE_TRAPEZOIDAL       (0<<0)       // Constant acceleration up to the maximum velocity
+#define GM_MMODE_PROFILE_SCURVE            (1<<0)       // Smooth velocity and acceleration
+#define B_SCHED_CAM0                       (1<<0)       // Camera 0 acquisition schedule
+#define B_SCHED_CAM1                       (1<<1)       // Camera 1 acquisition schedule
+#define B_TRIG_CAM0                        (1<<0)       // Single trigger pulse on camera 0
+#define B_TRIG_CAM1                        (1<<1)       // Single trigger pulse on camera 1
+#define GM_COMMIT_DISCARD                  0            // Drops the staged writes
+#define GM_COMMIT_NOW                      1            // Applies the staged writes at once
+#define GM_COMMIT_NEXT_SECOND              2            // Applies the staged writes on the next Harp second
+#define GM_JITTER_OFF                      0            // No trigger period measurement
+#define GM_JITTER_CAM0                     1            // Measures the camera 0 trigger period
+#define GM_JITTER_CAM1                     2            // Measures the camera 1 trigger period
+#define TIMER_TCC0                         0            // Index of TCC0 in TIMER_OWNERS, drives CAM0 TRIG
+#define TIMER_TCC1                         1            // Index of TCC1 in TIMER_OWNERS, always held by the core
+#define TIMER_TCD0                         2            // Index of TCD0 in TIMER_OWNERS, drives CAM1 TRIG
+#define TIMER_TCD1                         3            // Index of TCD1 in TIMER_OWNERS, no output on the lines
+#define TIMER_TCE0                         4            // Index of TCE0 in TIMER_OWNERS, no output on the lines
+#define GM_TIMER_OWNER_FREE                0            // The timer is stopped
+#define GM_TIMER_OWNER_CAMERA              1            // Camera triggers at a configured frequency
+#define GM_TIMER_OWNER_SERVO               2            // Servo motor PWM
+#define GM_TIMER_OWNER_EXT_CLK             3            // Camera triggers from DI0 or the DI0 period measurement
+#define GM_TIMER_OWNER_SEQUENCE            4            // Camera triggers with a sequence of intervals
+#define GM_TIMER_OWNER_CLK_DISCIPLINE      5            // Local clock measurement for the clock discipline
+#define GM_TIMER_OWNER_SOFT_TRIG           6            // Single software trigger pulse
+#define GM_TIMER_OWNER_JITTER              7            // Trigger period measurement through the loopback
+#define GM_TIMER_OWNER_CORE                8            // Harp timestamp and 500 us timer, never used by the application
+#define GM_CHANNEL_IDLE                    0            // The line is stopped
+#define GM_CHANNEL_STARTING                1            // A start is waiting for the stop in progress
+#define GM_CHANNEL_RUNNING                 2            // Camera triggers are running
+#define GM_CHANNEL_STOPPING                3            // Camera triggers stop after the current pulse
+#define GM_CHANNEL_SERVO                   4            // Servo motor PWM is running
+
 
 #endif /* _APP_REGS_H_ */
\ No newline at end of file
@@ -0,0 +1,488 @@
+/* Generated from device.yml by Generators/RegisterTables.tt. Don't edit */
+/* this file, change device.yml and build the Generators project.        */
+#ifndef _APP_REGS_TABLES_H_
+#define _APP_REGS_TABLES_H_
+
+/* Registers described in device.yml */
+#define YML_REGS_ADD_MIN                    32
+#define YML_REGS_ADD_MAX                    117
+#define YML_NBYTES_OF_REG_BANK              467
+
+/* Initializer of app_regs_type */
+#define YML_REGS_TYPE \
+	TYPE_U8,    /*  32 CameraStart */ \
+	TYPE_U8,    /*  33 CameraStop */ \
+	TYPE_U8,    /*  34 ServoEnable */ \
+	TYPE_U8,    /*  35 ServoDisable */ \
+	TYPE_U8,    /*  36 OutputSet */ \
+	TYPE_U8,    /*  37 OutputClear */ \
+	TYPE_U8,    /*  38 OutputState */ \
+	TYPE_U8,    /*  39 DigitalInputState */ \
+	TYPE_U8,    /*  40 Camera0Trigger */ \
+	TYPE_U8,    /*  41 Camera1Trigger */ \
+	TYPE_U8,    /*  42 Camera0Sync */ \
+	TYPE_U8,    /*  43 Camera1Sync */ \
+	TYPE_U8,    /*  44 ServoState */ \
+	TYPE_U8,    /*  45 Reserved0 */ \
+	TYPE_U8,    /*  46 SyncInterval */ \
+	TYPE_U8,    /*  47 Reserved1 */ \
+	TYPE_U8,    /*  48 DI0Mode */ \
+	TYPE_U8,    /*  49 Control0Mode */ \
+	TYPE_U16,   /*  50 Camera0Frequency */ \
+	TYPE_U16,   /*  51 Servo0Period */ \
+	TYPE_U16,   /*  52 Servo0PulseWidth */ \
+	TYPE_U8,    /*  53 Control1Mode */ \
+	TYPE_U16,   /*  54 Camera1Frequency */ \
+	TYPE_U16,   /*  55 Servo1Period */ \
+	TYPE_U16,   /*  56 Servo1PulseWidth */ \
+	TYPE_U8,    /*  57 Reserved2 */ \
+	TYPE_U8,    /*  58 Reserved3 */ \
+	TYPE_U8,    /*  59 EnableEvents */ \
+	TYPE_U8,    /*  60 Camera0ClockDivider */ \
+	TYPE_U8,    /*  61 Camera0ClockMultiplier */ \
+	TYPE_U16,   /*  62 Camera0TriggerDelay */ \
+	TYPE_U16,   /*  63 Camera0TriggerWidth */ \
+	TYPE_U8,    /*  64 Camera1ClockDivider */ \
+	TYPE_U8,    /*  65 Camera1ClockMultiplier */ \
+	TYPE_U16,   /*  66 Camera1TriggerDelay */ \
+	TYPE_U16,   /*  67 Camera1TriggerWidth */ \
+	TYPE_U8,    /*  68 ClockDiscipline */ \
+	TYPE_I32,   /*  69 ClockDriftStats */ \
+	TYPE_U16,   /*  70 Camera0Sequence */ \
+	TYPE_U8,    /*  71 Camera0SequenceLength */ \
+	TYPE_U8,    /*  72 Camera0SequenceRepeat */ \
+	TYPE_U16,   /*  73 Camera1Sequence */ \
+	TYPE_U8,    /*  74 Camera1SequenceLength */ \
+	TYPE_U8,    /*  75 Camera1SequenceRepeat */ \
+	TYPE_U8,    /*  76 ScheduleEnable */ \
+	TYPE_U8,    /*  77 ScheduleWindows */ \
+	TYPE_U32,   /*  78 Camera0SchedulePeriod */ \
+	TYPE_U32,   /*  79 Camera0Schedule */ \
+	TYPE_U32,   /*  80 Camera1SchedulePeriod */ \
+	TYPE_U32,   /*  81 Camera1Schedule */ \
+	TYPE_U16,   /*  82 Servo0Target */ \
+	TYPE_U16,   /*  83 Servo0MaxVelocity */ \
+	TYPE_U16,   /*  84 Servo0Acceleration */ \
+	TYPE_U8,    /*  85 Servo0Profile */ \
+	TYPE_U16,   /*  86 Servo1Target */ \
+	TYPE_U16,   /*  87 Servo1MaxVelocity */ \
+	TYPE_U16,   /*  88 Servo1Acceleration */ \
+	TYPE_U8,    /*  89 Servo1Profile */ \
+	TYPE_U8,    /*  90 ServoMoving */ \
+	TYPE_U16,   /*  91 Servo0Waypoints */ \
+	TYPE_U8,    /*  92 Servo0WaypointCount */ \
+	TYPE_U16,   /*  93 Servo1Waypoints */ \
+	TYPE_U8,    /*  94 Servo1WaypointCount */ \
+	TYPE_U8,    /*  95 ServoPlay */ \
+	TYPE_U8,    /*  96 ServoPlayOnDI0 */ \
+	TYPE_U16,   /*  97 Servo0PulseWidthFine */ \
+	TYPE_U16,   /*  98 Servo1PulseWidthFine */ \
+	TYPE_U16,   /*  99 Servo0SetpointFifo */ \
+	TYPE_U16,   /* 100 Servo1SetpointFifo */ \
+	TYPE_U16,   /* 101 ServoUnderruns */ \
+	TYPE_U8,    /* 102 TimerOwners */ \
+	TYPE_U8,    /* 103 ServoAlign */ \
+	TYPE_U8,    /* 104 ChannelState */ \
+	TYPE_U8,    /* 105 CameraSoftTrigger */ \
+	TYPE_U8,    /* 106 ConfigStage */ \
+	TYPE_U8,    /* 107 ConfigCommit */ \
+	TYPE_U8,    /* 108 Snapshot */ \
+	TYPE_U8,    /* 109 OutputInvert */ \
+	TYPE_U16,   /* 110 IsrProfile */ \
+	TYPE_U8,    /* 111 IsrProfileReset */ \
+	TYPE_U8,    /* 112 TriggerJitterMode */ \
+	TYPE_U16,   /* 113 TriggerJitterThreshold */ \
+	TYPE_U32,   /* 114 TriggerJitterStats */ \
+	TYPE_U16,   /* 115 StackFree */ \
+	TYPE_U16,   /* 116 ExternalClockSkips */ \
+	TYPE_U8     /* 117 IsrProfileSlot */
+
+/* Initializer of app_regs_n_elements */
+#define YML_REGS_N_ELEMENTS \
+	1,   /*  32 CameraStart */ \
+	1,   /*  33 CameraStop */ \
+	1,   /*  34 ServoEnable */ \
+	1,   /*  35 ServoDisable */ \
+	1,   /*  36 OutputSet */ \
+	1,   /*  37 OutputClear */ \
+	1,   /*  38 OutputState */ \
+	1,   /*  39 DigitalInputState */ \
+	1,   /*  40 Camera0Trigger */ \
+	1,   /*  41 Camera1Trigger */ \
+	1,   /*  42 Camera0Sync */ \
+	1,   /*  43 Camera1Sync */ \
+	1,   /*  44 ServoState */ \
+	1,   /*  45 Reserved0 */ \
+	1,   /*  46 SyncInterval */ \
+	1,   /*  47 Reserved1 */ \
+	1,   /*  48 DI0Mode */ \
+	1,   /*  49 Control0Mode */ \
+	1,   /*  50 Camera0Frequency */ \
+	1,   /*  51 Servo0Period */ \
+	1,   /*  52 Servo0PulseWidth */ \
+	1,   /*  53 Control1Mode */ \
+	1,   /*  54 Camera1Frequency */ \
+	1,   /*  55 Servo1Period */ \
+	1,   /*  56 Servo1PulseWidth */ \
+	1,   /*  57 Reserved2 */ \
+	1,   /*  58 Reserved3 */ \
+	1,   /*  59 EnableEvents */ \
+	1,   /*  60 Camera0ClockDivider */ \
+	1,   /*  61 Camera0ClockMultiplier */ \
+	1,   /*  62 Camera0TriggerDelay */ \
+	1,   /*  63 Camera0TriggerWidth */ \
+	1,   /*  64 Camera1ClockDivider */ \
+	1,   /*  65 Camera1ClockMultiplier */ \
+	1,   /*  66 Camera1TriggerDelay */ \
+	1,   /*  67 Camera1TriggerWidth */ \
+	1,   /*  68 ClockDiscipline */ \
+	4,   /*  69 ClockDriftStats */ \
+	16,  /*  70 Camera0Sequence */ \
+	1,   /*  71 Camera0SequenceLength */ \
+	1,   /*  72 Camera0SequenceRepeat */ \
+	16,  /*  73 Camera1Sequence */ \
+	1,   /*  74 Camera1SequenceLength */ \
+	1,   /*  75 Camera1SequenceRepeat */ \
+	1,   /*  76 ScheduleEnable */ \
+	1,   /*  77 ScheduleWindows */ \
+	1,   /*  78 Camera0SchedulePeriod */ \
+	12,  /*  79 Camera0Schedule */ \
+	1,   /*  80 Camera1SchedulePeriod */ \
+	12,  /*  81 Camera1Schedule */ \
+	1,   /*  82 Servo0Target */ \
+	1,   /*  83 Servo0MaxVelocity */ \
+	1,   /*  84 Servo0Acceleration */ \
+	1,   /*  85 Servo0Profile */ \
+	1,   /*  86 Servo1Target */ \
+	1,   /*  87 Servo1MaxVelocity */ \
+	1,   /*  88 Servo1Acceleration */ \
+	1,   /*  89 Servo1Profile */ \
+	1,   /*  90 ServoMoving */ \
+	16,  /*  91 Servo0Waypoints */ \
+	1,   /*  92 Servo0WaypointCount */ \
+	16,  /*  93 Servo1Waypoints */ \
+	1,   /*  94 Servo1WaypointCount */ \
+	1,   /*  95 ServoPlay */ \
+	1,   /*  96 ServoPlayOnDI0 */ \
+	1,   /*  97 Servo0PulseWidthFine */ \
+	1,   /*  98 Servo1PulseWidthFine */ \
+	8,   /*  99 Servo0SetpointFifo */ \
+	8,   /* 100 Servo1SetpointFifo */ \
+	2,   /* 101 ServoUnderruns */ \
+	5,   /* 102 TimerOwners */ \
+	1,   /* 103 ServoAlign */ \
+	2,   /* 104 ChannelState */ \
+	1,   /* 105 CameraSoftTrigger */ \
+	1,   /* 106 ConfigStage */ \
+	1,   /* 107 ConfigCommit */ \
+	36,  /* 108 Snapshot */ \
+	1,   /* 109 OutputInvert */ \
+	12,  /* 110 IsrProfile */ \
+	1,   /* 111 IsrProfileReset */ \
+	1,   /* 112 TriggerJitterMode */ \
+	1,   /* 113 TriggerJitterThreshold */ \
+	6,   /* 114 TriggerJitterStats */ \
+	1,   /* 115 StackFree */ \
+	2,   /* 116 ExternalClockSkips */ \
+	1    /* 117 IsrProfileSlot */
+
+/* Initializer of app_func_rd_pointer, named after the ADD_ defines */
+#define YML_REGS_RD_FUNCS \
+	&app_read_REG_START_CAMS,          /*  32 CameraStart */ \
+	&app_read_REG_STOP_CAMS,           /*  33 CameraStop */ \
+	&app_read_REG_ENABLE_MOTORS,       /*  34 ServoEnable */ \
+	&app_read_REG_DISABLE_MOTORS,      /*  35 ServoDisable */ \
+	&app_read_REG_SET_OUTPUTS,         /*  36 OutputSet */ \
+	&app_read_REG_CLR_OUTPUTS,         /*  37 OutputClear */ \
+	&app_read_REG_OUTPUTS,             /*  38 OutputState */ \
+	&app_read_REG_INPUT0,              /*  39 DigitalInputState */ \
+	&app_read_REG_CAM0,                /*  40 Camera0Trigger */ \
+	&app_read_REG_CAM1,                /*  41 Camera1Trigger */ \
+	&app_read_REG_SYNC0,               /*  42 Camera0Sync */ \
+	&app_read_REG_SYNC1,               /*  43 Camera1Sync */ \
+	&app_read_REG_MOTORS_STATE,        /*  44 ServoState */ \
+	&app_read_REG_RESERVED0,           /*  45 Reserved0 */ \
+	&app_read_REG_SYNC_INTERVAL,       /*  46 SyncInterval */ \
+	&app_read_REG_RESERVED1,           /*  47 Reserved1 */ \
+	&app_read_REG_IN0_MODE,            /*  48 DI0Mode */ \
+	&app_read_REG_CAM0_MODE,           /*  49 Control0Mode */ \
+	&app_read_REG_CAM0_FREQ,           /*  50 Camera0Frequency */ \
+	&app_read_REG_CAM0_MMODE_PERIOD,   /*  51 Servo0Period */ \
+	&app_read_REG_CAM0_MMODE_PULSE,    /*  52 Servo0PulseWidth */ \
+	&app_read_REG_CAM1_MODE,           /*  53 Control1Mode */ \
+	&app_read_REG_CAM1_FREQ,           /*  54 Camera1Frequency */ \
+	&app_read_REG_CAM1_MMODE_PERIOD,   /*  55 Servo1Period */ \
+	&app_read_REG_CAM1_MMODE_PULSE,    /*  56 Servo1PulseWidth */ \
+	&app_read_REG_RESERVED2,           /*  57 Reserved2 */ \
+	&app_read_REG_RESERVED3,           /*  58 Reserved3 */ \
+	&app_read_REG_EVT_EN,              /*  59 EnableEvents */ \
+	&app_read_REG_CAM0_CLK_DIV,        /*  60 Camera0ClockDivider */ \
+	&app_read_REG_CAM0_CLK_MUL,        /*  61 Camera0ClockMultiplier */ \
+	&app_read_REG_CAM0_TRIG_DELAY,     /*  62 Camera0TriggerDelay */ \
+	&app_read_REG_CAM0_TRIG_WIDTH,     /*  63 Camera0TriggerWidth */ \
+	&app_read_REG_CAM1_CLK_DIV,        /*  64 Camera1ClockDivider */ \
+	&app_read_REG_CAM1_CLK_MUL,        /*  65 Camera1ClockMultiplier */ \
+	&app_read_REG_CAM1_TRIG_DELAY,     /*  66 Camera1TriggerDelay */ \
+	&app_read_REG_CAM1_TRIG_WIDTH,     /*  67 Camera1TriggerWidth */ \
+	&app_read_REG_CLK_DISCIPLINE,      /*  68 ClockDiscipline */ \
+	&app_read_REG_CLK_DRIFT,           /*  69 ClockDriftStats */ \
+	&app_read_REG_CAM0_SEQ,            /*  70 Camera0Sequence */ \
+	&app_read_REG_CAM0_SEQ_LEN,        /*  71 Camera0SequenceLength */ \
+	&app_read_REG_CAM0_SEQ_REPEAT,     /*  72 Camera0SequenceRepeat */ \
+	&app_read_REG_CAM1_SEQ,            /*  73 Camera1Sequence */ \
+	&app_read_REG_CAM1_SEQ_LEN,        /*  74 Camera1SequenceLength */ \
+	&app_read_REG_CAM1_SEQ_REPEAT,     /*  75 Camera1SequenceRepeat */ \
+	&app_read_REG_SCHED_EN,            /*  76 ScheduleEnable */ \
+	&app_read_REG_SCHED_WINDOWS,       /*  77 ScheduleWindows */ \
+	&app_read_REG_CAM0_SCHED_PERIOD,   /*  78 Camera0SchedulePeriod */ \
+	&app_read_REG_CAM0_SCHED,          /*  79 Camera0Schedule */ \
+	&app_read_REG_CAM1_SCHED_PERIOD,   /*  80 Camera1SchedulePeriod */ \
+	&app_read_REG_CAM1_SCHED,          /*  81 Camera1Schedule */ \
+	&app_read_REG_CAM0_MMODE_TARGET,   /*  82 Servo0Target */ \
+	&app_read_REG_CAM0_MMODE_MAX_VEL,  /*  83 Servo0MaxVelocity */ \
+	&app_read_REG_CAM0_MMODE_ACCEL,    /*  84 Servo0Acceleration */ \
+	&app_read_REG_CAM0_MMODE_PROFILE,  /*  85 Servo0Profile */ \
+	&app_read_REG_CAM1_MMODE_TARGET,   /*  86 Servo1Target */ \
+	&app_read_REG_CAM1_MMODE_MAX_VEL,  /*  87 Servo1MaxVelocity */ \
+	&app_read_REG_CAM1_MMODE_ACCEL,    /*  88 Servo1Acceleration */ \
+	&app_read_REG_CAM1_MMODE_PROFILE,  /*  89 Servo1Profile */ \
+	&app_read_REG_MOTORS_MOVING,       /*  90 ServoMoving */ \
+	&app_read_REG_CAM0_MMODE_WP,       /*  91 Servo0Waypoints */ \
+	&app_read_REG_CAM0_MMODE_WP_LEN,   /*  92 Servo0WaypointCount */ \
+	&app_read_REG_CAM1_MMODE_WP,       /*  93 Servo1Waypoints */ \
+	&app_read_REG_CAM1_MMODE_WP_LEN,   /*  94 Servo1WaypointCount */ \
+	&app_read_REG_MOTORS_PLAY,         /*  95 ServoPlay */ \
+	&app_read_REG_MOTORS_PLAY_IN0,     /*  96 ServoPlayOnDI0 */ \
+	&app_read_REG_CAM0_MMODE_PULSE_FINE,/*  97 Servo0PulseWidthFine */ \
+	&app_read_REG_CAM1_MMODE_PULSE_FINE,/*  98 Servo1PulseWidthFine */ \
+	&app_read_REG_CAM0_MMODE_FIFO,     /*  99 Servo0SetpointFifo */ \
+	&app_read_REG_CAM1_MMODE_FIFO,     /* 100 Servo1SetpointFifo */ \
+	&app_read_REG_MOTORS_UNDERRUN,     /* 101 ServoUnderruns */ \
+	&app_read_REG_TIMER_OWNERS,        /* 102 TimerOwners */ \
+	&app_read_REG_MOTORS_ALIGN,        /* 103 ServoAlign */ \
+	&app_read_REG_CHANNEL_STATE,       /* 104 ChannelState */ \
+	&app_read_REG_SOFT_TRIG,           /* 105 CameraSoftTrigger */ \
+	&app_read_REG_CONFIG_STAGE,        /* 106 ConfigStage */ \
+	&app_read_REG_CONFIG_COMMIT,       /* 107 ConfigCommit */ \
+	&app_read_REG_SNAPSHOT,            /* 108 Snapshot */ \
+	&app_read_REG_OUT_INVERT,          /* 109 OutputInvert */ \
+	&app_read_REG_ISR_PROF,            /* 110 IsrProfile */ \
+	&app_read_REG_ISR_PROF_RESET,      /* 111 IsrProfileReset */ \
+	&app_read_REG_JITTER_MODE,         /* 112 TriggerJitterMode */ \
+	&app_read_REG_JITTER_THRESHOLD,    /* 113 TriggerJitterThreshold */ \
+	&app_read_REG_JITTER_STATS,        /* 114 TriggerJitterStats */ \
+	&app_read_REG_STACK_FREE,          /* 115 StackFree */ \
+	&app_read_REG_EXT_CLK_SKIPS,       /* 116 ExternalClockSkips */ \
+	&app_read_REG_ISR_PROF_SLOT        /* 117 IsrProfileSlot */
+
+/* Initializer of app_func_wr_pointer, named after the ADD_ defines */
+#define YML_REGS_WR_FUNCS \
+	&app_write_REG_START_CAMS,         /*  32 CameraStart */ \
+	&app_write_REG_STOP_CAMS,          /*  33 CameraStop */ \
+	&app_write_REG_ENABLE_MOTORS,      /*  34 ServoEnable */ \
+	&app_write_REG_DISABLE_MOTORS,     /*  35 ServoDisable */ \
+	&app_write_REG_SET_OUTPUTS,        /*  36 OutputSet */ \
+	&app_write_REG_CLR_OUTPUTS,        /*  37 OutputClear */ \
+	&app_write_REG_OUTPUTS,            /*  38 OutputState */ \
+	&app_write_REG_INPUT0,             /*  39 DigitalInputState */ \
+	&app_write_REG_CAM0,               /*  40 Camera0Trigger */ \
+	&app_write_REG_CAM1,               /*  41 Camera1Trigger */ \
+	&app_write_REG_SYNC0,              /*  42 Camera0Sync */ \
+	&app_write_REG_SYNC1,              /*  43 Camera1Sync */ \
+	&app_write_REG_MOTORS_STATE,       /*  44 ServoState */ \
+	&app_write_REG_RESERVED0,          /*  45 Reserved0 */ \
+	&app_write_REG_SYNC_INTERVAL,      /*  46 SyncInterval */ \
+	&app_write_REG_RESERVED1,          /*  47 Reserved1 */ \
+	&app_write_REG_IN0_MODE,           /*  48 DI0Mode */ \
+	&app_write_REG_CAM0_MODE,          /*  49 Control0Mode */ \
+	&app_write_REG_CAM0_FREQ,          /*  50 Camera0Frequency */ \
+	&app_write_REG_CAM0_MMODE_PERIOD,  /*  51 Servo0Period */ \
+	&app_write_REG_CAM0_MMODE_PULSE,   /*  52 Servo0PulseWidth */ \
+	&app_write_REG_CAM1_MODE,          /*  53 Control1Mode */ \
+	&app_write_REG_CAM1_FREQ,          /*  54 Camera1Frequency */ \
+	&app_write_REG_CAM1_MMODE_PERIOD,  /*  55 Servo1Period */ \
+	&app_write_REG_CAM1_MMODE_PULSE,   /*  56 Servo1PulseWidth */ \
+	&app_write_REG_RESERVED2,          /*  57 Reserved2 */ \
+	&app_write_REG_RESERVED3,          /*  58 Reserved3 */ \
+	&app_write_REG_EVT_EN,             /*  59 EnableEvents */ \
+	&app_write_REG_CAM0_CLK_DIV,       /*  60 Camera0ClockDivider */ \
+	&app_write_REG_CAM0_CLK_MUL,       /*  61 Camera0ClockMultiplier */ \
+	&app_write_REG_CAM0_TRIG_DELAY,    /*  62 Camera0TriggerDelay */ \
+	&app_write_REG_CAM0_TRIG_WIDTH,    /*  63 Camera0TriggerWidth */ \
+	&app_write_REG_CAM1_CLK_DIV,       /*  64 Camera1ClockDivider */ \
+	&app_write_REG_CAM1_CLK_MUL,       /*  65 Camera1ClockMultiplier */ \
+	&app_write_REG_CAM1_TRIG_DELAY,    /*  66 Camera1TriggerDelay */ \
+	&app_write_REG_CAM1_TRIG_WIDTH,    /*  67 Camera1TriggerWidth */ \
+	&app_write_REG_CLK_DISCIPLINE,     /*  68 ClockDiscipline */ \
+	&app_write_REG_CLK_DRIFT,          /*  69 ClockDriftStats */ \
+	&app_write_REG_CAM0_SEQ,           /*  70 Camera0Sequence */ \
+	&app_write_REG_CAM0_SEQ_LEN,       /*  71 Camera0SequenceLength */ \
+	&app_write_REG_CAM0_SEQ_REPEAT,    /*  72 Camera0SequenceRepeat */ \
+	&app_write_REG_CAM1_SEQ,           /*  73 Camera1Sequence */ \
+	&app_write_REG_CAM1_SEQ_LEN,       /*  74 Camera1SequenceLength */ \
+	&app_write_REG_CAM1_SEQ_REPEAT,    /*  75 Camera1SequenceRepeat */ \
+	&app_write_REG_SCHED_EN,           /*  76 ScheduleEnable */ \
+	&app_write_REG_SCHED_WINDOWS,      /*  77 ScheduleWindows */ \
+	&app_write_REG_CAM0_SCHED_PERIOD,  /*  78 Camera0SchedulePeriod */ \
+	&app_write_REG_CAM0_SCHED,         /*  79 Camera0Schedule */ \
+	&app_write_REG_CAM1_SCHED_PERIOD,  /*  80 Camera1SchedulePeriod */ \
+	&app_write_REG_CAM1_SCHED,         /*  81 Camera1Schedule */ \
+	&app_write_REG_CAM0_MMODE_TARGET,  /*  82 Servo0Target */ \
+	&app_write_REG_CAM0_MMODE_MAX_VEL, /*  83 Servo0MaxVelocity */ \
+	&app_write_REG_CAM0_MMODE_ACCEL,   /*  84 Servo0Acceleration */ \
+	&app_write_REG_CAM0_MMODE_PROFILE, /*  85 Servo0Profile */ \
+	&app_write_REG_CAM1_MMODE_TARGET,  /*  86 Servo1Target */ \
+	&app_write_REG_CAM1_MMODE_MAX_VEL, /*  87 Servo1MaxVelocity */ \
+	&app_write_REG_CAM1_MMODE_ACCEL,   /*  88 Servo1Acceleration */ \
+	&app_write_REG_CAM1_MMODE_PROFILE, /*  89 Servo1Profile */ \
+	&app_write_REG_MOTORS_MOVING,      /*  90 ServoMoving */ \
+	&app_write_REG_CAM0_MMODE_WP,      /*  91 Servo0Waypoints */ \
+	&app_write_REG_CAM0_MMODE_WP_LEN,  /*  92 Servo0WaypointCount */ \
+	&app_write_REG_CAM1_MMODE_WP,      /*  93 Servo1Waypoints */ \
+	&app_write_REG_CAM1_MMODE_WP_LEN,  /*  94 Servo1WaypointCount */ \
+	&app_write_REG_MOTORS_PLAY,        /*  95 ServoPlay */ \
+	&app_write_REG_MOTORS_PLAY_IN0,    /*  96 ServoPlayOnDI0 */ \
+	&app_write_REG_CAM0_MMODE_PULSE_FINE,/*  97 Servo0PulseWidthFine */ \
+	&app_write_REG_CAM1_MMODE_PULSE_FINE,/*  98 Servo1PulseWidthFine */ \
+	&app_write_REG_CAM0_MMODE_FIFO,    /*  99 Servo0SetpointFifo */ \
+	&app_write_REG_CAM1_MMODE_FIFO,    /* 100 Servo1SetpointFifo */ \
+	&app_write_REG_MOTORS_UNDERRUN,    /* 101 ServoUnderruns */ \
+	&app_write_REG_TIMER_OWNERS,       /* 102 TimerOwners */ \
+	&app_write_REG_MOTORS_ALIGN,       /* 103 ServoAlign */ \
+	&app_write_REG_CHANNEL_STATE,      /* 104 ChannelState */ \
+	&app_write_REG_SOFT_TRIG,          /* 105 CameraSoftTrigger */ \
+	&app_write_REG_CONFIG_STAGE,       /* 106 ConfigStage */ \
+	&app_write_REG_CONFIG_COMMIT,      /* 107 ConfigCommit */ \
+	&app_write_REG_SNAPSHOT,           /* 108 Snapshot */ \
+	&app_write_REG_OUT_INVERT,         /* 109 OutputInvert */ \
+	&app_write_REG_ISR_PROF,           /* 110 IsrProfile */ \
+	&app_write_REG_ISR_PROF_RESET,     /* 111 IsrProfileReset */ \
+	&app_write_REG_JITTER_MODE,        /* 112 TriggerJitterMode */ \
+	&app_write_REG_JITTER_THRESHOLD,   /* 113 TriggerJitterThreshold */ \
+	&app_write_REG_JITTER_STATS,       /* 114 TriggerJitterStats */ \
+	&app_write_REG_STACK_FREE,         /* 115 StackFree */ \
+	&app_write_REG_EXT_CLK_SKIPS,      /* 116 ExternalClockSkips */ \
+	&app_write_REG_ISR_PROF_SLOT       /* 117 IsrProfileSlot */
+
+/* Initializer of app_regs_check, mask, min and max of each element */
+#define YML_REGS_CHECK \
+	{0x03, 0, 0xFF},                   /*  32 CameraStart */ \
+	{0x03, 0, 0xFF},                   /*  33 CameraStop */ \
+	{0x03, 0, 0xFF},                   /*  34 ServoEnable */ \
+	{0x03, 0, 0xFF},                   /*  35 ServoDisable */ \
+	{0x0F, 0, 0xFF},                   /*  36 OutputSet */ \
+	{0x0F, 0, 0xFF},                   /*  37 OutputClear */ \
+	{0x0F, 0, 0xFF},                   /*  38 OutputState */ \
+	{0x01, 0, 0xFF},                   /*  39 DigitalInputState */ \
+	{0xFF, 0, 0xFF},                   /*  40 Camera0Trigger */ \
+	{0xFF, 0, 0xFF},                   /*  41 Camera1Trigger */ \
+	{0xFF, 0, 0xFF},                   /*  42 Camera0Sync */ \
+	{0xFF, 0, 0xFF},                   /*  43 Camera1Sync */ \
+	{0x03, 0, 0xFF},                   /*  44 ServoState */ \
+	{0xFF, 0, 0xFF},                   /*  45 Reserved0 */ \
+	{0xFF, 0, 0xFF},                   /*  46 SyncInterval */ \
+	{0xFF, 0, 0xFF},                   /*  47 Reserved1 */ \
+	{0xFF, 0, 6},                      /*  48 DI0Mode */ \
+	{0xFF, 0, 4},                      /*  49 Control0Mode */ \
+	{0xFFFF, 1, 1000},                 /*  50 Camera0Frequency */ \
+	{0xFFFF, 0, 0xFFFF},               /*  51 Servo0Period */ \
+	{0xFFFF, 0, 0xFFFF},               /*  52 Servo0PulseWidth */ \
+	{0xFF, 0, 4},                      /*  53 Control1Mode */ \
+	{0xFFFF, 1, 1000},                 /*  54 Camera1Frequency */ \
+	{0xFFFF, 0, 0xFFFF},               /*  55 Servo1Period */ \
+	{0xFFFF, 0, 0xFFFF},               /*  56 Servo1PulseWidth */ \
+	{0xFF, 0, 0xFF},                   /*  57 Reserved2 */ \
+	{0xFF, 0, 0xFF},                   /*  58 Reserved3 */ \
+	{0xFF, 0, 0xFF},                   /*  59 EnableEvents */ \
+	{0xFF, 1, 0xFF},                   /*  60 Camera0ClockDivider */ \
+	{0xFF, 1, 64},                     /*  61 Camera0ClockMultiplier */ \
+	{0xFFFF, 20, 0xFFFF},              /*  62 Camera0TriggerDelay */ \
+	{0xFFFF, 1, 0xFFFF},               /*  63 Camera0TriggerWidth */ \
+	{0xFF, 1, 0xFF},                   /*  64 Camera1ClockDivider */ \
+	{0xFF, 1, 64},                     /*  65 Camera1ClockMultiplier */ \
+	{0xFFFF, 20, 0xFFFF},              /*  66 Camera1TriggerDelay */ \
+	{0xFFFF, 1, 0xFFFF},               /*  67 Camera1TriggerWidth */ \
+	{0xFF, 0, 1},                      /*  68 ClockDiscipline */ \
+	{0xFFFFFFFF, 0, 0xFFFFFFFF},       /*  69 ClockDriftStats */ \
+	{0xFFFF, 0, 0xFFFF},               /*  70 Camera0Sequence */ \
+	{0xFF, 1, 16},                     /*  71 Camera0SequenceLength */ \
+	{0xFF, 0, 0xFF},                   /*  72 Camera0SequenceRepeat */ \
+	{0xFFFF, 0, 0xFFFF},               /*  73 Camera1Sequence */ \
+	{0xFF, 1, 16},                     /*  74 Camera1SequenceLength */ \
+	{0xFF, 0, 0xFF},                   /*  75 Camera1SequenceRepeat */ \
+	{0x03, 0, 0xFF},                   /*  76 ScheduleEnable */ \
+	{0x03, 0, 0xFF},                   /*  77 ScheduleWindows */ \
+	{0xFFFFFFFF, 1, 0xFFFFFFFF},       /*  78 Camera0SchedulePeriod */ \
+	{0xFFFFFFFF, 0, 0xFFFFFFFF},       /*  79 Camera0Schedule */ \
+	{0xFFFFFFFF, 1, 0xFFFFFFFF},       /*  80 Camera1SchedulePeriod */ \
+	{0xFFFFFFFF, 0, 0xFFFFFFFF},       /*  81 Camera1Schedule */ \
+	{0xFFFF, 2, 0xFFFF},               /*  82 Servo0Target */ \
+	{0xFFFF, 0, 0xFFFF},               /*  83 Servo0MaxVelocity */ \
+	{0xFFFF, 0, 0xFFFF},               /*  84 Servo0Acceleration */ \
+	{0xFF, 0, 1},                      /*  85 Servo0Profile */ \
+	{0xFFFF, 2, 0xFFFF},               /*  86 Servo1Target */ \
+	{0xFFFF, 0, 0xFFFF},               /*  87 Servo1MaxVelocity */ \
+	{0xFFFF, 0, 0xFFFF},               /*  88 Servo1Acceleration */ \
+	{0xFF, 0, 1},                      /*  89 Servo1Profile */ \
+	{0x03, 0, 0xFF},                   /*  90 ServoMoving */ \
+	{0xFFFF, 0, 0xFFFF},               /*  91 Servo0Waypoints */ \
+	{0xFF, 1, 8},                      /*  92 Servo0WaypointCount */ \
+	{0xFFFF, 0, 0xFFFF},               /*  93 Servo1Waypoints */ \
+	{0xFF, 1, 8},                      /*  94 Servo1WaypointCount */ \
+	{0x03, 0, 0xFF},                   /*  95 ServoPlay */ \
+	{0x03, 0, 0xFF},                   /*  96 ServoPlayOnDI0 */ \
+	{0xFFFF, 0, 0xFFFF},               /*  97 Servo0PulseWidthFine */ \
+	{0xFFFF, 0, 0xFFFF},               /*  98 Servo1PulseWidthFine */ \
+	{0xFFFF, 0, 0xFFFF},               /*  99 Servo0SetpointFifo */ \
+	{0xFFFF, 0, 0xFFFF},               /* 100 Servo1SetpointFifo */ \
+	{0xFFFF, 0, 0xFFFF},               /* 101 ServoUnderruns */ \
+	{0xFF, 0, 0xFF},                   /* 102 TimerOwners */ \
+	{0x03, 0, 0xFF},                   /* 103 ServoAlign */ \
+	{0xFF, 0, 0xFF},                   /* 104 ChannelState */ \
+	{0x03, 0, 0xFF},                   /* 105 CameraSoftTrigger */ \
+	{0xFF, 0, 0xFF},                   /* 106 ConfigStage */ \
+	{0xFF, 0, 2},                      /* 107 ConfigCommit */ \
+	{0xFF, 0, 0xFF},                   /* 108 Snapshot */ \
+	{0x0F, 0, 0xFF},                   /* 109 OutputInvert */ \
+	{0xFFFF, 0, 0xFFFF},               /* 110 IsrProfile */ \
+	{0xFF, 0, 0xFF},                   /* 111 IsrProfileReset */ \
+	{0xFF, 0, 2},                      /* 112 TriggerJitterMode */ \
+	{0xFFFF, 0, 0xFFFF},               /* 113 TriggerJitterThreshold */ \
+	{0xFFFFFFFF, 0, 0xFFFFFFFF},       /* 114 TriggerJitterStats */ \
+	{0xFFFF, 0, 0xFFFF},               /* 115 StackFree */ \
+	{0xFFFF, 0, 0xFFFF},               /* 116 ExternalClockSkips */ \
+	{0xFF, 0, 5}                       /* 117 IsrProfileSlot */
+
+/* Ranges accepted by the registers */
+#define CAMERA0_FREQUENCY_MIN               1
+#define CAMERA0_FREQUENCY_MAX               1000
+#define CAMERA1_FREQUENCY_MIN               1
+#define CAMERA1_FREQUENCY_MAX               1000
+#define CAMERA0_CLOCK_DIVIDER_MIN           1
+#define CAMERA0_CLOCK_DIVIDER_MAX           255
+#define CAMERA0_CLOCK_MULTIPLIER_MIN        1
+#define CAMERA0_CLOCK_MULTIPLIER_MAX        64
+#define CAMERA0_TRIGGER_DELAY_MIN           20
+#define CAMERA0_TRIGGER_WIDTH_MIN           1
+#define CAMERA1_CLOCK_DIVIDER_MIN           1
+#define CAMERA1_CLOCK_DIVIDER_MAX           255
+#define CAMERA1_CLOCK_MULTIPLIER_MIN        1
+#define CAMERA1_CLOCK_MULTIPLIER_MAX        64
+#define CAMERA1_TRIGGER_DELAY_MIN           20
+#define CAMERA1_TRIGGER_WIDTH_MIN           1
+#define CAMERA0_SEQUENCE_LENGTH_MIN         1
+#define CAMERA0_SEQUENCE_LENGTH_MAX         16
+#define CAMERA1_SEQUENCE_LENGTH_MIN         1
+#define CAMERA1_SEQUENCE_LENGTH_MAX         16
+#define CAMERA0_SCHEDULE_PERIOD_MIN         1
+#define CAMERA1_SCHEDULE_PERIOD_MIN         1
+#define SERVO0_TARGET_MIN                   2
+#define SERVO1_TARGET_MIN                   2
+#define SERVO0_WAYPOINT_COUNT_MIN           1
+#define SERVO0_WAYPOINT_COUNT_MAX           8
+#define SERVO1_WAYPOINT_COUNT_MIN           1
+#define SERVO1_WAYPOINT_COUNT_MAX           8
+#define ISR_PROFILE_SLOT_MIN                0
+#define ISR_PROFILE_SLOT_MAX                5
+
+#endif /* _APP_REGS_TABLES_H_ */
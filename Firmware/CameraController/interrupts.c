@@ -29,8 +29,9 @@ extern AppRegs app_regs;
 /************************************************************************/ 
 /* INPUT0                                                               */
 /************************************************************************/
-extern void start_camera0(void);
-extern void start_camera1(void);
+extern void start_camera0(uint16_t freq);
+extern void start_camera1(uint16_t freq);
+extern uint16_t camera0_freq_host, camera1_freq_host;
 extern void stop_camera0(void);
 extern void stop_camera1(void);
 extern void enable_motor0(void);
@@ -38,89 +39,191 @@ extern void enable_motor1(void);
 extern void disable_motor0(void);
 extern void disable_motor1(void);
 
+extern bool ext_clock_in_use;
+extern void ext_clock_rising_edge(void);
+extern void servo_trajectory_rising_edge(void);
+
+/* The naked ISRs don't save the call-saved registers, so no local is   */
+/* kept across a call and the state is read again after each one.       */
+#define trig0_is_camera ((app_regs.REG_CAM0_MODE & MSK_CAM0_MODE) == GM_CAM0_MODE_CAM)
+#define trig1_is_camera ((app_regs.REG_CAM1_MODE & MSK_CAM1_MODE) == GM_CAM1_MODE_CAM)
+#define trig0_is_servo  ((app_regs.REG_CAM0_MODE & MSK_CAM0_MODE) == GM_CAM0_MODE_MOTOR)
+#define trig1_is_servo  ((app_regs.REG_CAM1_MODE & MSK_CAM1_MODE) == GM_CAM1_MODE_MOTOR)
+
 ISR(PORTA_INT0_vect, ISR_NAKED)
 {
+	isr_prof_start(ISR_PROF_IN0);
+	
+	if (ext_clock_in_use)
+	{
+		ext_clock_rising_edge();
+	}
+	
+	if (app_regs.REG_MOTORS_PLAY_IN0 && read_INPUT0)
+	{
+		servo_trajectory_rising_edge();
+	}
+	
 	if (app_regs.REG_EVT_EN & B_EVT_IN0)
 	{
 		app_regs.REG_INPUT0 = read_INPUT0 ? B_IN0 : 0;
 		core_func_send_event(ADD_REG_INPUT0, true);
 	}
 
-	if (app_regs.REG_IN0_MODE != GM_IN0_NOT_USED)
+	/* DI0 only senses the rising edge while used as external clock */
+	if (app_regs.REG_IN0_MODE != GM_IN0_NOT_USED && !ext_clock_in_use)
 	{
-		bool trig0_is_camera = ((app_regs.REG_CAM0_MODE & MSK_CAM0_MODE) == GM_CAM0_MODE_CAM);
-		bool trig1_is_camera = ((app_regs.REG_CAM1_MODE & MSK_CAM1_MODE) == GM_CAM1_MODE_CAM);
-
 		if (read_INPUT0)	// Input 0 is high level
 		{
 			if (app_regs.REG_IN0_MODE == GM_IN0_H_CAM0) {
-				if (trig0_is_camera) start_camera0();	else enable_motor0(); }
+				if (trig0_is_camera) start_camera0(camera0_freq_host);	else if (trig0_is_servo) enable_motor0(); }
 				
 			if (app_regs.REG_IN0_MODE == GM_IN0_H_CAM1) {
-				if (trig1_is_camera) start_camera1();	else enable_motor1(); }
+				if (trig1_is_camera) start_camera1(camera1_freq_host);	else if (trig1_is_servo) enable_motor1(); }
 			
 			if (app_regs.REG_IN0_MODE == GM_IN0_H_BOTH)
 			{
-				if (trig0_is_camera) start_camera0();	else enable_motor0();
-				if (trig1_is_camera) start_camera1();	else enable_motor1();
+				if (trig0_is_camera) start_camera0(camera0_freq_host);	else if (trig0_is_servo) enable_motor0();
+				if (trig1_is_camera) start_camera1(camera1_freq_host);	else if (trig1_is_servo) enable_motor1();
 			}
 			
 			if (app_regs.REG_IN0_MODE == GM_IN0_L_CAM0) {
-				if (trig0_is_camera) stop_camera0();	else disable_motor0(); }
+				if (trig0_is_camera) stop_camera0();	else if (trig0_is_servo) disable_motor0(); }
 			
 			if (app_regs.REG_IN0_MODE == GM_IN0_L_CAM1) {
-				if (trig1_is_camera) stop_camera1();	else disable_motor1(); }
+				if (trig1_is_camera) stop_camera1();	else if (trig1_is_servo) disable_motor1(); }
 			
 			if (app_regs.REG_IN0_MODE == GM_IN0_L_BOTH)
 			{
-				if (trig0_is_camera) stop_camera0();	else disable_motor0();
-				if (trig1_is_camera) stop_camera1();	else disable_motor1();
+				if (trig0_is_camera) stop_camera0();	else if (trig0_is_servo) disable_motor0();
+				if (trig1_is_camera) stop_camera1();	else if (trig1_is_servo) disable_motor1();
 			}
 		}
 		else   // Input 0 is low level
 		{
 			
 			if (app_regs.REG_IN0_MODE == GM_IN0_H_CAM0) {
-				if (trig0_is_camera) stop_camera0();	else disable_motor0(); }
+				if (trig0_is_camera) stop_camera0();	else if (trig0_is_servo) disable_motor0(); }
 			
 			if (app_regs.REG_IN0_MODE == GM_IN0_H_CAM1) {
-				if (trig1_is_camera) stop_camera1();	else disable_motor1(); }
+				if (trig1_is_camera) stop_camera1();	else if (trig1_is_servo) disable_motor1(); }
 			
 			if (app_regs.REG_IN0_MODE == GM_IN0_H_BOTH)
 			{
-				if (trig0_is_camera) stop_camera0();	else disable_motor0();
-				if (trig1_is_camera) stop_camera1();	else disable_motor1();
+				if (trig0_is_camera) stop_camera0();	else if (trig0_is_servo) disable_motor0();
+				if (trig1_is_camera) stop_camera1();	else if (trig1_is_servo) disable_motor1();
 			}
 			
 			if (app_regs.REG_IN0_MODE == GM_IN0_L_CAM0) {
-				if (trig0_is_camera) start_camera0();	else enable_motor0(); }
+				if (trig0_is_camera) start_camera0(camera0_freq_host);	else if (trig0_is_servo) enable_motor0(); }
 			
 			if (app_regs.REG_IN0_MODE == GM_IN0_L_CAM1) {
-				if (trig1_is_camera) start_camera1();	else enable_motor1(); }
+				if (trig1_is_camera) start_camera1(camera1_freq_host);	else if (trig1_is_servo) enable_motor1(); }
 			
 			if (app_regs.REG_IN0_MODE == GM_IN0_L_BOTH)
 			{
-				if (trig0_is_camera) start_camera0();	else enable_motor0();
-				if (trig1_is_camera) start_camera1();	else enable_motor1();
+				if (trig0_is_camera) start_camera0(camera0_freq_host);	else if (trig0_is_servo) enable_motor0();
+				if (trig1_is_camera) start_camera1(camera1_freq_host);	else if (trig1_is_servo) enable_motor1();
 			}
 		}
 	}
 
+	isr_prof_end(ISR_PROF_IN0);
 	reti();
 }
 
 extern bool camera0_pulse;
 extern bool camera1_pulse;
+extern uint32_t camera0_triggers;
+extern uint32_t camera1_triggers;
 
-extern bool stop_cam0;
-extern bool stop_cam1;
+extern void channel_set_state(uint8_t channel, uint8_t state);
+extern bool channel_transition(uint8_t channel, uint8_t from, uint8_t to);
+extern void stop_end_camera0(void);
+extern void stop_end_camera1(void);
+
+extern bool clock_discipline_on;
+extern uint16_t camera0_base_per;
+extern uint16_t camera1_base_per;
+extern int32_t camera0_trim_q16;
+extern int32_t camera1_trim_q16;
+extern int32_t camera0_trim_acc;
+extern int32_t camera1_trim_acc;
+extern void clock_discipline_step(TC0_t* timer, uint16_t base, int32_t * acc, int32_t trim_q16);
+
+extern bool camera0_seq_running;
+extern bool camera1_seq_running;
+extern uint16_t camera0_seq_triggers;
+extern uint16_t camera1_seq_triggers;
+extern void seq_stop_after_pulse(TC0_t* timer);
+extern void seq_end_camera0(void);
+extern void seq_end_camera1(void);
+
+extern bool camera0_ext_running;
+extern bool camera1_ext_running;
+extern uint8_t camera0_ext_pulses;
+extern uint8_t camera1_ext_pulses;
+extern bool camera0_ext_one_shot;
+extern bool camera1_ext_one_shot;
+extern void ext_clock_park(TC0_t* timer, bool now);
+extern void ext_clock_end_camera0(void);
+extern void ext_clock_end_camera1(void);
+
+extern void servo_motion_step_motor0(void);
+extern void servo_motion_step_motor1(void);
+extern bool servo0_fifo_streaming;
+extern bool servo1_fifo_streaming;
+
+/* Stepped only while the line runs the servo, a camera takes the timer  */
+/* over. Read again after each call, as the naked ISR keeps no locals.   */
+#define servo0_stepping ((app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_SERVO) && ((app_regs.REG_MOTORS_MOVING & B_MOTOR0) || servo0_fifo_streaming))
 
 ISR(TCC0_OVF_vect, ISR_NAKED)
 {
-	if (camera0_pulse)
+	isr_prof_start(ISR_PROF_TCC0_OVF);
+	
+	if (clock_discipline_on && !camera0_seq_running && !camera0_ext_running && !servo0_stepping)
+		clock_discipline_step(&TCC0, camera0_base_per, &camera0_trim_acc, camera0_trim_q16);
+	
+	if (servo0_stepping)
+	{
+		/* The servo motor is following a motion profile or streaming setpoints */
+		servo_motion_step_motor0();
+	}
+	else if (camera0_ext_running)
+	{
+		/* The compare output ended a trigger pulse */
+		if (camera0_ext_pulses)
+		{
+			if (--camera0_ext_pulses == 1)
+				ext_clock_park(&TCC0, false);					// Only the last pulse is left
+			
+			if (camera0_ext_pulses == 0 && (camera0_ext_one_shot || app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_STOPPING || app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_STARTING))
+				ext_clock_end_camera0();
+		}
+	}
+	else if (camera0_seq_running)
+	{
+		/* The trigger pin was set by hardware and the DMA is loading the next interval */
+		camera0_triggers++;
+		
+		if (app_regs.REG_EVT_EN & B_EVT_CAMS)
+		{
+			app_regs.REG_CAM0 = 1;
+			core_func_send_event(ADD_REG_CAM0, true);
+		}
+		
+		if (camera0_seq_triggers && --camera0_seq_triggers == 0)
+		{
+			channel_transition(0, GM_CHANNEL_RUNNING, GM_CHANNEL_STOPPING);
+			seq_stop_after_pulse(&TCC0);
+		}
+	}
+	else if (camera0_pulse)
 	{
 		camera0_pulse = false;
 		set_CAM0_TRIG;
+		camera0_triggers++;
 		
 		if (app_regs.REG_EVT_EN & B_EVT_CAMS)
 		{
@@ -132,33 +235,63 @@ ISR(TCC0_OVF_vect, ISR_NAKED)
 	{
 		camera0_pulse = true;
 		clr_CAM0_TRIG;
-        
-        if (stop_cam0)
-        {
-            stop_cam0 = false;
-            
-            if (read_CAM0_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
-            {
-                app_regs.REG_SYNC0 = 0;
-                core_func_send_event(ADD_REG_SYNC0, true);
-            }
-            
-            clr_CAM0_SYNC;
-            clr_CAM0_TRIG;
-
-            timer_type0_stop(&TCC0);          
-        }        
+		
+		if (app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_STOPPING || app_regs.REG_CHANNEL_STATE[0] == GM_CHANNEL_STARTING)
+			stop_end_camera0();
 	}
 
+	isr_prof_end(ISR_PROF_TCC0_OVF);
 	reti();
 }
 
+#define servo1_stepping ((app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_SERVO) && ((app_regs.REG_MOTORS_MOVING & B_MOTOR1) || servo1_fifo_streaming))
+
 ISR(TCD0_OVF_vect, ISR_NAKED)
 {
-	if (camera1_pulse)
+	isr_prof_start(ISR_PROF_TCD0_OVF);
+	
+	if (clock_discipline_on && !camera1_seq_running && !camera1_ext_running && !servo1_stepping)
+		clock_discipline_step(&TCD0, camera1_base_per, &camera1_trim_acc, camera1_trim_q16);
+	
+	if (servo1_stepping)
+	{
+		/* The servo motor is following a motion profile or streaming setpoints */
+		servo_motion_step_motor1();
+	}
+	else if (camera1_ext_running)
+	{
+		/* The compare output ended a trigger pulse */
+		if (camera1_ext_pulses)
+		{
+			if (--camera1_ext_pulses == 1)
+				ext_clock_park(&TCD0, false);					// Only the last pulse is left
+			
+			if (camera1_ext_pulses == 0 && (camera1_ext_one_shot || app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_STOPPING || app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_STARTING))
+				ext_clock_end_camera1();
+		}
+	}
+	else if (camera1_seq_running)
+	{
+		/* The trigger pin was set by hardware and the DMA is loading the next interval */
+		camera1_triggers++;
+		
+		if (app_regs.REG_EVT_EN & B_EVT_CAMS)
+		{
+			app_regs.REG_CAM1 = 1;
+			core_func_send_event(ADD_REG_CAM1, true);
+		}
+		
+		if (camera1_seq_triggers && --camera1_seq_triggers == 0)
+		{
+			channel_transition(1, GM_CHANNEL_RUNNING, GM_CHANNEL_STOPPING);
+			seq_stop_after_pulse(&TCD0);
+		}
+	}
+	else if (camera1_pulse)
 	{
 		camera1_pulse = false;
 		set_CAM1_TRIG;
+		camera1_triggers++;
 		
 		if (app_regs.REG_EVT_EN & B_EVT_CAMS)
 		{
@@ -171,22 +304,101 @@ ISR(TCD0_OVF_vect, ISR_NAKED)
 		camera1_pulse = true;
 		clr_CAM1_TRIG;
 		
-		if (stop_cam1)
+		if (app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_STOPPING || app_regs.REG_CHANNEL_STATE[1] == GM_CHANNEL_STARTING)
+			stop_end_camera1();
+	}
+
+	isr_prof_end(ISR_PROF_TCD0_OVF);
+	reti();
+}
+
+/************************************************************************/
+/* External clock mode                                                  */
+/************************************************************************/
+extern bool camera0_soft_pulse;
+extern bool camera1_soft_pulse;
+extern void soft_trigger_end_camera0(void);
+extern void soft_trigger_end_camera1(void);
+
+ISR(TCC0_CCA_vect, ISR_NAKED)
+{
+	isr_prof_start(ISR_PROF_TCC0_CC);
+	
+	if (camera0_seq_running)
+	{
+		seq_end_camera0();
+	}
+	else if (camera0_ext_running)
+	{
+		/* The compare output started a trigger pulse */
+		camera0_triggers++;
+		
+		if (app_regs.REG_EVT_EN & B_EVT_CAMS)
+		{
+			app_regs.REG_CAM0 = 1;
+			core_func_send_event(ADD_REG_CAM0, !camera0_ext_one_shot);	// One-shot reports the DI0 edge time
+		}
+	}
+	else if (camera0_soft_pulse)
+	{
+		soft_trigger_end_camera0();
+	}
+
+	isr_prof_end(ISR_PROF_TCC0_CC);
+	reti();
+}
+
+ISR(TCD0_CCA_vect, ISR_NAKED)
+{
+	isr_prof_start(ISR_PROF_TCD0_CC);
+	
+	if (camera1_seq_running)
+	{
+		seq_end_camera1();
+	}
+	else if (camera1_ext_running)
+	{
+		/* The compare output started a trigger pulse */
+		camera1_triggers++;
+		
+		if (app_regs.REG_EVT_EN & B_EVT_CAMS)
 		{
-    		stop_cam1 = false;
-            
-		    if (read_CAM1_SYNC && (app_regs.REG_EVT_EN & B_EVT_CAMS))
-		    {
-    		    app_regs.REG_SYNC1 = 0;
-    		    core_func_send_event(ADD_REG_SYNC1, true);
-		    }
-
-		    clr_CAM1_SYNC;
-		    clr_CAM1_TRIG;
-
-		    timer_type0_stop(&TCD0);
+			app_regs.REG_CAM1 = 1;
+			core_func_send_event(ADD_REG_CAM1, !camera1_ext_one_shot);	// One-shot reports the DI0 edge time
 		}
 	}
+	else if (camera1_soft_pulse)
+	{
+		soft_trigger_end_camera1();
+	}
+
+	isr_prof_end(ISR_PROF_TCD0_CC);
+	reti();
+}
+
+/************************************************************************/ 
+/* DI0 period measurement                                               */
+/************************************************************************/
+extern void ext_clock_overflow(void);
+
+ISR(TCE0_OVF_vect, ISR_NAKED)
+{
+	ext_clock_overflow();
+	
+	reti();
+}
+
+/************************************************************************/ 
+/* Trigger jitter measurement                                           */
+/************************************************************************/
+extern void jitter_capture(uint16_t period);
 
+ISR(TCE0_CCA_vect, ISR_NAKED)
+{
+	isr_prof_start(ISR_PROF_TCE0_CC);
+	
+	jitter_capture(TCE0_CCA);
+	
+	isr_prof_end(ISR_PROF_TCE0_CC);
 	reti();
 }
\ No newline at end of file
@@ -64,7 +64,65 @@ namespace Harp.CameraController
             { 56, typeof(Servo1PulseWidth) },
             { 57, typeof(Reserved2) },
             { 58, typeof(Reserved3) },
-            { 59, typeof(EnableEvents) }
+            { 59, typeof(EnableEvents) },
+            { 60, typeof(Camera0ClockDivider) },
+            { 61, typeof(Camera0ClockMultiplier) },
+            { 62, typeof(Camera0TriggerDelay) },
+            { 63, typeof(Camera0TriggerWidth) },
+            { 64, typeof(Camera1ClockDivider) },
+            { 65, typeof(Camera1ClockMultiplier) },
+            { 66, typeof(Camera1TriggerDelay) },
+            { 67, typeof(Camera1TriggerWidth) },
+            { 68, typeof(ClockDiscipline) },
+            { 69, typeof(ClockDriftStats) },
+            { 70, typeof(Camera0Sequence) },
+            { 71, typeof(Camera0SequenceLength) },
+            { 72, typeof(Camera0SequenceRepeat) },
+            { 73, typeof(Camera1Sequence) },
+            { 74, typeof(Camera1SequenceLength) },
+            { 75, typeof(Camera1SequenceRepeat) },
+            { 76, typeof(ScheduleEnable) },
+            { 77, typeof(ScheduleWindows) },
+            { 78, typeof(Camera0SchedulePeriod) },
+            { 79, typeof(Camera0Schedule) },
+            { 80, typeof(Camera1SchedulePeriod) },
+            { 81, typeof(Camera1Schedule) },
+            { 82, typeof(Servo0Target) },
+            { 83, typeof(Servo0MaxVelocity) },
+            { 84, typeof(Servo0Acceleration) },
+            { 85, typeof(Servo0Profile) },
+            { 86, typeof(Servo1Target) },
+            { 87, typeof(Servo1MaxVelocity) },
+            { 88, typeof(Servo1Acceleration) },
+            { 89, typeof(Servo1Profile) },
+            { 90, typeof(ServoMoving) },
+            { 91, typeof(Servo0Waypoints) },
+            { 92, typeof(Servo0WaypointCount) },
+            { 93, typeof(Servo1Waypoints) },
+            { 94, typeof(Servo1WaypointCount) },
+            { 95, typeof(ServoPlay) },
+            { 96, typeof(ServoPlayOnDI0) },
+            { 97, typeof(Servo0PulseWidthFine) },
+            { 98, typeof(Servo1PulseWidthFine) },
+            { 99, typeof(Servo0SetpointFifo) },
+            { 100, typeof(Servo1SetpointFifo) },
+            { 101, typeof(ServoUnderruns) },
+            { 102, typeof(TimerOwners) },
+            { 103, typeof(ServoAlign) },
+            { 104, typeof(ChannelState) },
+            { 105, typeof(CameraSoftTrigger) },
+            { 106, typeof(ConfigStage) },
+            { 107, typeof(ConfigCommit) },
+            { 108, typeof(Snapshot) },
+            { 109, typeof(OutputInvert) },
+            { 110, typeof(IsrProfile) },
+            { 111, typeof(IsrProfileReset) },
+            { 112, typeof(TriggerJitterMode) },
+            { 113, typeof(TriggerJitterThreshold) },
+            { 114, typeof(TriggerJitterStats) },
+            { 115, typeof(StackFree) },
+            { 116, typeof(ExternalClockSkips) },
+            { 117, typeof(IsrProfileSlot) }
         };
 
         /// <summary>
@@ -152,6 +210,64 @@ namespace Harp.CameraController
     /// <seealso cref="Servo1Period"/>
     /// <seealso cref="Servo1PulseWidth"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="Camera0ClockDivider"/>
+    /// <seealso cref="Camera0ClockMultiplier"/>
+    /// <seealso cref="Camera0TriggerDelay"/>
+    /// <seealso cref="Camera0TriggerWidth"/>
+    /// <seealso cref="Camera1ClockDivider"/>
+    /// <seealso cref="Camera1ClockMultiplier"/>
+    /// <seealso cref="Camera1TriggerDelay"/>
+    /// <seealso cref="Camera1TriggerWidth"/>
+    /// <seealso cref="ClockDiscipline"/>
+    /// <seealso cref="ClockDriftStats"/>
+    /// <seealso cref="Camera0Sequence"/>
+    /// <seealso cref="Camera0SequenceLength"/>
+    /// <seealso cref="Camera0SequenceRepeat"/>
+    /// <seealso cref="Camera1Sequence"/>
+    /// <seealso cref="Camera1SequenceLength"/>
+    /// <seealso cref="Camera1SequenceRepeat"/>
+    /// <seealso cref="ScheduleEnable"/>
+    /// <seealso cref="ScheduleWindows"/>
+    /// <seealso cref="Camera0SchedulePeriod"/>
+    /// <seealso cref="Camera0Schedule"/>
+    /// <seealso cref="Camera1SchedulePeriod"/>
+    /// <seealso cref="Camera1Schedule"/>
+    /// <seealso cref="Servo0Target"/>
+    /// <seealso cref="Servo0MaxVelocity"/>
+    /// <seealso cref="Servo0Acceleration"/>
+    /// <seealso cref="Servo0Profile"/>
+    /// <seealso cref="Servo1Target"/>
+    /// <seealso cref="Servo1MaxVelocity"/>
+    /// <seealso cref="Servo1Acceleration"/>
+    /// <seealso cref="Servo1Profile"/>
+    /// <seealso cref="ServoMoving"/>
+    /// <seealso cref="Servo0Waypoints"/>
+    /// <seealso cref="Servo0WaypointCount"/>
+    /// <seealso cref="Servo1Waypoints"/>
+    /// <seealso cref="Servo1WaypointCount"/>
+    /// <seealso cref="ServoPlay"/>
+    /// <seealso cref="ServoPlayOnDI0"/>
+    /// <seealso cref="Servo0PulseWidthFine"/>
+    /// <seealso cref="Servo1PulseWidthFine"/>
+    /// <seealso cref="Servo0SetpointFifo"/>
+    /// <seealso cref="Servo1SetpointFifo"/>
+    /// <seealso cref="ServoUnderruns"/>
+    /// <seealso cref="TimerOwners"/>
+    /// <seealso cref="ServoAlign"/>
+    /// <seealso cref="ChannelState"/>
+    /// <seealso cref="CameraSoftTrigger"/>
+    /// <seealso cref="ConfigStage"/>
+    /// <seealso cref="ConfigCommit"/>
+    /// <seealso cref="Snapshot"/>
+    /// <seealso cref="OutputInvert"/>
+    /// <seealso cref="IsrProfile"/>
+    /// <seealso cref="IsrProfileReset"/>
+    /// <seealso cref="TriggerJitterMode"/>
+    /// <seealso cref="TriggerJitterThreshold"/>
+    /// <seealso cref="TriggerJitterStats"/>
+    /// <seealso cref="StackFree"/>
+    /// <seealso cref="ExternalClockSkips"/>
+    /// <seealso cref="IsrProfileSlot"/>
     [XmlInclude(typeof(CameraStart))]
     [XmlInclude(typeof(CameraStop))]
     [XmlInclude(typeof(ServoEnable))]
@@ -176,6 +292,64 @@ namespace Harp.CameraController
     [XmlInclude(typeof(Servo1Period))]
     [XmlInclude(typeof(Servo1PulseWidth))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(Camera0ClockDivider))]
+    [XmlInclude(typeof(Camera0ClockMultiplier))]
+    [XmlInclude(typeof(Camera0TriggerDelay))]
+    [XmlInclude(typeof(Camera0TriggerWidth))]
+    [XmlInclude(typeof(Camera1ClockDivider))]
+    [XmlInclude(typeof(Camera1ClockMultiplier))]
+    [XmlInclude(typeof(Camera1TriggerDelay))]
+    [XmlInclude(typeof(Camera1TriggerWidth))]
+    [XmlInclude(typeof(ClockDiscipline))]
+    [XmlInclude(typeof(ClockDriftStats))]
+    [XmlInclude(typeof(Camera0Sequence))]
+    [XmlInclude(typeof(Camera0SequenceLength))]
+    [XmlInclude(typeof(Camera0SequenceRepeat))]
+    [XmlInclude(typeof(Camera1Sequence))]
+    [XmlInclude(typeof(Camera1SequenceLength))]
+    [XmlInclude(typeof(Camera1SequenceRepeat))]
+    [XmlInclude(typeof(ScheduleEnable))]
+    [XmlInclude(typeof(ScheduleWindows))]
+    [XmlInclude(typeof(Camera0SchedulePeriod))]
+    [XmlInclude(typeof(Camera0Schedule))]
+    [XmlInclude(typeof(Camera1SchedulePeriod))]
+    [XmlInclude(typeof(Camera1Schedule))]
+    [XmlInclude(typeof(Servo0Target))]
+    [XmlInclude(typeof(Servo0MaxVelocity))]
+    [XmlInclude(typeof(Servo0Acceleration))]
+    [XmlInclude(typeof(Servo0Profile))]
+    [XmlInclude(typeof(Servo1Target))]
+    [XmlInclude(typeof(Servo1MaxVelocity))]
+    [XmlInclude(typeof(Servo1Acceleration))]
+    [XmlInclude(typeof(Servo1Profile))]
+    [XmlInclude(typeof(ServoMoving))]
+    [XmlInclude(typeof(Servo0Waypoints))]
+    [XmlInclude(typeof(Servo0WaypointCount))]
+    [XmlInclude(typeof(Servo1Waypoints))]
+    [XmlInclude(typeof(Servo1WaypointCount))]
+    [XmlInclude(typeof(ServoPlay))]
+    [XmlInclude(typeof(ServoPlayOnDI0))]
+    [XmlInclude(typeof(Servo0PulseWidthFine))]
+    [XmlInclude(typeof(Servo1PulseWidthFine))]
+    [XmlInclude(typeof(Servo0SetpointFifo))]
+    [XmlInclude(typeof(Servo1SetpointFifo))]
+    [XmlInclude(typeof(ServoUnderruns))]
+    [XmlInclude(typeof(TimerOwners))]
+    [XmlInclude(typeof(ServoAlign))]
+    [XmlInclude(typeof(ChannelState))]
+    [XmlInclude(typeof(CameraSoftTrigger))]
+    [XmlInclude(typeof(ConfigStage))]
+    [XmlInclude(typeof(ConfigCommit))]
+    [XmlInclude(typeof(Snapshot))]
+    [XmlInclude(typeof(OutputInvert))]
+    [XmlInclude(typeof(IsrProfile))]
+    [XmlInclude(typeof(IsrProfileReset))]
+    [XmlInclude(typeof(TriggerJitterMode))]
+    [XmlInclude(typeof(TriggerJitterThreshold))]
+    [XmlInclude(typeof(TriggerJitterStats))]
+    [XmlInclude(typeof(StackFree))]
+    [XmlInclude(typeof(ExternalClockSkips))]
+    [XmlInclude(typeof(IsrProfileSlot))]
     [Description("Filters register-specific messages reported by the CameraController device.")]
     public class FilterRegister : FilterRegisterBuilder, INamedElement
     {
@@ -221,6 +395,64 @@ namespace Harp.CameraController
     /// <seealso cref="Servo1Period"/>
     /// <seealso cref="Servo1PulseWidth"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="Camera0ClockDivider"/>
+    /// <seealso cref="Camera0ClockMultiplier"/>
+    /// <seealso cref="Camera0TriggerDelay"/>
+    /// <seealso cref="Camera0TriggerWidth"/>
+    /// <seealso cref="Camera1ClockDivider"/>
+    /// <seealso cref="Camera1ClockMultiplier"/>
+    /// <seealso cref="Camera1TriggerDelay"/>
+    /// <seealso cref="Camera1TriggerWidth"/>
+    /// <seealso cref="ClockDiscipline"/>
+    /// <seealso cref="ClockDriftStats"/>
+    /// <seealso cref="Camera0Sequence"/>
+    /// <seealso cref="Camera0SequenceLength"/>
+    /// <seealso cref="Camera0SequenceRepeat"/>
+    /// <seealso cref="Camera1Sequence"/>
+    /// <seealso cref="Camera1SequenceLength"/>
+    /// <seealso cref="Camera1SequenceRepeat"/>
+    /// <seealso cref="ScheduleEnable"/>
+    /// <seealso cref="ScheduleWindows"/>
+    /// <seealso cref="Camera0SchedulePeriod"/>
+    /// <seealso cref="Camera0Schedule"/>
+    /// <seealso cref="Camera1SchedulePeriod"/>
+    /// <seealso cref="Camera1Schedule"/>
+    /// <seealso cref="Servo0Target"/>
+    /// <seealso cref="Servo0MaxVelocity"/>
+    /// <seealso cref="Servo0Acceleration"/>
+    /// <seealso cref="Servo0Profile"/>
+    /// <seealso cref="Servo1Target"/>
+    /// <seealso cref="Servo1MaxVelocity"/>
+    /// <seealso cref="Servo1Acceleration"/>
+    /// <seealso cref="Servo1Profile"/>
+    /// <seealso cref="ServoMoving"/>
+    /// <seealso cref="Servo0Waypoints"/>
+    /// <seealso cref="Servo0WaypointCount"/>
+    /// <seealso cref="Servo1Waypoints"/>
+    /// <seealso cref="Servo1WaypointCount"/>
+    /// <seealso cref="ServoPlay"/>
+    /// <seealso cref="ServoPlayOnDI0"/>
+    /// <seealso cref="Servo0PulseWidthFine"/>
+    /// <seealso cref="Servo1PulseWidthFine"/>
+    /// <seealso cref="Servo0SetpointFifo"/>
+    /// <seealso cref="Servo1SetpointFifo"/>
+    /// <seealso cref="ServoUnderruns"/>
+    /// <seealso cref="TimerOwners"/>
+    /// <seealso cref="ServoAlign"/>
+    /// <seealso cref="ChannelState"/>
+    /// <seealso cref="CameraSoftTrigger"/>
+    /// <seealso cref="ConfigStage"/>
+    /// <seealso cref="ConfigCommit"/>
+    /// <seealso cref="Snapshot"/>
+    /// <seealso cref="OutputInvert"/>
+    /// <seealso cref="IsrProfile"/>
+    /// <seealso cref="IsrProfileReset"/>
+    /// <seealso cref="TriggerJitterMode"/>
+    /// <seealso cref="TriggerJitterThreshold"/>
+    /// <seealso cref="TriggerJitterStats"/>
+    /// <seealso cref="StackFree"/>
+    /// <seealso cref="ExternalClockSkips"/>
+    /// <seealso cref="IsrProfileSlot"/>
     [XmlInclude(typeof(CameraStart))]
     [XmlInclude(typeof(CameraStop))]
     [XmlInclude(typeof(ServoEnable))]
@@ -245,6 +477,64 @@ namespace Harp.CameraController
     [XmlInclude(typeof(Servo1Period))]
     [XmlInclude(typeof(Servo1PulseWidth))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(Camera0ClockDivider))]
+    [XmlInclude(typeof(Camera0ClockMultiplier))]
+    [XmlInclude(typeof(Camera0TriggerDelay))]
+    [XmlInclude(typeof(Camera0TriggerWidth))]
+    [XmlInclude(typeof(Camera1ClockDivider))]
+    [XmlInclude(typeof(Camera1ClockMultiplier))]
+    [XmlInclude(typeof(Camera1TriggerDelay))]
+    [XmlInclude(typeof(Camera1TriggerWidth))]
+    [XmlInclude(typeof(ClockDiscipline))]
+    [XmlInclude(typeof(ClockDriftStats))]
+    [XmlInclude(typeof(Camera0Sequence))]
+    [XmlInclude(typeof(Camera0SequenceLength))]
+    [XmlInclude(typeof(Camera0SequenceRepeat))]
+    [XmlInclude(typeof(Camera1Sequence))]
+    [XmlInclude(typeof(Camera1SequenceLength))]
+    [XmlInclude(typeof(Camera1SequenceRepeat))]
+    [XmlInclude(typeof(ScheduleEnable))]
+    [XmlInclude(typeof(ScheduleWindows))]
+    [XmlInclude(typeof(Camera0SchedulePeriod))]
+    [XmlInclude(typeof(Camera0Schedule))]
+    [XmlInclude(typeof(Camera1SchedulePeriod))]
+    [XmlInclude(typeof(Camera1Schedule))]
+    [XmlInclude(typeof(Servo0Target))]
+    [XmlInclude(typeof(Servo0MaxVelocity))]
+    [XmlInclude(typeof(Servo0Acceleration))]
+    [XmlInclude(typeof(Servo0Profile))]
+    [XmlInclude(typeof(Servo1Target))]
+    [XmlInclude(typeof(Servo1MaxVelocity))]
+    [XmlInclude(typeof(Servo1Acceleration))]
+    [XmlInclude(typeof(Servo1Profile))]
+    [XmlInclude(typeof(ServoMoving))]
+    [XmlInclude(typeof(Servo0Waypoints))]
+    [XmlInclude(typeof(Servo0WaypointCount))]
+    [XmlInclude(typeof(Servo1Waypoints))]
+    [XmlInclude(typeof(Servo1WaypointCount))]
+    [XmlInclude(typeof(ServoPlay))]
+    [XmlInclude(typeof(ServoPlayOnDI0))]
+    [XmlInclude(typeof(Servo0PulseWidthFine))]
+    [XmlInclude(typeof(Servo1PulseWidthFine))]
+    [XmlInclude(typeof(Servo0SetpointFifo))]
+    [XmlInclude(typeof(Servo1SetpointFifo))]
+    [XmlInclude(typeof(ServoUnderruns))]
+    [XmlInclude(typeof(TimerOwners))]
+    [XmlInclude(typeof(ServoAlign))]
+    [XmlInclude(typeof(ChannelState))]
+    [XmlInclude(typeof(CameraSoftTrigger))]
+    [XmlInclude(typeof(ConfigStage))]
+    [XmlInclude(typeof(ConfigCommit))]
+    [XmlInclude(typeof(Snapshot))]
+    [XmlInclude(typeof(OutputInvert))]
+    [XmlInclude(typeof(IsrProfile))]
+    [XmlInclude(typeof(IsrProfileReset))]
+    [XmlInclude(typeof(TriggerJitterMode))]
+    [XmlInclude(typeof(TriggerJitterThreshold))]
+    [XmlInclude(typeof(TriggerJitterStats))]
+    [XmlInclude(typeof(StackFree))]
+    [XmlInclude(typeof(ExternalClockSkips))]
+    [XmlInclude(typeof(IsrProfileSlot))]
     [XmlInclude(typeof(TimestampedCameraStart))]
     [XmlInclude(typeof(TimestampedCameraStop))]
     [XmlInclude(typeof(TimestampedServoEnable))]
@@ -269,6 +559,64 @@ namespace Harp.CameraController
     [XmlInclude(typeof(TimestampedServo1Period))]
     [XmlInclude(typeof(TimestampedServo1PulseWidth))]
     [XmlInclude(typeof(TimestampedEnableEvents))]
+    [XmlInclude(typeof(TimestampedCamera0ClockDivider))]
+    [XmlInclude(typeof(TimestampedCamera0ClockMultiplier))]
+    [XmlInclude(typeof(TimestampedCamera0TriggerDelay))]
+    [XmlInclude(typeof(TimestampedCamera0TriggerWidth))]
+    [XmlInclude(typeof(TimestampedCamera1ClockDivider))]
+    [XmlInclude(typeof(TimestampedCamera1ClockMultiplier))]
+    [XmlInclude(typeof(TimestampedCamera1TriggerDelay))]
+    [XmlInclude(typeof(TimestampedCamera1TriggerWidth))]
+    [XmlInclude(typeof(TimestampedClockDiscipline))]
+    [XmlInclude(typeof(TimestampedClockDriftStats))]
+    [XmlInclude(typeof(TimestampedCamera0Sequence))]
+    [XmlInclude(typeof(TimestampedCamera0SequenceLength))]
+    [XmlInclude(typeof(TimestampedCamera0SequenceRepeat))]
+    [XmlInclude(typeof(TimestampedCamera1Sequence))]
+    [XmlInclude(typeof(TimestampedCamera1SequenceLength))]
+    [XmlInclude(typeof(TimestampedCamera1SequenceRepeat))]
+    [XmlInclude(typeof(TimestampedScheduleEnable))]
+    [XmlInclude(typeof(TimestampedScheduleWindows))]
+    [XmlInclude(typeof(TimestampedCamera0SchedulePeriod))]
+    [XmlInclude(typeof(TimestampedCamera0Schedule))]
+    [XmlInclude(typeof(TimestampedCamera1SchedulePeriod))]
+    [XmlInclude(typeof(TimestampedCamera1Schedule))]
+    [XmlInclude(typeof(TimestampedServo0Target))]
+    [XmlInclude(typeof(TimestampedServo0MaxVelocity))]
+    [XmlInclude(typeof(TimestampedServo0Acceleration))]
+    [XmlInclude(typeof(TimestampedServo0Profile))]
+    [XmlInclude(typeof(TimestampedServo1Target))]
+    [XmlInclude(typeof(TimestampedServo1MaxVelocity))]
+    [XmlInclude(typeof(TimestampedServo1Acceleration))]
+    [XmlInclude(typeof(TimestampedServo1Profile))]
+    [XmlInclude(typeof(TimestampedServoMoving))]
+    [XmlInclude(typeof(TimestampedServo0Waypoints))]
+    [XmlInclude(typeof(TimestampedServo0WaypointCount))]
+    [XmlInclude(typeof(TimestampedServo1Waypoints))]
+    [XmlInclude(typeof(TimestampedServo1WaypointCount))]
+    [XmlInclude(typeof(TimestampedServoPlay))]
+    [XmlInclude(typeof(TimestampedServoPlayOnDI0))]
+    [XmlInclude(typeof(TimestampedServo0PulseWidthFine))]
+    [XmlInclude(typeof(TimestampedServo1PulseWidthFine))]
+    [XmlInclude(typeof(TimestampedServo0SetpointFifo))]
+    [XmlInclude(typeof(TimestampedServo1SetpointFifo))]
+    [XmlInclude(typeof(TimestampedServoUnderruns))]
+    [XmlInclude(typeof(TimestampedTimerOwners))]
+    [XmlInclude(typeof(TimestampedServoAlign))]
+    [XmlInclude(typeof(TimestampedChannelState))]
+    [XmlInclude(typeof(TimestampedCameraSoftTrigger))]
+    [XmlInclude(typeof(TimestampedConfigStage))]
+    [XmlInclude(typeof(TimestampedConfigCommit))]
+    [XmlInclude(typeof(TimestampedSnapshot))]
+    [XmlInclude(typeof(TimestampedOutputInvert))]
+    [XmlInclude(typeof(TimestampedIsrProfile))]
+    [XmlInclude(typeof(TimestampedIsrProfileReset))]
+    [XmlInclude(typeof(TimestampedTriggerJitterMode))]
+    [XmlInclude(typeof(TimestampedTriggerJitterThreshold))]
+    [XmlInclude(typeof(TimestampedTriggerJitterStats))]
+    [XmlInclude(typeof(TimestampedStackFree))]
+    [XmlInclude(typeof(TimestampedExternalClockSkips))]
+    [XmlInclude(typeof(TimestampedIsrProfileSlot))]
     [Description("Filters and selects specific messages reported by the CameraController device.")]
     public partial class Parse : ParseBuilder, INamedElement
     {
@@ -311,6 +659,64 @@ namespace Harp.CameraController
     /// <seealso cref="Servo1Period"/>
     /// <seealso cref="Servo1PulseWidth"/>
     /// <seealso cref="EnableEvents"/>
+    /// <seealso cref="Camera0ClockDivider"/>
+    /// <seealso cref="Camera0ClockMultiplier"/>
+    /// <seealso cref="Camera0TriggerDelay"/>
+    /// <seealso cref="Camera0TriggerWidth"/>
+    /// <seealso cref="Camera1ClockDivider"/>
+    /// <seealso cref="Camera1ClockMultiplier"/>
+    /// <seealso cref="Camera1TriggerDelay"/>
+    /// <seealso cref="Camera1TriggerWidth"/>
+    /// <seealso cref="ClockDiscipline"/>
+    /// <seealso cref="ClockDriftStats"/>
+    /// <seealso cref="Camera0Sequence"/>
+    /// <seealso cref="Camera0SequenceLength"/>
+    /// <seealso cref="Camera0SequenceRepeat"/>
+    /// <seealso cref="Camera1Sequence"/>
+    /// <seealso cref="Camera1SequenceLength"/>
+    /// <seealso cref="Camera1SequenceRepeat"/>
+    /// <seealso cref="ScheduleEnable"/>
+    /// <seealso cref="ScheduleWindows"/>
+    /// <seealso cref="Camera0SchedulePeriod"/>
+    /// <seealso cref="Camera0Schedule"/>
+    /// <seealso cref="Camera1SchedulePeriod"/>
+    /// <seealso cref="Camera1Schedule"/>
+    /// <seealso cref="Servo0Target"/>
+    /// <seealso cref="Servo0MaxVelocity"/>
+    /// <seealso cref="Servo0Acceleration"/>
+    /// <seealso cref="Servo0Profile"/>
+    /// <seealso cref="Servo1Target"/>
+    /// <seealso cref="Servo1MaxVelocity"/>
+    /// <seealso cref="Servo1Acceleration"/>
+    /// <seealso cref="Servo1Profile"/>
+    /// <seealso cref="ServoMoving"/>
+    /// <seealso cref="Servo0Waypoints"/>
+    /// <seealso cref="Servo0WaypointCount"/>
+    /// <seealso cref="Servo1Waypoints"/>
+    /// <seealso cref="Servo1WaypointCount"/>
+    /// <seealso cref="ServoPlay"/>
+    /// <seealso cref="ServoPlayOnDI0"/>
+    /// <seealso cref="Servo0PulseWidthFine"/>
+    /// <seealso cref="Servo1PulseWidthFine"/>
+    /// <seealso cref="Servo0SetpointFifo"/>
+    /// <seealso cref="Servo1SetpointFifo"/>
+    /// <seealso cref="ServoUnderruns"/>
+    /// <seealso cref="TimerOwners"/>
+    /// <seealso cref="ServoAlign"/>
+    /// <seealso cref="ChannelState"/>
+    /// <seealso cref="CameraSoftTrigger"/>
+    /// <seealso cref="ConfigStage"/>
+    /// <seealso cref="ConfigCommit"/>
+    /// <seealso cref="Snapshot"/>
+    /// <seealso cref="OutputInvert"/>
+    /// <seealso cref="IsrProfile"/>
+    /// <seealso cref="IsrProfileReset"/>
+    /// <seealso cref="TriggerJitterMode"/>
+    /// <seealso cref="TriggerJitterThreshold"/>
+    /// <seealso cref="TriggerJitterStats"/>
+    /// <seealso cref="StackFree"/>
+    /// <seealso cref="ExternalClockSkips"/>
+    /// <seealso cref="IsrProfileSlot"/>
     [XmlInclude(typeof(CameraStart))]
     [XmlInclude(typeof(CameraStop))]
     [XmlInclude(typeof(ServoEnable))]
@@ -335,6 +741,64 @@ namespace Harp.CameraController
     [XmlInclude(typeof(Servo1Period))]
     [XmlInclude(typeof(Servo1PulseWidth))]
     [XmlInclude(typeof(EnableEvents))]
+    [XmlInclude(typeof(Camera0ClockDivider))]
+    [XmlInclude(typeof(Camera0ClockMultiplier))]
+    [XmlInclude(typeof(Camera0TriggerDelay))]
+    [XmlInclude(typeof(Camera0TriggerWidth))]
+    [XmlInclude(typeof(Camera1ClockDivider))]
+    [XmlInclude(typeof(Camera1ClockMultiplier))]
+    [XmlInclude(typeof(Camera1TriggerDelay))]
+    [XmlInclude(typeof(Camera1TriggerWidth))]
+    [XmlInclude(typeof(ClockDiscipline))]
+    [XmlInclude(typeof(ClockDriftStats))]
+    [XmlInclude(typeof(Camera0Sequence))]
+    [XmlInclude(typeof(Camera0SequenceLength))]
+    [XmlInclude(typeof(Camera0SequenceRepeat))]
+    [XmlInclude(typeof(Camera1Sequence))]
+    [XmlInclude(typeof(Camera1SequenceLength))]
+    [XmlInclude(typeof(Camera1SequenceRepeat))]
+    [XmlInclude(typeof(ScheduleEnable))]
+    [XmlInclude(typeof(ScheduleWindows))]
+    [XmlInclude(typeof(Camera0SchedulePeriod))]
+    [XmlInclude(typeof(Camera0Schedule))]
+    [XmlInclude(typeof(Camera1SchedulePeriod))]
+    [XmlInclude(typeof(Camera1Schedule))]
+    [XmlInclude(typeof(Servo0Target))]
+    [XmlInclude(typeof(Servo0MaxVelocity))]
+    [XmlInclude(typeof(Servo0Acceleration))]
+    [XmlInclude(typeof(Servo0Profile))]
+    [XmlInclude(typeof(Servo1Target))]
+    [XmlInclude(typeof(Servo1MaxVelocity))]
+    [XmlInclude(typeof(Servo1Acceleration))]
+    [XmlInclude(typeof(Servo1Profile))]
+    [XmlInclude(typeof(ServoMoving))]
+    [XmlInclude(typeof(Servo0Waypoints))]
+    [XmlInclude(typeof(Servo0WaypointCount))]
+    [XmlInclude(typeof(Servo1Waypoints))]
+    [XmlInclude(typeof(Servo1WaypointCount))]
+    [XmlInclude(typeof(ServoPlay))]
+    [XmlInclude(typeof(ServoPlayOnDI0))]
+    [XmlInclude(typeof(Servo0PulseWidthFine))]
+    [XmlInclude(typeof(Servo1PulseWidthFine))]
+    [XmlInclude(typeof(Servo0SetpointFifo))]
+    [XmlInclude(typeof(Servo1SetpointFifo))]
+    [XmlInclude(typeof(ServoUnderruns))]
+    [XmlInclude(typeof(TimerOwners))]
+    [XmlInclude(typeof(ServoAlign))]
+    [XmlInclude(typeof(ChannelState))]
+    [XmlInclude(typeof(CameraSoftTrigger))]
+    [XmlInclude(typeof(ConfigStage))]
+    [XmlInclude(typeof(ConfigCommit))]
+    [XmlInclude(typeof(Snapshot))]
+    [XmlInclude(typeof(OutputInvert))]
+    [XmlInclude(typeof(IsrProfile))]
+    [XmlInclude(typeof(IsrProfileReset))]
+    [XmlInclude(typeof(TriggerJitterMode))]
+    [XmlInclude(typeof(TriggerJitterThreshold))]
+    [XmlInclude(typeof(TriggerJitterStats))]
+    [XmlInclude(typeof(StackFree))]
+    [XmlInclude(typeof(ExternalClockSkips))]
+    [XmlInclude(typeof(IsrProfileSlot))]
     [Description("Formats a sequence of values as specific CameraController register messages.")]
     public partial class Format : FormatBuilder, INamedElement
     {
@@ -1941,9 +2405,9 @@ namespace Harp.CameraController
     }
 
     /// <summary>
-    /// Represents a register that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode.
+    /// Represents a register that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.
     /// </summary>
-    [Description("Configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode.")]
+    [Description("Configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.")]
     public partial class Camera0Frequency
     {
         /// <summary>
@@ -2037,9 +2501,9 @@ namespace Harp.CameraController
     }
 
     /// <summary>
-    /// Represents a register that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).
+    /// Represents a register that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.
     /// </summary>
-    [Description("Configures the servo motor period (us) when using Servo mode (sensitive to 2 us)")]
+    [Description("Configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.")]
     public partial class Servo0Period
     {
         /// <summary>
@@ -2133,9 +2597,9 @@ namespace Harp.CameraController
     }
 
     /// <summary>
-    /// Represents a register that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).
+    /// Represents a register that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.
     /// </summary>
-    [Description("Configures the servo pulse width (us) when using Servo mode (sensitive to 2 us)")]
+    [Description("Configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.")]
     public partial class Servo0PulseWidth
     {
         /// <summary>
@@ -2326,9 +2790,9 @@ namespace Harp.CameraController
     }
 
     /// <summary>
-    /// Represents a register that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode.
+    /// Represents a register that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.
     /// </summary>
-    [Description("Configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode.")]
+    [Description("Configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.")]
     public partial class Camera1Frequency
     {
         /// <summary>
@@ -2422,9 +2886,9 @@ namespace Harp.CameraController
     }
 
     /// <summary>
-    /// Represents a register that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).
+    /// Represents a register that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.
     /// </summary>
-    [Description("Configures the servo motor period (us) when using Servo mode (sensitive to 2 us)")]
+    [Description("Configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.")]
     public partial class Servo1Period
     {
         /// <summary>
@@ -2518,9 +2982,9 @@ namespace Harp.CameraController
     }
 
     /// <summary>
-    /// Represents a register that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).
+    /// Represents a register that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.
     /// </summary>
-    [Description("Configures the servo pulse width (us) when using Servo mode (sensitive to 2 us)")]
+    [Description("Configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.")]
     public partial class Servo1PulseWidth
     {
         /// <summary>
@@ -2754,1393 +3218,10314 @@ namespace Harp.CameraController
         }
     }
 
+    /// <summary>
+    /// Represents a register that configures the number of DI0 rising edges between each trigger burst on Camera 0 when using ExternalClock mode.
+    /// </summary>
+    [Description("Configures the number of DI0 rising edges between each trigger burst on Camera 0 when using ExternalClock mode.")]
+    public partial class Camera0ClockDivider
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0ClockDivider"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 60;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera0ClockDivider"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera0ClockDivider"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera0ClockDivider"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera0ClockDivider"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera0ClockDivider"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0ClockDivider"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera0ClockDivider"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0ClockDivider"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera0ClockDivider register.
+    /// </summary>
+    /// <seealso cref="Camera0ClockDivider"/>
+    [Description("Filters and selects timestamped messages from the Camera0ClockDivider register.")]
+    public partial class TimestampedCamera0ClockDivider
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0ClockDivider"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera0ClockDivider.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera0ClockDivider"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return Camera0ClockDivider.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the number of trigger pulses evenly spread over one DI0 period on Camera 0 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.
+    /// </summary>
+    [Description("Configures the number of trigger pulses evenly spread over one DI0 period on Camera 0 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.")]
+    public partial class Camera0ClockMultiplier
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0ClockMultiplier"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 61;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera0ClockMultiplier"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera0ClockMultiplier"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera0ClockMultiplier"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera0ClockMultiplier"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera0ClockMultiplier"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0ClockMultiplier"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera0ClockMultiplier"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0ClockMultiplier"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera0ClockMultiplier register.
+    /// </summary>
+    /// <seealso cref="Camera0ClockMultiplier"/>
+    [Description("Filters and selects timestamped messages from the Camera0ClockMultiplier register.")]
+    public partial class TimestampedCamera0ClockMultiplier
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0ClockMultiplier"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera0ClockMultiplier.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera0ClockMultiplier"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return Camera0ClockMultiplier.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 0 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.
+    /// </summary>
+    [Description("Configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 0 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.")]
+    public partial class Camera0TriggerDelay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0TriggerDelay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 62;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera0TriggerDelay"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera0TriggerDelay"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera0TriggerDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera0TriggerDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera0TriggerDelay"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0TriggerDelay"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera0TriggerDelay"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0TriggerDelay"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera0TriggerDelay register.
+    /// </summary>
+    /// <seealso cref="Camera0TriggerDelay"/>
+    [Description("Filters and selects timestamped messages from the Camera0TriggerDelay register.")]
+    public partial class TimestampedCamera0TriggerDelay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0TriggerDelay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera0TriggerDelay.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera0TriggerDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Camera0TriggerDelay.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the width (us) of the trigger pulses on Camera 0 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.
+    /// </summary>
+    [Description("Configures the width (us) of the trigger pulses on Camera 0 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.")]
+    public partial class Camera0TriggerWidth
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0TriggerWidth"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 63;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera0TriggerWidth"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera0TriggerWidth"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera0TriggerWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera0TriggerWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera0TriggerWidth"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0TriggerWidth"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera0TriggerWidth"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0TriggerWidth"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera0TriggerWidth register.
+    /// </summary>
+    /// <seealso cref="Camera0TriggerWidth"/>
+    [Description("Filters and selects timestamped messages from the Camera0TriggerWidth register.")]
+    public partial class TimestampedCamera0TriggerWidth
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0TriggerWidth"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera0TriggerWidth.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera0TriggerWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Camera0TriggerWidth.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the number of DI0 rising edges between each trigger burst on Camera 1 when using ExternalClock mode.
+    /// </summary>
+    [Description("Configures the number of DI0 rising edges between each trigger burst on Camera 1 when using ExternalClock mode.")]
+    public partial class Camera1ClockDivider
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1ClockDivider"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 64;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera1ClockDivider"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera1ClockDivider"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera1ClockDivider"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera1ClockDivider"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera1ClockDivider"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1ClockDivider"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera1ClockDivider"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1ClockDivider"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera1ClockDivider register.
+    /// </summary>
+    /// <seealso cref="Camera1ClockDivider"/>
+    [Description("Filters and selects timestamped messages from the Camera1ClockDivider register.")]
+    public partial class TimestampedCamera1ClockDivider
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1ClockDivider"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera1ClockDivider.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera1ClockDivider"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return Camera1ClockDivider.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the number of trigger pulses evenly spread over one DI0 period on Camera 1 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.
+    /// </summary>
+    [Description("Configures the number of trigger pulses evenly spread over one DI0 period on Camera 1 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.")]
+    public partial class Camera1ClockMultiplier
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1ClockMultiplier"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 65;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera1ClockMultiplier"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera1ClockMultiplier"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera1ClockMultiplier"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera1ClockMultiplier"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera1ClockMultiplier"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1ClockMultiplier"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera1ClockMultiplier"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1ClockMultiplier"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera1ClockMultiplier register.
+    /// </summary>
+    /// <seealso cref="Camera1ClockMultiplier"/>
+    [Description("Filters and selects timestamped messages from the Camera1ClockMultiplier register.")]
+    public partial class TimestampedCamera1ClockMultiplier
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1ClockMultiplier"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera1ClockMultiplier.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera1ClockMultiplier"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return Camera1ClockMultiplier.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 1 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.
+    /// </summary>
+    [Description("Configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 1 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.")]
+    public partial class Camera1TriggerDelay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1TriggerDelay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 66;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera1TriggerDelay"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera1TriggerDelay"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera1TriggerDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera1TriggerDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera1TriggerDelay"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1TriggerDelay"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera1TriggerDelay"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1TriggerDelay"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera1TriggerDelay register.
+    /// </summary>
+    /// <seealso cref="Camera1TriggerDelay"/>
+    [Description("Filters and selects timestamped messages from the Camera1TriggerDelay register.")]
+    public partial class TimestampedCamera1TriggerDelay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1TriggerDelay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera1TriggerDelay.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera1TriggerDelay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Camera1TriggerDelay.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the width (us) of the trigger pulses on Camera 1 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.
+    /// </summary>
+    [Description("Configures the width (us) of the trigger pulses on Camera 1 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.")]
+    public partial class Camera1TriggerWidth
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1TriggerWidth"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 67;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera1TriggerWidth"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera1TriggerWidth"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera1TriggerWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera1TriggerWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera1TriggerWidth"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1TriggerWidth"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera1TriggerWidth"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1TriggerWidth"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera1TriggerWidth register.
+    /// </summary>
+    /// <seealso cref="Camera1TriggerWidth"/>
+    [Description("Filters and selects timestamped messages from the Camera1TriggerWidth register.")]
+    public partial class TimestampedCamera1TriggerWidth
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1TriggerWidth"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera1TriggerWidth.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera1TriggerWidth"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Camera1TriggerWidth.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures whether the camera trigger timebase is locked to the Harp clock.
+    /// </summary>
+    [Description("Configures whether the camera trigger timebase is locked to the Harp clock.")]
+    public partial class ClockDiscipline
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ClockDiscipline"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 68;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ClockDiscipline"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ClockDiscipline"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ClockDiscipline"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ClockDisciplineConfig GetPayload(HarpMessage message)
+        {
+            return (ClockDisciplineConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ClockDiscipline"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ClockDisciplineConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((ClockDisciplineConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ClockDiscipline"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ClockDiscipline"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ClockDisciplineConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ClockDiscipline"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ClockDiscipline"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ClockDisciplineConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ClockDiscipline register.
+    /// </summary>
+    /// <seealso cref="ClockDiscipline"/>
+    [Description("Filters and selects timestamped messages from the ClockDiscipline register.")]
+    public partial class TimestampedClockDiscipline
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ClockDiscipline"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ClockDiscipline.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ClockDiscipline"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ClockDisciplineConfig> GetPayload(HarpMessage message)
+        {
+            return ClockDiscipline.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the clock discipline statistics in 32 MHz ticks, as the last measured error per Harp second, the applied trim per second, the residual phase and the maximum absolute residual phase.
+    /// </summary>
+    [Description("Reports the clock discipline statistics in 32 MHz ticks, as the last measured error per Harp second, the applied trim per second, the residual phase and the maximum absolute residual phase.")]
+    public partial class ClockDriftStats
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ClockDriftStats"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 69;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ClockDriftStats"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.S32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ClockDriftStats"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 4;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ClockDriftStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static int[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<int>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ClockDriftStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<int>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ClockDriftStats"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ClockDriftStats"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, int[] value)
+        {
+            return HarpMessage.FromInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ClockDriftStats"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ClockDriftStats"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, int[] value)
+        {
+            return HarpMessage.FromInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ClockDriftStats register.
+    /// </summary>
+    /// <seealso cref="ClockDriftStats"/>
+    [Description("Filters and selects timestamped messages from the ClockDriftStats register.")]
+    public partial class TimestampedClockDriftStats
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ClockDriftStats"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ClockDriftStats.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ClockDriftStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<int[]> GetPayload(HarpMessage message)
+        {
+            return ClockDriftStats.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the intervals (us) between consecutive triggers on Camera 0 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.
+    /// </summary>
+    [Description("Configures the intervals (us) between consecutive triggers on Camera 0 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.")]
+    public partial class Camera0Sequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0Sequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 70;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera0Sequence"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera0Sequence"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera0Sequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera0Sequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera0Sequence"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0Sequence"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera0Sequence"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0Sequence"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera0Sequence register.
+    /// </summary>
+    /// <seealso cref="Camera0Sequence"/>
+    [Description("Filters and selects timestamped messages from the Camera0Sequence register.")]
+    public partial class TimestampedCamera0Sequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0Sequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera0Sequence.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera0Sequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return Camera0Sequence.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the number of intervals used from the Camera0Sequence register, from 1 to 16.
+    /// </summary>
+    [Description("Configures the number of intervals used from the Camera0Sequence register, from 1 to 16.")]
+    public partial class Camera0SequenceLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 71;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera0SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera0SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera0SequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera0SequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera0SequenceLength"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0SequenceLength"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera0SequenceLength"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0SequenceLength"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera0SequenceLength register.
+    /// </summary>
+    /// <seealso cref="Camera0SequenceLength"/>
+    [Description("Filters and selects timestamped messages from the Camera0SequenceLength register.")]
+    public partial class TimestampedCamera0SequenceLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera0SequenceLength.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera0SequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return Camera0SequenceLength.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the number of times the sequence is played on Camera 0, up to 255. If zero, the sequence loops until the camera is stopped.
+    /// </summary>
+    [Description("Configures the number of times the sequence is played on Camera 0, up to 255. If zero, the sequence loops until the camera is stopped.")]
+    public partial class Camera0SequenceRepeat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0SequenceRepeat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 72;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera0SequenceRepeat"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera0SequenceRepeat"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera0SequenceRepeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera0SequenceRepeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera0SequenceRepeat"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0SequenceRepeat"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera0SequenceRepeat"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0SequenceRepeat"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera0SequenceRepeat register.
+    /// </summary>
+    /// <seealso cref="Camera0SequenceRepeat"/>
+    [Description("Filters and selects timestamped messages from the Camera0SequenceRepeat register.")]
+    public partial class TimestampedCamera0SequenceRepeat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0SequenceRepeat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera0SequenceRepeat.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera0SequenceRepeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return Camera0SequenceRepeat.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the intervals (us) between consecutive triggers on Camera 1 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.
+    /// </summary>
+    [Description("Configures the intervals (us) between consecutive triggers on Camera 1 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.")]
+    public partial class Camera1Sequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1Sequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 73;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera1Sequence"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera1Sequence"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera1Sequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera1Sequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera1Sequence"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1Sequence"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera1Sequence"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1Sequence"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera1Sequence register.
+    /// </summary>
+    /// <seealso cref="Camera1Sequence"/>
+    [Description("Filters and selects timestamped messages from the Camera1Sequence register.")]
+    public partial class TimestampedCamera1Sequence
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1Sequence"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera1Sequence.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera1Sequence"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return Camera1Sequence.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the number of intervals used from the Camera1Sequence register, from 1 to 16.
+    /// </summary>
+    [Description("Configures the number of intervals used from the Camera1Sequence register, from 1 to 16.")]
+    public partial class Camera1SequenceLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 74;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera1SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera1SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera1SequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera1SequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera1SequenceLength"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1SequenceLength"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera1SequenceLength"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1SequenceLength"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera1SequenceLength register.
+    /// </summary>
+    /// <seealso cref="Camera1SequenceLength"/>
+    [Description("Filters and selects timestamped messages from the Camera1SequenceLength register.")]
+    public partial class TimestampedCamera1SequenceLength
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1SequenceLength"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera1SequenceLength.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera1SequenceLength"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return Camera1SequenceLength.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the number of times the sequence is played on Camera 1, up to 255. If zero, the sequence loops until the camera is stopped.
+    /// </summary>
+    [Description("Configures the number of times the sequence is played on Camera 1, up to 255. If zero, the sequence loops until the camera is stopped.")]
+    public partial class Camera1SequenceRepeat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1SequenceRepeat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 75;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera1SequenceRepeat"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera1SequenceRepeat"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera1SequenceRepeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera1SequenceRepeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera1SequenceRepeat"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1SequenceRepeat"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera1SequenceRepeat"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1SequenceRepeat"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera1SequenceRepeat register.
+    /// </summary>
+    /// <seealso cref="Camera1SequenceRepeat"/>
+    [Description("Filters and selects timestamped messages from the Camera1SequenceRepeat register.")]
+    public partial class TimestampedCamera1SequenceRepeat
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1SequenceRepeat"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera1SequenceRepeat.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera1SequenceRepeat"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return Camera1SequenceRepeat.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that enables the acquisition schedule on the specified camera lines. A window only opens on a stopped line in Camera mode, at the window frequency, and the Frequency and Mode registers are not changed.
+    /// </summary>
+    [Description("Enables the acquisition schedule on the specified camera lines. A window only opens on a stopped line in Camera mode, at the window frequency, and the Frequency and Mode registers are not changed.")]
+    public partial class ScheduleEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduleEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 76;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ScheduleEnable"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ScheduleEnable"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ScheduleEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Cameras GetPayload(HarpMessage message)
+        {
+            return (Cameras)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ScheduleEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Cameras> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((Cameras)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ScheduleEnable"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduleEnable"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Cameras value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ScheduleEnable"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduleEnable"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Cameras value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ScheduleEnable register.
+    /// </summary>
+    /// <seealso cref="ScheduleEnable"/>
+    [Description("Filters and selects timestamped messages from the ScheduleEnable register.")]
+    public partial class TimestampedScheduleEnable
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduleEnable"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ScheduleEnable.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ScheduleEnable"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Cameras> GetPayload(HarpMessage message)
+        {
+            return ScheduleEnable.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the camera lines with an open acquisition schedule window. An event is sent when a window opens or closes.
+    /// </summary>
+    [Description("Reports the camera lines with an open acquisition schedule window. An event is sent when a window opens or closes.")]
+    public partial class ScheduleWindows
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduleWindows"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 77;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ScheduleWindows"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ScheduleWindows"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ScheduleWindows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Cameras GetPayload(HarpMessage message)
+        {
+            return (Cameras)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ScheduleWindows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Cameras> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((Cameras)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ScheduleWindows"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduleWindows"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Cameras value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ScheduleWindows"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ScheduleWindows"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Cameras value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ScheduleWindows register.
+    /// </summary>
+    /// <seealso cref="ScheduleWindows"/>
+    [Description("Filters and selects timestamped messages from the ScheduleWindows register.")]
+    public partial class TimestampedScheduleWindows
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ScheduleWindows"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ScheduleWindows.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ScheduleWindows"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Cameras> GetPayload(HarpMessage message)
+        {
+            return ScheduleWindows.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the period (s) of the acquisition schedule of Camera 0, counted from the Harp time origin.
+    /// </summary>
+    [Description("Configures the period (s) of the acquisition schedule of Camera 0, counted from the Harp time origin.")]
+    public partial class Camera0SchedulePeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0SchedulePeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 78;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera0SchedulePeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera0SchedulePeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera0SchedulePeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera0SchedulePeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera0SchedulePeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0SchedulePeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera0SchedulePeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0SchedulePeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera0SchedulePeriod register.
+    /// </summary>
+    /// <seealso cref="Camera0SchedulePeriod"/>
+    [Description("Filters and selects timestamped messages from the Camera0SchedulePeriod register.")]
+    public partial class TimestampedCamera0SchedulePeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0SchedulePeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera0SchedulePeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera0SchedulePeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return Camera0SchedulePeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures up to 4 acquisition windows of Camera 0 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.
+    /// </summary>
+    [Description("Configures up to 4 acquisition windows of Camera 0 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.")]
+    public partial class Camera0Schedule
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0Schedule"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 79;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera0Schedule"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera0Schedule"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 12;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera0Schedule"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera0Schedule"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera0Schedule"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0Schedule"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera0Schedule"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera0Schedule"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera0Schedule register.
+    /// </summary>
+    /// <seealso cref="Camera0Schedule"/>
+    [Description("Filters and selects timestamped messages from the Camera0Schedule register.")]
+    public partial class TimestampedCamera0Schedule
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera0Schedule"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera0Schedule.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera0Schedule"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return Camera0Schedule.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the period (s) of the acquisition schedule of Camera 1, counted from the Harp time origin.
+    /// </summary>
+    [Description("Configures the period (s) of the acquisition schedule of Camera 1, counted from the Harp time origin.")]
+    public partial class Camera1SchedulePeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1SchedulePeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 80;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera1SchedulePeriod"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera1SchedulePeriod"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera1SchedulePeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera1SchedulePeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt32();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera1SchedulePeriod"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1SchedulePeriod"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera1SchedulePeriod"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1SchedulePeriod"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera1SchedulePeriod register.
+    /// </summary>
+    /// <seealso cref="Camera1SchedulePeriod"/>
+    [Description("Filters and selects timestamped messages from the Camera1SchedulePeriod register.")]
+    public partial class TimestampedCamera1SchedulePeriod
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1SchedulePeriod"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera1SchedulePeriod.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera1SchedulePeriod"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint> GetPayload(HarpMessage message)
+        {
+            return Camera1SchedulePeriod.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures up to 4 acquisition windows of Camera 1 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.
+    /// </summary>
+    [Description("Configures up to 4 acquisition windows of Camera 1 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.")]
+    public partial class Camera1Schedule
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1Schedule"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 81;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Camera1Schedule"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Camera1Schedule"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 12;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Camera1Schedule"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Camera1Schedule"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Camera1Schedule"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1Schedule"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Camera1Schedule"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Camera1Schedule"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Camera1Schedule register.
+    /// </summary>
+    /// <seealso cref="Camera1Schedule"/>
+    [Description("Filters and selects timestamped messages from the Camera1Schedule register.")]
+    public partial class TimestampedCamera1Schedule
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Camera1Schedule"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Camera1Schedule.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Camera1Schedule"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return Camera1Schedule.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that moves the servo motor 0 to the specified pulse width (us) using the configured motion profile.
+    /// </summary>
+    [Description("Moves the servo motor 0 to the specified pulse width (us) using the configured motion profile.")]
+    public partial class Servo0Target
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0Target"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 82;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo0Target"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo0Target"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo0Target"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo0Target"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo0Target"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0Target"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo0Target"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0Target"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo0Target register.
+    /// </summary>
+    /// <seealso cref="Servo0Target"/>
+    [Description("Filters and selects timestamped messages from the Servo0Target register.")]
+    public partial class TimestampedServo0Target
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0Target"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo0Target.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo0Target"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Servo0Target.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the maximum velocity (us/s) of the servo motor 0 moves. If zero, the velocity is not limited.
+    /// </summary>
+    [Description("Configures the maximum velocity (us/s) of the servo motor 0 moves. If zero, the velocity is not limited.")]
+    public partial class Servo0MaxVelocity
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0MaxVelocity"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 83;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo0MaxVelocity"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo0MaxVelocity"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo0MaxVelocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo0MaxVelocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo0MaxVelocity"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0MaxVelocity"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo0MaxVelocity"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0MaxVelocity"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo0MaxVelocity register.
+    /// </summary>
+    /// <seealso cref="Servo0MaxVelocity"/>
+    [Description("Filters and selects timestamped messages from the Servo0MaxVelocity register.")]
+    public partial class TimestampedServo0MaxVelocity
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0MaxVelocity"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo0MaxVelocity.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo0MaxVelocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Servo0MaxVelocity.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the acceleration (us/s^2) of the servo motor 0 moves. If zero, the acceleration is not limited.
+    /// </summary>
+    [Description("Configures the acceleration (us/s^2) of the servo motor 0 moves. If zero, the acceleration is not limited.")]
+    public partial class Servo0Acceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0Acceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 84;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo0Acceleration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo0Acceleration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo0Acceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo0Acceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo0Acceleration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0Acceleration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo0Acceleration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0Acceleration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo0Acceleration register.
+    /// </summary>
+    /// <seealso cref="Servo0Acceleration"/>
+    [Description("Filters and selects timestamped messages from the Servo0Acceleration register.")]
+    public partial class TimestampedServo0Acceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0Acceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo0Acceleration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo0Acceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Servo0Acceleration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the motion profile of the servo motor 0 moves.
+    /// </summary>
+    [Description("Configures the motion profile of the servo motor 0 moves.")]
+    public partial class Servo0Profile
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0Profile"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 85;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo0Profile"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo0Profile"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo0Profile"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static MotionProfileConfig GetPayload(HarpMessage message)
+        {
+            return (MotionProfileConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo0Profile"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<MotionProfileConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((MotionProfileConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo0Profile"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0Profile"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, MotionProfileConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo0Profile"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0Profile"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, MotionProfileConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo0Profile register.
+    /// </summary>
+    /// <seealso cref="Servo0Profile"/>
+    [Description("Filters and selects timestamped messages from the Servo0Profile register.")]
+    public partial class TimestampedServo0Profile
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0Profile"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo0Profile.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo0Profile"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<MotionProfileConfig> GetPayload(HarpMessage message)
+        {
+            return Servo0Profile.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that moves the servo motor 1 to the specified pulse width (us) using the configured motion profile.
+    /// </summary>
+    [Description("Moves the servo motor 1 to the specified pulse width (us) using the configured motion profile.")]
+    public partial class Servo1Target
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1Target"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 86;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo1Target"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo1Target"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo1Target"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo1Target"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo1Target"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1Target"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo1Target"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1Target"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo1Target register.
+    /// </summary>
+    /// <seealso cref="Servo1Target"/>
+    [Description("Filters and selects timestamped messages from the Servo1Target register.")]
+    public partial class TimestampedServo1Target
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1Target"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo1Target.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo1Target"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Servo1Target.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the maximum velocity (us/s) of the servo motor 1 moves. If zero, the velocity is not limited.
+    /// </summary>
+    [Description("Configures the maximum velocity (us/s) of the servo motor 1 moves. If zero, the velocity is not limited.")]
+    public partial class Servo1MaxVelocity
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1MaxVelocity"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 87;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo1MaxVelocity"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo1MaxVelocity"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo1MaxVelocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo1MaxVelocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo1MaxVelocity"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1MaxVelocity"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo1MaxVelocity"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1MaxVelocity"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo1MaxVelocity register.
+    /// </summary>
+    /// <seealso cref="Servo1MaxVelocity"/>
+    [Description("Filters and selects timestamped messages from the Servo1MaxVelocity register.")]
+    public partial class TimestampedServo1MaxVelocity
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1MaxVelocity"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo1MaxVelocity.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo1MaxVelocity"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Servo1MaxVelocity.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the acceleration (us/s^2) of the servo motor 1 moves. If zero, the acceleration is not limited.
+    /// </summary>
+    [Description("Configures the acceleration (us/s^2) of the servo motor 1 moves. If zero, the acceleration is not limited.")]
+    public partial class Servo1Acceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1Acceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 88;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo1Acceleration"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo1Acceleration"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo1Acceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo1Acceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo1Acceleration"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1Acceleration"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo1Acceleration"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1Acceleration"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo1Acceleration register.
+    /// </summary>
+    /// <seealso cref="Servo1Acceleration"/>
+    [Description("Filters and selects timestamped messages from the Servo1Acceleration register.")]
+    public partial class TimestampedServo1Acceleration
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1Acceleration"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo1Acceleration.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo1Acceleration"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Servo1Acceleration.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the motion profile of the servo motor 1 moves.
+    /// </summary>
+    [Description("Configures the motion profile of the servo motor 1 moves.")]
+    public partial class Servo1Profile
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1Profile"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 89;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo1Profile"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo1Profile"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo1Profile"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static MotionProfileConfig GetPayload(HarpMessage message)
+        {
+            return (MotionProfileConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo1Profile"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<MotionProfileConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((MotionProfileConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo1Profile"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1Profile"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, MotionProfileConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo1Profile"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1Profile"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, MotionProfileConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo1Profile register.
+    /// </summary>
+    /// <seealso cref="Servo1Profile"/>
+    [Description("Filters and selects timestamped messages from the Servo1Profile register.")]
+    public partial class TimestampedServo1Profile
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1Profile"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo1Profile.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo1Profile"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<MotionProfileConfig> GetPayload(HarpMessage message)
+        {
+            return Servo1Profile.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the servo motors moving to their target or playing a trajectory. An event is sent when a move or trajectory completes.
+    /// </summary>
+    [Description("Reports the servo motors moving to their target or playing a trajectory. An event is sent when a move or trajectory completes.")]
+    public partial class ServoMoving
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ServoMoving"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 90;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ServoMoving"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ServoMoving"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ServoMoving"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Servos GetPayload(HarpMessage message)
+        {
+            return (Servos)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ServoMoving"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Servos> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((Servos)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ServoMoving"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ServoMoving"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Servos value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ServoMoving"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ServoMoving"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Servos value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ServoMoving register.
+    /// </summary>
+    /// <seealso cref="ServoMoving"/>
+    [Description("Filters and selects timestamped messages from the ServoMoving register.")]
+    public partial class TimestampedServoMoving
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ServoMoving"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ServoMoving.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ServoMoving"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Servos> GetPayload(HarpMessage message)
+        {
+            return ServoMoving.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the trajectory of servo motor 0 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.
+    /// </summary>
+    [Description("Configures the trajectory of servo motor 0 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.")]
+    public partial class Servo0Waypoints
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0Waypoints"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 91;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo0Waypoints"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo0Waypoints"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo0Waypoints"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo0Waypoints"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo0Waypoints"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0Waypoints"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo0Waypoints"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0Waypoints"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo0Waypoints register.
+    /// </summary>
+    /// <seealso cref="Servo0Waypoints"/>
+    [Description("Filters and selects timestamped messages from the Servo0Waypoints register.")]
+    public partial class TimestampedServo0Waypoints
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0Waypoints"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo0Waypoints.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo0Waypoints"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return Servo0Waypoints.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the number of waypoints used from the Servo0Waypoints register. The write fails while a playback is queued.
+    /// </summary>
+    [Description("Configures the number of waypoints used from the Servo0Waypoints register. The write fails while a playback is queued.")]
+    public partial class Servo0WaypointCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0WaypointCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 92;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo0WaypointCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo0WaypointCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo0WaypointCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo0WaypointCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo0WaypointCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0WaypointCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo0WaypointCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0WaypointCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo0WaypointCount register.
+    /// </summary>
+    /// <seealso cref="Servo0WaypointCount"/>
+    [Description("Filters and selects timestamped messages from the Servo0WaypointCount register.")]
+    public partial class TimestampedServo0WaypointCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0WaypointCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo0WaypointCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo0WaypointCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return Servo0WaypointCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the trajectory of servo motor 1 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.
+    /// </summary>
+    [Description("Configures the trajectory of servo motor 1 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.")]
+    public partial class Servo1Waypoints
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1Waypoints"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 93;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo1Waypoints"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo1Waypoints"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 16;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo1Waypoints"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo1Waypoints"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo1Waypoints"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1Waypoints"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo1Waypoints"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1Waypoints"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo1Waypoints register.
+    /// </summary>
+    /// <seealso cref="Servo1Waypoints"/>
+    [Description("Filters and selects timestamped messages from the Servo1Waypoints register.")]
+    public partial class TimestampedServo1Waypoints
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1Waypoints"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo1Waypoints.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo1Waypoints"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return Servo1Waypoints.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the number of waypoints used from the Servo1Waypoints register. The write fails while a playback is queued.
+    /// </summary>
+    [Description("Configures the number of waypoints used from the Servo1Waypoints register. The write fails while a playback is queued.")]
+    public partial class Servo1WaypointCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1WaypointCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 94;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo1WaypointCount"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo1WaypointCount"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo1WaypointCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo1WaypointCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo1WaypointCount"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1WaypointCount"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo1WaypointCount"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1WaypointCount"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo1WaypointCount register.
+    /// </summary>
+    /// <seealso cref="Servo1WaypointCount"/>
+    [Description("Filters and selects timestamped messages from the Servo1WaypointCount register.")]
+    public partial class TimestampedServo1WaypointCount
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1WaypointCount"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo1WaypointCount.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo1WaypointCount"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return Servo1WaypointCount.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that starts the trajectory playback on the specified servo motors. On a servo motor playing a trajectory, the playback of the uploaded waypoints is queued and starts on the PWM period that ends the current trajectory.
+    /// </summary>
+    [Description("Starts the trajectory playback on the specified servo motors. On a servo motor playing a trajectory, the playback of the uploaded waypoints is queued and starts on the PWM period that ends the current trajectory.")]
+    public partial class ServoPlay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ServoPlay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 95;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ServoPlay"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ServoPlay"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ServoPlay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Servos GetPayload(HarpMessage message)
+        {
+            return (Servos)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ServoPlay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Servos> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((Servos)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ServoPlay"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ServoPlay"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Servos value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ServoPlay"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ServoPlay"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Servos value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ServoPlay register.
+    /// </summary>
+    /// <seealso cref="ServoPlay"/>
+    [Description("Filters and selects timestamped messages from the ServoPlay register.")]
+    public partial class TimestampedServoPlay
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ServoPlay"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ServoPlay.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ServoPlay"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Servos> GetPayload(HarpMessage message)
+        {
+            return ServoPlay.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the servo motors whose trajectory playback starts on each DI0 rising edge.
+    /// </summary>
+    [Description("Configures the servo motors whose trajectory playback starts on each DI0 rising edge.")]
+    public partial class ServoPlayOnDI0
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ServoPlayOnDI0"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 96;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ServoPlayOnDI0"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ServoPlayOnDI0"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ServoPlayOnDI0"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Servos GetPayload(HarpMessage message)
+        {
+            return (Servos)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ServoPlayOnDI0"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Servos> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((Servos)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ServoPlayOnDI0"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ServoPlayOnDI0"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Servos value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ServoPlayOnDI0"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ServoPlayOnDI0"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Servos value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ServoPlayOnDI0 register.
+    /// </summary>
+    /// <seealso cref="ServoPlayOnDI0"/>
+    [Description("Filters and selects timestamped messages from the ServoPlayOnDI0 register.")]
+    public partial class TimestampedServoPlayOnDI0
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ServoPlayOnDI0"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ServoPlayOnDI0.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ServoPlayOnDI0"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Servos> GetPayload(HarpMessage message)
+        {
+            return ServoPlayOnDI0.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the servo 0 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.
+    /// </summary>
+    [Description("Configures the servo 0 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.")]
+    public partial class Servo0PulseWidthFine
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0PulseWidthFine"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 97;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo0PulseWidthFine"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo0PulseWidthFine"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo0PulseWidthFine"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo0PulseWidthFine"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo0PulseWidthFine"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0PulseWidthFine"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo0PulseWidthFine"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0PulseWidthFine"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo0PulseWidthFine register.
+    /// </summary>
+    /// <seealso cref="Servo0PulseWidthFine"/>
+    [Description("Filters and selects timestamped messages from the Servo0PulseWidthFine register.")]
+    public partial class TimestampedServo0PulseWidthFine
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0PulseWidthFine"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo0PulseWidthFine.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo0PulseWidthFine"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Servo0PulseWidthFine.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that configures the servo 1 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.
+    /// </summary>
+    [Description("Configures the servo 1 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.")]
+    public partial class Servo1PulseWidthFine
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1PulseWidthFine"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 98;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo1PulseWidthFine"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo1PulseWidthFine"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo1PulseWidthFine"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo1PulseWidthFine"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo1PulseWidthFine"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1PulseWidthFine"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo1PulseWidthFine"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1PulseWidthFine"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo1PulseWidthFine register.
+    /// </summary>
+    /// <seealso cref="Servo1PulseWidthFine"/>
+    [Description("Filters and selects timestamped messages from the Servo1PulseWidthFine register.")]
+    public partial class TimestampedServo1PulseWidthFine
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1PulseWidthFine"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo1PulseWidthFine.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo1PulseWidthFine"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return Servo1PulseWidthFine.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that queues a batch of servo 0 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.
+    /// </summary>
+    [Description("Queues a batch of servo 0 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.")]
+    public partial class Servo0SetpointFifo
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0SetpointFifo"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 99;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo0SetpointFifo"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo0SetpointFifo"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo0SetpointFifo"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo0SetpointFifo"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo0SetpointFifo"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0SetpointFifo"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo0SetpointFifo"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo0SetpointFifo"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo0SetpointFifo register.
+    /// </summary>
+    /// <seealso cref="Servo0SetpointFifo"/>
+    [Description("Filters and selects timestamped messages from the Servo0SetpointFifo register.")]
+    public partial class TimestampedServo0SetpointFifo
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo0SetpointFifo"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo0SetpointFifo.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo0SetpointFifo"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return Servo0SetpointFifo.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that queues a batch of servo 1 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.
+    /// </summary>
+    [Description("Queues a batch of servo 1 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.")]
+    public partial class Servo1SetpointFifo
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1SetpointFifo"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 100;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Servo1SetpointFifo"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Servo1SetpointFifo"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 8;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Servo1SetpointFifo"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Servo1SetpointFifo"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Servo1SetpointFifo"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1SetpointFifo"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Servo1SetpointFifo"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Servo1SetpointFifo"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Servo1SetpointFifo register.
+    /// </summary>
+    /// <seealso cref="Servo1SetpointFifo"/>
+    [Description("Filters and selects timestamped messages from the Servo1SetpointFifo register.")]
+    public partial class TimestampedServo1SetpointFifo
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Servo1SetpointFifo"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Servo1SetpointFifo.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Servo1SetpointFifo"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return Servo1SetpointFifo.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the number of setpoint FIFO underruns of each servo motor. An event is sent when a FIFO runs empty, and the last pulse width is kept.
+    /// </summary>
+    [Description("Reports the number of setpoint FIFO underruns of each servo motor. An event is sent when a FIFO runs empty, and the last pulse width is kept.")]
+    public partial class ServoUnderruns
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ServoUnderruns"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 101;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ServoUnderruns"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ServoUnderruns"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ServoUnderruns"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ServoUnderruns"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ServoUnderruns"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ServoUnderruns"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ServoUnderruns"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ServoUnderruns"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ServoUnderruns register.
+    /// </summary>
+    /// <seealso cref="ServoUnderruns"/>
+    [Description("Filters and selects timestamped messages from the ServoUnderruns register.")]
+    public partial class TimestampedServoUnderruns
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ServoUnderruns"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ServoUnderruns.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ServoUnderruns"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return ServoUnderruns.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the function holding each timer, in the order TCC0 (Camera/Servo 0), TCC1, TCD0 (Camera/Servo 1), TCD1 and TCE0. TCC1 is the Harp timestamp timer and always reports 8. 0: free, 1: Camera, 2: Servo, 3: ExternalClock or OneShot (TCE0 measures the DI0 period), 4: Sequence, 5: clock discipline (TCD1), 6: CameraSoftTrigger, 7: trigger jitter measurement (TCE0), 8: Harp core.
+    /// </summary>
+    [Description("Reports the function holding each timer, in the order TCC0 (Camera/Servo 0), TCC1, TCD0 (Camera/Servo 1), TCD1 and TCE0. TCC1 is the Harp timestamp timer and always reports 8. 0: free, 1: Camera, 2: Servo, 3: ExternalClock or OneShot (TCE0 measures the DI0 period), 4: Sequence, 5: clock discipline (TCD1), 6: CameraSoftTrigger, 7: trigger jitter measurement (TCE0), 8: Harp core.")]
+    public partial class TimerOwners
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TimerOwners"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 102;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TimerOwners"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TimerOwners"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 5;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TimerOwners"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TimerOwners"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TimerOwners"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TimerOwners"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TimerOwners"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TimerOwners"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TimerOwners register.
+    /// </summary>
+    /// <seealso cref="TimerOwners"/>
+    [Description("Filters and selects timestamped messages from the TimerOwners register.")]
+    public partial class TimestampedTimerOwners
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TimerOwners"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TimerOwners.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TimerOwners"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return TimerOwners.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that restarts the PWM period of the specified running servo motors on the same clock cycle. The period in progress is cut short on each servo motor restarted. Servos with the same period stay phase-aligned.
+    /// </summary>
+    [Description("Restarts the PWM period of the specified running servo motors on the same clock cycle. The period in progress is cut short on each servo motor restarted. Servos with the same period stay phase-aligned.")]
+    public partial class ServoAlign
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ServoAlign"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 103;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ServoAlign"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ServoAlign"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ServoAlign"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Servos GetPayload(HarpMessage message)
+        {
+            return (Servos)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ServoAlign"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Servos> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((Servos)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ServoAlign"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ServoAlign"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Servos value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ServoAlign"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ServoAlign"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Servos value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ServoAlign register.
+    /// </summary>
+    /// <seealso cref="ServoAlign"/>
+    [Description("Filters and selects timestamped messages from the ServoAlign register.")]
+    public partial class TimestampedServoAlign
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ServoAlign"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ServoAlign.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ServoAlign"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Servos> GetPayload(HarpMessage message)
+        {
+            return ServoAlign.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the state of each camera/servo line. 0: idle, 1: starting (a start waits for the stop in progress), 2: running camera triggers, 3: stopping after the current trigger, 4: running a servo. An event is sent on each change.
+    /// </summary>
+    [Description("Reports the state of each camera/servo line. 0: idle, 1: starting (a start waits for the stop in progress), 2: running camera triggers, 3: stopping after the current trigger, 4: running a servo. An event is sent on each change.")]
+    public partial class ChannelState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 104;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ChannelState"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ChannelState"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ChannelState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ChannelState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ChannelState"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelState"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ChannelState"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ChannelState"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ChannelState register.
+    /// </summary>
+    /// <seealso cref="ChannelState"/>
+    [Description("Filters and selects timestamped messages from the ChannelState register.")]
+    public partial class TimestampedChannelState
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ChannelState"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ChannelState.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ChannelState"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return ChannelState.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that fires a single trigger pulse with the configured TriggerWidth on the specified cameras, at the same time. The pulse starts while the command is handled, a few us after it is received, and a Camera event is sent. The sync output is not changed. The write fails if a specified line is not stopped.
+    /// </summary>
+    [Description("Fires a single trigger pulse with the configured TriggerWidth on the specified cameras, at the same time. The pulse starts while the command is handled, a few us after it is received, and a Camera event is sent. The sync output is not changed. The write fails if a specified line is not stopped.")]
+    public partial class CameraSoftTrigger
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CameraSoftTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 105;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="CameraSoftTrigger"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="CameraSoftTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="CameraSoftTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static Cameras GetPayload(HarpMessage message)
+        {
+            return (Cameras)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="CameraSoftTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Cameras> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((Cameras)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="CameraSoftTrigger"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CameraSoftTrigger"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, Cameras value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="CameraSoftTrigger"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="CameraSoftTrigger"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, Cameras value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// CameraSoftTrigger register.
+    /// </summary>
+    /// <seealso cref="CameraSoftTrigger"/>
+    [Description("Filters and selects timestamped messages from the CameraSoftTrigger register.")]
+    public partial class TimestampedCameraSoftTrigger
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="CameraSoftTrigger"/> register. This field is constant.
+        /// </summary>
+        public const int Address = CameraSoftTrigger.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="CameraSoftTrigger"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<Cameras> GetPayload(HarpMessage message)
+        {
+            return CameraSoftTrigger.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that when set to 1, writes to the configuration registers are checked for address, type, length and value and queued instead of applied, up to 6 writes and 48 bytes, enough for one schedule. Writes to command and action registers, like CameraStart, CameraStop, CameraSoftTrigger, Servo0Target, ServoPlay or Servo0SetpointFifo, fail while staging. The write reply reports whether the write was queued and carries the previous value.
+    /// </summary>
+    [Description("When set to 1, writes to the configuration registers are checked for address, type, length and value and queued instead of applied, up to 6 writes and 48 bytes, enough for one schedule. Writes to command and action registers, like CameraStart, CameraStop, CameraSoftTrigger, Servo0Target, ServoPlay or Servo0SetpointFifo, fail while staging. The write reply reports whether the write was queued and carries the previous value.")]
+    public partial class ConfigStage
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ConfigStage"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 106;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ConfigStage"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ConfigStage"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ConfigStage"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ConfigStage"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ConfigStage"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ConfigStage"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ConfigStage"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ConfigStage"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ConfigStage register.
+    /// </summary>
+    /// <seealso cref="ConfigStage"/>
+    [Description("Filters and selects timestamped messages from the ConfigStage register.")]
+    public partial class TimestampedConfigStage
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ConfigStage"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ConfigStage.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ConfigStage"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return ConfigStage.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that applies or discards the queued writes. The queued writes are applied in order with the interrupts disabled, and the modes take effect once, from the final values. Reads the number of queued writes rejected by the last commit, and an event is sent when a commit completes.
+    /// </summary>
+    [Description("Applies or discards the queued writes. The queued writes are applied in order with the interrupts disabled, and the modes take effect once, from the final values. Reads the number of queued writes rejected by the last commit, and an event is sent when a commit completes.")]
+    public partial class ConfigCommit
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ConfigCommit"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 107;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ConfigCommit"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ConfigCommit"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ConfigCommit"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static CommitMode GetPayload(HarpMessage message)
+        {
+            return (CommitMode)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ConfigCommit"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CommitMode> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((CommitMode)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ConfigCommit"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ConfigCommit"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, CommitMode value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ConfigCommit"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ConfigCommit"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, CommitMode value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ConfigCommit register.
+    /// </summary>
+    /// <seealso cref="ConfigCommit"/>
+    [Description("Filters and selects timestamped messages from the ConfigCommit register.")]
+    public partial class TimestampedConfigCommit
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ConfigCommit"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ConfigCommit.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ConfigCommit"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<CommitMode> GetPayload(HarpMessage message)
+        {
+            return ConfigCommit.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that packed device state in one reply, multi-byte fields little-endian. 0: OutputState, 1: DigitalInputState, 2-3: ChannelState, 4: ServoMoving, 5: DI0Mode, 6: Control0Mode, 7: Control1Mode, 8-9: Camera0Frequency, 10-11: Camera1Frequency, 12-13: Servo0Period, 14-15: Servo1Period, 16-17: Servo0PulseWidthFine, 18-19: Servo1PulseWidthFine, 20-23: Camera0 trigger count, 24-27: Camera1 trigger count, 28-31: ServoUnderruns, 32: EnableEvents, 33: ClockDiscipline, 34: SyncInterval, 35: ScheduleEnable. The trigger counts include every trigger pulse since the last reset, whether or not its event was sent.
+    /// </summary>
+    [Description("Packed device state in one reply, multi-byte fields little-endian. 0: OutputState, 1: DigitalInputState, 2-3: ChannelState, 4: ServoMoving, 5: DI0Mode, 6: Control0Mode, 7: Control1Mode, 8-9: Camera0Frequency, 10-11: Camera1Frequency, 12-13: Servo0Period, 14-15: Servo1Period, 16-17: Servo0PulseWidthFine, 18-19: Servo1PulseWidthFine, 20-23: Camera0 trigger count, 24-27: Camera1 trigger count, 28-31: ServoUnderruns, 32: EnableEvents, 33: ClockDiscipline, 34: SyncInterval, 35: ScheduleEnable. The trigger counts include every trigger pulse since the last reset, whether or not its event was sent.")]
+    public partial class Snapshot
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Snapshot"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 108;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="Snapshot"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="Snapshot"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 36;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="Snapshot"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="Snapshot"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<byte>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="Snapshot"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Snapshot"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="Snapshot"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="Snapshot"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte[] value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// Snapshot register.
+    /// </summary>
+    /// <seealso cref="Snapshot"/>
+    [Description("Filters and selects timestamped messages from the Snapshot register.")]
+    public partial class TimestampedSnapshot
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="Snapshot"/> register. This field is constant.
+        /// </summary>
+        public const int Address = Snapshot.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="Snapshot"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte[]> GetPayload(HarpMessage message)
+        {
+            return Snapshot.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that inverts the specified output lines in the port, so an active trigger, sync or servo pulse drives the line low and the line idles high. Use it for cameras that trigger on a falling edge or need an active-low trigger. The levels in OutputState and the events keep reporting the logic level, and the change applies at once, also to a running line.
+    /// </summary>
+    [Description("Inverts the specified output lines in the port, so an active trigger, sync or servo pulse drives the line low and the line idles high. Use it for cameras that trigger on a falling edge or need an active-low trigger. The levels in OutputState and the events keep reporting the logic level, and the change applies at once, also to a running line.")]
+    public partial class OutputInvert
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OutputInvert"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 109;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="OutputInvert"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="OutputInvert"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="OutputInvert"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static DigitalOutputs GetPayload(HarpMessage message)
+        {
+            return (DigitalOutputs)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="OutputInvert"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalOutputs> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((DigitalOutputs)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="OutputInvert"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OutputInvert"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, DigitalOutputs value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="OutputInvert"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="OutputInvert"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, DigitalOutputs value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// OutputInvert register.
+    /// </summary>
+    /// <seealso cref="OutputInvert"/>
+    [Description("Filters and selects timestamped messages from the OutputInvert register.")]
+    public partial class TimestampedOutputInvert
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="OutputInvert"/> register. This field is constant.
+        /// </summary>
+        public const int Address = OutputInvert.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="OutputInvert"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<DigitalOutputs> GetPayload(HarpMessage message)
+        {
+            return OutputInvert.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that execution time of the ISR selected by IsrProfileSlot in CPU cycles (31.25 ns), from firmware built with ISR_PROFILING defined. Otherwise the register reads all zeros. Count (saturated), min, max, mean, then a histogram of counts below 32, 64, 128, 256, 512, 1024 and 2048 cycles and from 2048 cycles.
+    /// </summary>
+    [Description("Execution time of the ISR selected by IsrProfileSlot in CPU cycles (31.25 ns), from firmware built with ISR_PROFILING defined. Otherwise the register reads all zeros. Count (saturated), min, max, mean, then a histogram of counts below 32, 64, 128, 256, 512, 1024 and 2048 cycles and from 2048 cycles.")]
+    public partial class IsrProfile
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IsrProfile"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 110;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="IsrProfile"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="IsrProfile"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 12;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="IsrProfile"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="IsrProfile"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="IsrProfile"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IsrProfile"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="IsrProfile"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IsrProfile"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// IsrProfile register.
+    /// </summary>
+    /// <seealso cref="IsrProfile"/>
+    [Description("Filters and selects timestamped messages from the IsrProfile register.")]
+    public partial class TimestampedIsrProfile
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IsrProfile"/> register. This field is constant.
+        /// </summary>
+        public const int Address = IsrProfile.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="IsrProfile"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return IsrProfile.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that write 1 to clear the ISR execution time statistics.
+    /// </summary>
+    [Description("Write 1 to clear the ISR execution time statistics.")]
+    public partial class IsrProfileReset
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IsrProfileReset"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 111;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="IsrProfileReset"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="IsrProfileReset"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="IsrProfileReset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="IsrProfileReset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="IsrProfileReset"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IsrProfileReset"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="IsrProfileReset"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IsrProfileReset"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// IsrProfileReset register.
+    /// </summary>
+    /// <seealso cref="IsrProfileReset"/>
+    [Description("Filters and selects timestamped messages from the IsrProfileReset register.")]
+    public partial class TimestampedIsrProfileReset
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IsrProfileReset"/> register. This field is constant.
+        /// </summary>
+        public const int Address = IsrProfileReset.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="IsrProfileReset"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return IsrProfileReset.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that selects the trigger line whose rising edges are fed back to TCE0 to measure the actual trigger period. Only periods of a line in Camera mode are measured. The write fails while DI0 is used as an external clock, and starting the external clock turns the measurement off.
+    /// </summary>
+    [Description("Selects the trigger line whose rising edges are fed back to TCE0 to measure the actual trigger period. Only periods of a line in Camera mode are measured. The write fails while DI0 is used as an external clock, and starting the external clock turns the measurement off.")]
+    public partial class TriggerJitterMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerJitterMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 112;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TriggerJitterMode"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TriggerJitterMode"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TriggerJitterMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static TriggerJitterModeConfig GetPayload(HarpMessage message)
+        {
+            return (TriggerJitterModeConfig)message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TriggerJitterMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TriggerJitterModeConfig> GetTimestampedPayload(HarpMessage message)
+        {
+            var payload = message.GetTimestampedPayloadByte();
+            return Timestamped.Create((TriggerJitterModeConfig)payload.Value, payload.Seconds);
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TriggerJitterMode"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerJitterMode"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, TriggerJitterModeConfig value)
+        {
+            return HarpMessage.FromByte(Address, messageType, (byte)value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TriggerJitterMode"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerJitterMode"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, TriggerJitterModeConfig value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, (byte)value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TriggerJitterMode register.
+    /// </summary>
+    /// <seealso cref="TriggerJitterMode"/>
+    [Description("Filters and selects timestamped messages from the TriggerJitterMode register.")]
+    public partial class TimestampedTriggerJitterMode
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerJitterMode"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TriggerJitterMode.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TriggerJitterMode"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<TriggerJitterModeConfig> GetPayload(HarpMessage message)
+        {
+            return TriggerJitterMode.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that periods further than this from the nominal period of the camera frequency are counted as outliers (ns). Applied from the next Harp second.
+    /// </summary>
+    [Description("Periods further than this from the nominal period of the camera frequency are counted as outliers (ns). Applied from the next Harp second.")]
+    public partial class TriggerJitterThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerJitterThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 113;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TriggerJitterThreshold"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TriggerJitterThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TriggerJitterThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TriggerJitterThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TriggerJitterThreshold"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerJitterThreshold"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TriggerJitterThreshold"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerJitterThreshold"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TriggerJitterThreshold register.
+    /// </summary>
+    /// <seealso cref="TriggerJitterThreshold"/>
+    [Description("Filters and selects timestamped messages from the TriggerJitterThreshold register.")]
+    public partial class TimestampedTriggerJitterThreshold
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerJitterThreshold"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TriggerJitterThreshold.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TriggerJitterThreshold"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return TriggerJitterThreshold.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that trigger period statistics of the last Harp second, updated and sent as an event each second while enabled: count, mean (ns), standard deviation (ns), min (ns), max (ns) and outliers. Deviations beyond 1023 ticks of the measurement time base are clamped for the mean and standard deviation and counted as outliers.
+    /// </summary>
+    [Description("Trigger period statistics of the last Harp second, updated and sent as an event each second while enabled: count, mean (ns), standard deviation (ns), min (ns), max (ns) and outliers. Deviations beyond 1023 ticks of the measurement time base are clamped for the mean and standard deviation and counted as outliers.")]
+    public partial class TriggerJitterStats
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerJitterStats"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 114;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="TriggerJitterStats"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U32;
+
+        /// <summary>
+        /// Represents the length of the <see cref="TriggerJitterStats"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 6;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="TriggerJitterStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static uint[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="TriggerJitterStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<uint>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="TriggerJitterStats"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerJitterStats"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="TriggerJitterStats"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="TriggerJitterStats"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, uint[] value)
+        {
+            return HarpMessage.FromUInt32(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// TriggerJitterStats register.
+    /// </summary>
+    /// <seealso cref="TriggerJitterStats"/>
+    [Description("Filters and selects timestamped messages from the TriggerJitterStats register.")]
+    public partial class TimestampedTriggerJitterStats
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="TriggerJitterStats"/> register. This field is constant.
+        /// </summary>
+        public const int Address = TriggerJitterStats.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="TriggerJitterStats"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<uint[]> GetPayload(HarpMessage message)
+        {
+            return TriggerJitterStats.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that bytes of RAM above the variables that the stack has not reached since the reset, the headroom left after the deepest ISR nesting seen so far.
+    /// </summary>
+    [Description("Bytes of RAM above the variables that the stack has not reached since the reset, the headroom left after the deepest ISR nesting seen so far.")]
+    public partial class StackFree
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StackFree"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 115;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="StackFree"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="StackFree"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="StackFree"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="StackFree"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadUInt16();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="StackFree"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StackFree"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="StackFree"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="StackFree"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// StackFree register.
+    /// </summary>
+    /// <seealso cref="StackFree"/>
+    [Description("Filters and selects timestamped messages from the StackFree register.")]
+    public partial class TimestampedStackFree
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="StackFree"/> register. This field is constant.
+        /// </summary>
+        public const int Address = StackFree.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="StackFree"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort> GetPayload(HarpMessage message)
+        {
+            return StackFree.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that reports the number of DI0 edges skipped on each camera since ExternalClock or OneShot mode was started. An edge is skipped when the DI0 interrupt comes too late to arm the trigger before the delay elapses, or when the DI0 period over the multiplier is out of range.
+    /// </summary>
+    [Description("Reports the number of DI0 edges skipped on each camera since ExternalClock or OneShot mode was started. An edge is skipped when the DI0 interrupt comes too late to arm the trigger before the delay elapses, or when the DI0 period over the multiplier is out of range.")]
+    public partial class ExternalClockSkips
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ExternalClockSkips"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 116;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="ExternalClockSkips"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U16;
+
+        /// <summary>
+        /// Represents the length of the <see cref="ExternalClockSkips"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 2;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="ExternalClockSkips"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static ushort[] GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="ExternalClockSkips"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadArray<ushort>();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="ExternalClockSkips"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ExternalClockSkips"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="ExternalClockSkips"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="ExternalClockSkips"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, ushort[] value)
+        {
+            return HarpMessage.FromUInt16(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// ExternalClockSkips register.
+    /// </summary>
+    /// <seealso cref="ExternalClockSkips"/>
+    [Description("Filters and selects timestamped messages from the ExternalClockSkips register.")]
+    public partial class TimestampedExternalClockSkips
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="ExternalClockSkips"/> register. This field is constant.
+        /// </summary>
+        public const int Address = ExternalClockSkips.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="ExternalClockSkips"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<ushort[]> GetPayload(HarpMessage message)
+        {
+            return ExternalClockSkips.GetTimestampedPayload(message);
+        }
+    }
+
+    /// <summary>
+    /// Represents a register that selects the ISR reported by IsrProfile: 0 DI0 edges, 1 Camera0/Servo0 period, 2 Camera1/Servo1 period, 3 Camera0 compare, 4 Camera1 compare, 5 trigger jitter capture.
+    /// </summary>
+    [Description("Selects the ISR reported by IsrProfile: 0 DI0 edges, 1 Camera0/Servo0 period, 2 Camera1/Servo1 period, 3 Camera0 compare, 4 Camera1 compare, 5 trigger jitter capture.")]
+    public partial class IsrProfileSlot
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IsrProfileSlot"/> register. This field is constant.
+        /// </summary>
+        public const int Address = 117;
+
+        /// <summary>
+        /// Represents the payload type of the <see cref="IsrProfileSlot"/> register. This field is constant.
+        /// </summary>
+        public const PayloadType RegisterType = PayloadType.U8;
+
+        /// <summary>
+        /// Represents the length of the <see cref="IsrProfileSlot"/> register. This field is constant.
+        /// </summary>
+        public const int RegisterLength = 1;
+
+        /// <summary>
+        /// Returns the payload data for <see cref="IsrProfileSlot"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the message payload.</returns>
+        public static byte GetPayload(HarpMessage message)
+        {
+            return message.GetPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns the timestamped payload data for <see cref="IsrProfileSlot"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetTimestampedPayload(HarpMessage message)
+        {
+            return message.GetTimestampedPayloadByte();
+        }
+
+        /// <summary>
+        /// Returns a Harp message for the <see cref="IsrProfileSlot"/> register.
+        /// </summary>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IsrProfileSlot"/> register
+        /// with the specified message type and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, messageType, value);
+        }
+
+        /// <summary>
+        /// Returns a timestamped Harp message for the <see cref="IsrProfileSlot"/>
+        /// register.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">The type of the Harp message.</param>
+        /// <param name="value">The value to be stored in the message payload.</param>
+        /// <returns>
+        /// A <see cref="HarpMessage"/> object for the <see cref="IsrProfileSlot"/> register
+        /// with the specified message type, timestamp, and payload.
+        /// </returns>
+        public static HarpMessage FromPayload(double timestamp, MessageType messageType, byte value)
+        {
+            return HarpMessage.FromByte(Address, timestamp, messageType, value);
+        }
+    }
+
+    /// <summary>
+    /// Provides methods for manipulating timestamped messages from the
+    /// IsrProfileSlot register.
+    /// </summary>
+    /// <seealso cref="IsrProfileSlot"/>
+    [Description("Filters and selects timestamped messages from the IsrProfileSlot register.")]
+    public partial class TimestampedIsrProfileSlot
+    {
+        /// <summary>
+        /// Represents the address of the <see cref="IsrProfileSlot"/> register. This field is constant.
+        /// </summary>
+        public const int Address = IsrProfileSlot.Address;
+
+        /// <summary>
+        /// Returns timestamped payload data for <see cref="IsrProfileSlot"/> register messages.
+        /// </summary>
+        /// <param name="message">A <see cref="HarpMessage"/> object representing the register message.</param>
+        /// <returns>A value representing the timestamped message payload.</returns>
+        public static Timestamped<byte> GetPayload(HarpMessage message)
+        {
+            return IsrProfileSlot.GetTimestampedPayload(message);
+        }
+    }
+
     /// <summary>
     /// Represents an operator which creates standard message payloads for the
     /// CameraController device.
     /// </summary>
-    /// <seealso cref="CreateCameraStartPayload"/>
-    /// <seealso cref="CreateCameraStopPayload"/>
-    /// <seealso cref="CreateServoEnablePayload"/>
-    /// <seealso cref="CreateServoDisablePayload"/>
-    /// <seealso cref="CreateOutputSetPayload"/>
-    /// <seealso cref="CreateOutputClearPayload"/>
-    /// <seealso cref="CreateOutputStatePayload"/>
-    /// <seealso cref="CreateDigitalInputStatePayload"/>
-    /// <seealso cref="CreateCamera0TriggerPayload"/>
-    /// <seealso cref="CreateCamera1TriggerPayload"/>
-    /// <seealso cref="CreateCamera0SyncPayload"/>
-    /// <seealso cref="CreateCamera1SyncPayload"/>
-    /// <seealso cref="CreateServoStatePayload"/>
-    /// <seealso cref="CreateSyncIntervalPayload"/>
-    /// <seealso cref="CreateDI0ModePayload"/>
-    /// <seealso cref="CreateControl0ModePayload"/>
-    /// <seealso cref="CreateCamera0FrequencyPayload"/>
-    /// <seealso cref="CreateServo0PeriodPayload"/>
-    /// <seealso cref="CreateServo0PulseWidthPayload"/>
-    /// <seealso cref="CreateControl1ModePayload"/>
-    /// <seealso cref="CreateCamera1FrequencyPayload"/>
-    /// <seealso cref="CreateServo1PeriodPayload"/>
-    /// <seealso cref="CreateServo1PulseWidthPayload"/>
-    /// <seealso cref="CreateEnableEventsPayload"/>
-    [XmlInclude(typeof(CreateCameraStartPayload))]
-    [XmlInclude(typeof(CreateCameraStopPayload))]
-    [XmlInclude(typeof(CreateServoEnablePayload))]
-    [XmlInclude(typeof(CreateServoDisablePayload))]
-    [XmlInclude(typeof(CreateOutputSetPayload))]
-    [XmlInclude(typeof(CreateOutputClearPayload))]
-    [XmlInclude(typeof(CreateOutputStatePayload))]
-    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateCamera0TriggerPayload))]
-    [XmlInclude(typeof(CreateCamera1TriggerPayload))]
-    [XmlInclude(typeof(CreateCamera0SyncPayload))]
-    [XmlInclude(typeof(CreateCamera1SyncPayload))]
-    [XmlInclude(typeof(CreateServoStatePayload))]
-    [XmlInclude(typeof(CreateSyncIntervalPayload))]
-    [XmlInclude(typeof(CreateDI0ModePayload))]
-    [XmlInclude(typeof(CreateControl0ModePayload))]
-    [XmlInclude(typeof(CreateCamera0FrequencyPayload))]
-    [XmlInclude(typeof(CreateServo0PeriodPayload))]
-    [XmlInclude(typeof(CreateServo0PulseWidthPayload))]
-    [XmlInclude(typeof(CreateControl1ModePayload))]
-    [XmlInclude(typeof(CreateCamera1FrequencyPayload))]
-    [XmlInclude(typeof(CreateServo1PeriodPayload))]
-    [XmlInclude(typeof(CreateServo1PulseWidthPayload))]
-    [XmlInclude(typeof(CreateEnableEventsPayload))]
-    [XmlInclude(typeof(CreateTimestampedCameraStartPayload))]
-    [XmlInclude(typeof(CreateTimestampedCameraStopPayload))]
-    [XmlInclude(typeof(CreateTimestampedServoEnablePayload))]
-    [XmlInclude(typeof(CreateTimestampedServoDisablePayload))]
-    [XmlInclude(typeof(CreateTimestampedOutputSetPayload))]
-    [XmlInclude(typeof(CreateTimestampedOutputClearPayload))]
-    [XmlInclude(typeof(CreateTimestampedOutputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedCamera0TriggerPayload))]
-    [XmlInclude(typeof(CreateTimestampedCamera1TriggerPayload))]
-    [XmlInclude(typeof(CreateTimestampedCamera0SyncPayload))]
-    [XmlInclude(typeof(CreateTimestampedCamera1SyncPayload))]
-    [XmlInclude(typeof(CreateTimestampedServoStatePayload))]
-    [XmlInclude(typeof(CreateTimestampedSyncIntervalPayload))]
-    [XmlInclude(typeof(CreateTimestampedDI0ModePayload))]
-    [XmlInclude(typeof(CreateTimestampedControl0ModePayload))]
-    [XmlInclude(typeof(CreateTimestampedCamera0FrequencyPayload))]
-    [XmlInclude(typeof(CreateTimestampedServo0PeriodPayload))]
-    [XmlInclude(typeof(CreateTimestampedServo0PulseWidthPayload))]
-    [XmlInclude(typeof(CreateTimestampedControl1ModePayload))]
-    [XmlInclude(typeof(CreateTimestampedCamera1FrequencyPayload))]
-    [XmlInclude(typeof(CreateTimestampedServo1PeriodPayload))]
-    [XmlInclude(typeof(CreateTimestampedServo1PulseWidthPayload))]
-    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
-    [Description("Creates standard message payloads for the CameraController device.")]
-    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    /// <seealso cref="CreateCameraStartPayload"/>
+    /// <seealso cref="CreateCameraStopPayload"/>
+    /// <seealso cref="CreateServoEnablePayload"/>
+    /// <seealso cref="CreateServoDisablePayload"/>
+    /// <seealso cref="CreateOutputSetPayload"/>
+    /// <seealso cref="CreateOutputClearPayload"/>
+    /// <seealso cref="CreateOutputStatePayload"/>
+    /// <seealso cref="CreateDigitalInputStatePayload"/>
+    /// <seealso cref="CreateCamera0TriggerPayload"/>
+    /// <seealso cref="CreateCamera1TriggerPayload"/>
+    /// <seealso cref="CreateCamera0SyncPayload"/>
+    /// <seealso cref="CreateCamera1SyncPayload"/>
+    /// <seealso cref="CreateServoStatePayload"/>
+    /// <seealso cref="CreateSyncIntervalPayload"/>
+    /// <seealso cref="CreateDI0ModePayload"/>
+    /// <seealso cref="CreateControl0ModePayload"/>
+    /// <seealso cref="CreateCamera0FrequencyPayload"/>
+    /// <seealso cref="CreateServo0PeriodPayload"/>
+    /// <seealso cref="CreateServo0PulseWidthPayload"/>
+    /// <seealso cref="CreateControl1ModePayload"/>
+    /// <seealso cref="CreateCamera1FrequencyPayload"/>
+    /// <seealso cref="CreateServo1PeriodPayload"/>
+    /// <seealso cref="CreateServo1PulseWidthPayload"/>
+    /// <seealso cref="CreateEnableEventsPayload"/>
+    /// <seealso cref="CreateCamera0ClockDividerPayload"/>
+    /// <seealso cref="CreateCamera0ClockMultiplierPayload"/>
+    /// <seealso cref="CreateCamera0TriggerDelayPayload"/>
+    /// <seealso cref="CreateCamera0TriggerWidthPayload"/>
+    /// <seealso cref="CreateCamera1ClockDividerPayload"/>
+    /// <seealso cref="CreateCamera1ClockMultiplierPayload"/>
+    /// <seealso cref="CreateCamera1TriggerDelayPayload"/>
+    /// <seealso cref="CreateCamera1TriggerWidthPayload"/>
+    /// <seealso cref="CreateClockDisciplinePayload"/>
+    /// <seealso cref="CreateClockDriftStatsPayload"/>
+    /// <seealso cref="CreateCamera0SequencePayload"/>
+    /// <seealso cref="CreateCamera0SequenceLengthPayload"/>
+    /// <seealso cref="CreateCamera0SequenceRepeatPayload"/>
+    /// <seealso cref="CreateCamera1SequencePayload"/>
+    /// <seealso cref="CreateCamera1SequenceLengthPayload"/>
+    /// <seealso cref="CreateCamera1SequenceRepeatPayload"/>
+    /// <seealso cref="CreateScheduleEnablePayload"/>
+    /// <seealso cref="CreateScheduleWindowsPayload"/>
+    /// <seealso cref="CreateCamera0SchedulePeriodPayload"/>
+    /// <seealso cref="CreateCamera0SchedulePayload"/>
+    /// <seealso cref="CreateCamera1SchedulePeriodPayload"/>
+    /// <seealso cref="CreateCamera1SchedulePayload"/>
+    /// <seealso cref="CreateServo0TargetPayload"/>
+    /// <seealso cref="CreateServo0MaxVelocityPayload"/>
+    /// <seealso cref="CreateServo0AccelerationPayload"/>
+    /// <seealso cref="CreateServo0ProfilePayload"/>
+    /// <seealso cref="CreateServo1TargetPayload"/>
+    /// <seealso cref="CreateServo1MaxVelocityPayload"/>
+    /// <seealso cref="CreateServo1AccelerationPayload"/>
+    /// <seealso cref="CreateServo1ProfilePayload"/>
+    /// <seealso cref="CreateServoMovingPayload"/>
+    /// <seealso cref="CreateServo0WaypointsPayload"/>
+    /// <seealso cref="CreateServo0WaypointCountPayload"/>
+    /// <seealso cref="CreateServo1WaypointsPayload"/>
+    /// <seealso cref="CreateServo1WaypointCountPayload"/>
+    /// <seealso cref="CreateServoPlayPayload"/>
+    /// <seealso cref="CreateServoPlayOnDI0Payload"/>
+    /// <seealso cref="CreateServo0PulseWidthFinePayload"/>
+    /// <seealso cref="CreateServo1PulseWidthFinePayload"/>
+    /// <seealso cref="CreateServo0SetpointFifoPayload"/>
+    /// <seealso cref="CreateServo1SetpointFifoPayload"/>
+    /// <seealso cref="CreateServoUnderrunsPayload"/>
+    /// <seealso cref="CreateTimerOwnersPayload"/>
+    /// <seealso cref="CreateServoAlignPayload"/>
+    /// <seealso cref="CreateChannelStatePayload"/>
+    /// <seealso cref="CreateCameraSoftTriggerPayload"/>
+    /// <seealso cref="CreateConfigStagePayload"/>
+    /// <seealso cref="CreateConfigCommitPayload"/>
+    /// <seealso cref="CreateSnapshotPayload"/>
+    /// <seealso cref="CreateOutputInvertPayload"/>
+    /// <seealso cref="CreateIsrProfilePayload"/>
+    /// <seealso cref="CreateIsrProfileResetPayload"/>
+    /// <seealso cref="CreateTriggerJitterModePayload"/>
+    /// <seealso cref="CreateTriggerJitterThresholdPayload"/>
+    /// <seealso cref="CreateTriggerJitterStatsPayload"/>
+    /// <seealso cref="CreateStackFreePayload"/>
+    /// <seealso cref="CreateExternalClockSkipsPayload"/>
+    /// <seealso cref="CreateIsrProfileSlotPayload"/>
+    [XmlInclude(typeof(CreateCameraStartPayload))]
+    [XmlInclude(typeof(CreateCameraStopPayload))]
+    [XmlInclude(typeof(CreateServoEnablePayload))]
+    [XmlInclude(typeof(CreateServoDisablePayload))]
+    [XmlInclude(typeof(CreateOutputSetPayload))]
+    [XmlInclude(typeof(CreateOutputClearPayload))]
+    [XmlInclude(typeof(CreateOutputStatePayload))]
+    [XmlInclude(typeof(CreateDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateCamera0TriggerPayload))]
+    [XmlInclude(typeof(CreateCamera1TriggerPayload))]
+    [XmlInclude(typeof(CreateCamera0SyncPayload))]
+    [XmlInclude(typeof(CreateCamera1SyncPayload))]
+    [XmlInclude(typeof(CreateServoStatePayload))]
+    [XmlInclude(typeof(CreateSyncIntervalPayload))]
+    [XmlInclude(typeof(CreateDI0ModePayload))]
+    [XmlInclude(typeof(CreateControl0ModePayload))]
+    [XmlInclude(typeof(CreateCamera0FrequencyPayload))]
+    [XmlInclude(typeof(CreateServo0PeriodPayload))]
+    [XmlInclude(typeof(CreateServo0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateControl1ModePayload))]
+    [XmlInclude(typeof(CreateCamera1FrequencyPayload))]
+    [XmlInclude(typeof(CreateServo1PeriodPayload))]
+    [XmlInclude(typeof(CreateServo1PulseWidthPayload))]
+    [XmlInclude(typeof(CreateEnableEventsPayload))]
+    [XmlInclude(typeof(CreateCamera0ClockDividerPayload))]
+    [XmlInclude(typeof(CreateCamera0ClockMultiplierPayload))]
+    [XmlInclude(typeof(CreateCamera0TriggerDelayPayload))]
+    [XmlInclude(typeof(CreateCamera0TriggerWidthPayload))]
+    [XmlInclude(typeof(CreateCamera1ClockDividerPayload))]
+    [XmlInclude(typeof(CreateCamera1ClockMultiplierPayload))]
+    [XmlInclude(typeof(CreateCamera1TriggerDelayPayload))]
+    [XmlInclude(typeof(CreateCamera1TriggerWidthPayload))]
+    [XmlInclude(typeof(CreateClockDisciplinePayload))]
+    [XmlInclude(typeof(CreateClockDriftStatsPayload))]
+    [XmlInclude(typeof(CreateCamera0SequencePayload))]
+    [XmlInclude(typeof(CreateCamera0SequenceLengthPayload))]
+    [XmlInclude(typeof(CreateCamera0SequenceRepeatPayload))]
+    [XmlInclude(typeof(CreateCamera1SequencePayload))]
+    [XmlInclude(typeof(CreateCamera1SequenceLengthPayload))]
+    [XmlInclude(typeof(CreateCamera1SequenceRepeatPayload))]
+    [XmlInclude(typeof(CreateScheduleEnablePayload))]
+    [XmlInclude(typeof(CreateScheduleWindowsPayload))]
+    [XmlInclude(typeof(CreateCamera0SchedulePeriodPayload))]
+    [XmlInclude(typeof(CreateCamera0SchedulePayload))]
+    [XmlInclude(typeof(CreateCamera1SchedulePeriodPayload))]
+    [XmlInclude(typeof(CreateCamera1SchedulePayload))]
+    [XmlInclude(typeof(CreateServo0TargetPayload))]
+    [XmlInclude(typeof(CreateServo0MaxVelocityPayload))]
+    [XmlInclude(typeof(CreateServo0AccelerationPayload))]
+    [XmlInclude(typeof(CreateServo0ProfilePayload))]
+    [XmlInclude(typeof(CreateServo1TargetPayload))]
+    [XmlInclude(typeof(CreateServo1MaxVelocityPayload))]
+    [XmlInclude(typeof(CreateServo1AccelerationPayload))]
+    [XmlInclude(typeof(CreateServo1ProfilePayload))]
+    [XmlInclude(typeof(CreateServoMovingPayload))]
+    [XmlInclude(typeof(CreateServo0WaypointsPayload))]
+    [XmlInclude(typeof(CreateServo0WaypointCountPayload))]
+    [XmlInclude(typeof(CreateServo1WaypointsPayload))]
+    [XmlInclude(typeof(CreateServo1WaypointCountPayload))]
+    [XmlInclude(typeof(CreateServoPlayPayload))]
+    [XmlInclude(typeof(CreateServoPlayOnDI0Payload))]
+    [XmlInclude(typeof(CreateServo0PulseWidthFinePayload))]
+    [XmlInclude(typeof(CreateServo1PulseWidthFinePayload))]
+    [XmlInclude(typeof(CreateServo0SetpointFifoPayload))]
+    [XmlInclude(typeof(CreateServo1SetpointFifoPayload))]
+    [XmlInclude(typeof(CreateServoUnderrunsPayload))]
+    [XmlInclude(typeof(CreateTimerOwnersPayload))]
+    [XmlInclude(typeof(CreateServoAlignPayload))]
+    [XmlInclude(typeof(CreateChannelStatePayload))]
+    [XmlInclude(typeof(CreateCameraSoftTriggerPayload))]
+    [XmlInclude(typeof(CreateConfigStagePayload))]
+    [XmlInclude(typeof(CreateConfigCommitPayload))]
+    [XmlInclude(typeof(CreateSnapshotPayload))]
+    [XmlInclude(typeof(CreateOutputInvertPayload))]
+    [XmlInclude(typeof(CreateIsrProfilePayload))]
+    [XmlInclude(typeof(CreateIsrProfileResetPayload))]
+    [XmlInclude(typeof(CreateTriggerJitterModePayload))]
+    [XmlInclude(typeof(CreateTriggerJitterThresholdPayload))]
+    [XmlInclude(typeof(CreateTriggerJitterStatsPayload))]
+    [XmlInclude(typeof(CreateStackFreePayload))]
+    [XmlInclude(typeof(CreateExternalClockSkipsPayload))]
+    [XmlInclude(typeof(CreateIsrProfileSlotPayload))]
+    [XmlInclude(typeof(CreateTimestampedCameraStartPayload))]
+    [XmlInclude(typeof(CreateTimestampedCameraStopPayload))]
+    [XmlInclude(typeof(CreateTimestampedServoEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedServoDisablePayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputSetPayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputClearPayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedDigitalInputStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera0TriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera1TriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera0SyncPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera1SyncPayload))]
+    [XmlInclude(typeof(CreateTimestampedServoStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedSyncIntervalPayload))]
+    [XmlInclude(typeof(CreateTimestampedDI0ModePayload))]
+    [XmlInclude(typeof(CreateTimestampedControl0ModePayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera0FrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo0PeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo0PulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedControl1ModePayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera1FrequencyPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo1PeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo1PulseWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedEnableEventsPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera0ClockDividerPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera0ClockMultiplierPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera0TriggerDelayPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera0TriggerWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera1ClockDividerPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera1ClockMultiplierPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera1TriggerDelayPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera1TriggerWidthPayload))]
+    [XmlInclude(typeof(CreateTimestampedClockDisciplinePayload))]
+    [XmlInclude(typeof(CreateTimestampedClockDriftStatsPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera0SequencePayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera0SequenceLengthPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera0SequenceRepeatPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera1SequencePayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera1SequenceLengthPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera1SequenceRepeatPayload))]
+    [XmlInclude(typeof(CreateTimestampedScheduleEnablePayload))]
+    [XmlInclude(typeof(CreateTimestampedScheduleWindowsPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera0SchedulePeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera0SchedulePayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera1SchedulePeriodPayload))]
+    [XmlInclude(typeof(CreateTimestampedCamera1SchedulePayload))]
+    [XmlInclude(typeof(CreateTimestampedServo0TargetPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo0MaxVelocityPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo0AccelerationPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo0ProfilePayload))]
+    [XmlInclude(typeof(CreateTimestampedServo1TargetPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo1MaxVelocityPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo1AccelerationPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo1ProfilePayload))]
+    [XmlInclude(typeof(CreateTimestampedServoMovingPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo0WaypointsPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo0WaypointCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo1WaypointsPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo1WaypointCountPayload))]
+    [XmlInclude(typeof(CreateTimestampedServoPlayPayload))]
+    [XmlInclude(typeof(CreateTimestampedServoPlayOnDI0Payload))]
+    [XmlInclude(typeof(CreateTimestampedServo0PulseWidthFinePayload))]
+    [XmlInclude(typeof(CreateTimestampedServo1PulseWidthFinePayload))]
+    [XmlInclude(typeof(CreateTimestampedServo0SetpointFifoPayload))]
+    [XmlInclude(typeof(CreateTimestampedServo1SetpointFifoPayload))]
+    [XmlInclude(typeof(CreateTimestampedServoUnderrunsPayload))]
+    [XmlInclude(typeof(CreateTimestampedTimerOwnersPayload))]
+    [XmlInclude(typeof(CreateTimestampedServoAlignPayload))]
+    [XmlInclude(typeof(CreateTimestampedChannelStatePayload))]
+    [XmlInclude(typeof(CreateTimestampedCameraSoftTriggerPayload))]
+    [XmlInclude(typeof(CreateTimestampedConfigStagePayload))]
+    [XmlInclude(typeof(CreateTimestampedConfigCommitPayload))]
+    [XmlInclude(typeof(CreateTimestampedSnapshotPayload))]
+    [XmlInclude(typeof(CreateTimestampedOutputInvertPayload))]
+    [XmlInclude(typeof(CreateTimestampedIsrProfilePayload))]
+    [XmlInclude(typeof(CreateTimestampedIsrProfileResetPayload))]
+    [XmlInclude(typeof(CreateTimestampedTriggerJitterModePayload))]
+    [XmlInclude(typeof(CreateTimestampedTriggerJitterThresholdPayload))]
+    [XmlInclude(typeof(CreateTimestampedTriggerJitterStatsPayload))]
+    [XmlInclude(typeof(CreateTimestampedStackFreePayload))]
+    [XmlInclude(typeof(CreateTimestampedExternalClockSkipsPayload))]
+    [XmlInclude(typeof(CreateTimestampedIsrProfileSlotPayload))]
+    [Description("Creates standard message payloads for the CameraController device.")]
+    public partial class CreateMessage : CreateMessageBuilder, INamedElement
+    {
+        /// <summary>
+        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// </summary>
+        public CreateMessage()
+        {
+            Payload = new CreateCameraStartPayload();
+        }
+
+        string INamedElement.Name => $"{nameof(CameraController)}.{GetElementDisplayName(Payload)}";
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that starts the generation of triggers on the specified camera lines.
+    /// </summary>
+    [DisplayName("CameraStartPayload")]
+    [Description("Creates a message payload that starts the generation of triggers on the specified camera lines.")]
+    public partial class CreateCameraStartPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that starts the generation of triggers on the specified camera lines.
+        /// </summary>
+        [Description("The value that starts the generation of triggers on the specified camera lines.")]
+        public Cameras CameraStart { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the CameraStart register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Cameras GetPayload()
+        {
+            return CameraStart;
+        }
+
+        /// <summary>
+        /// Creates a message that starts the generation of triggers on the specified camera lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the CameraStart register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.CameraStart.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that starts the generation of triggers on the specified camera lines.
+    /// </summary>
+    [DisplayName("TimestampedCameraStartPayload")]
+    [Description("Creates a timestamped message payload that starts the generation of triggers on the specified camera lines.")]
+    public partial class CreateTimestampedCameraStartPayload : CreateCameraStartPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that starts the generation of triggers on the specified camera lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the CameraStart register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.CameraStart.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that stops the generation of triggers on the specified camera lines.
+    /// </summary>
+    [DisplayName("CameraStopPayload")]
+    [Description("Creates a message payload that stops the generation of triggers on the specified camera lines.")]
+    public partial class CreateCameraStopPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that stops the generation of triggers on the specified camera lines.
+        /// </summary>
+        [Description("The value that stops the generation of triggers on the specified camera lines.")]
+        public Cameras CameraStop { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the CameraStop register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Cameras GetPayload()
+        {
+            return CameraStop;
+        }
+
+        /// <summary>
+        /// Creates a message that stops the generation of triggers on the specified camera lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the CameraStop register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.CameraStop.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that stops the generation of triggers on the specified camera lines.
+    /// </summary>
+    [DisplayName("TimestampedCameraStopPayload")]
+    [Description("Creates a timestamped message payload that stops the generation of triggers on the specified camera lines.")]
+    public partial class CreateTimestampedCameraStopPayload : CreateCameraStopPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that stops the generation of triggers on the specified camera lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the CameraStop register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.CameraStop.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables servo control on the specified camera lines.
+    /// </summary>
+    [DisplayName("ServoEnablePayload")]
+    [Description("Creates a message payload that enables servo control on the specified camera lines.")]
+    public partial class CreateServoEnablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables servo control on the specified camera lines.
+        /// </summary>
+        [Description("The value that enables servo control on the specified camera lines.")]
+        public Servos ServoEnable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ServoEnable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Servos GetPayload()
+        {
+            return ServoEnable;
+        }
+
+        /// <summary>
+        /// Creates a message that enables servo control on the specified camera lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ServoEnable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.ServoEnable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables servo control on the specified camera lines.
+    /// </summary>
+    [DisplayName("TimestampedServoEnablePayload")]
+    [Description("Creates a timestamped message payload that enables servo control on the specified camera lines.")]
+    public partial class CreateTimestampedServoEnablePayload : CreateServoEnablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables servo control on the specified camera lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ServoEnable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.ServoEnable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that disables servo control on the specified camera lines.
+    /// </summary>
+    [DisplayName("ServoDisablePayload")]
+    [Description("Creates a message payload that disables servo control on the specified camera lines.")]
+    public partial class CreateServoDisablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that disables servo control on the specified camera lines.
+        /// </summary>
+        [Description("The value that disables servo control on the specified camera lines.")]
+        public Servos ServoDisable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ServoDisable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Servos GetPayload()
+        {
+            return ServoDisable;
+        }
+
+        /// <summary>
+        /// Creates a message that disables servo control on the specified camera lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ServoDisable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.ServoDisable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that disables servo control on the specified camera lines.
+    /// </summary>
+    [DisplayName("TimestampedServoDisablePayload")]
+    [Description("Creates a timestamped message payload that disables servo control on the specified camera lines.")]
+    public partial class CreateTimestampedServoDisablePayload : CreateServoDisablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that disables servo control on the specified camera lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ServoDisable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.ServoDisable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("OutputSetPayload")]
+    [Description("Creates a message payload that set the specified digital output lines.")]
+    public partial class CreateOutputSetPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that set the specified digital output lines.
+        /// </summary>
+        [Description("The value that set the specified digital output lines.")]
+        public DigitalOutputs OutputSet { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputSet register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return OutputSet;
+        }
+
+        /// <summary>
+        /// Creates a message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputSet register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.OutputSet.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that set the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedOutputSetPayload")]
+    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
+    public partial class CreateTimestampedOutputSetPayload : CreateOutputSetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that set the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputSet register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.OutputSet.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that clear the specified digital output lines.
+    /// </summary>
+    [DisplayName("OutputClearPayload")]
+    [Description("Creates a message payload that clear the specified digital output lines.")]
+    public partial class CreateOutputClearPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that clear the specified digital output lines.
+        /// </summary>
+        [Description("The value that clear the specified digital output lines.")]
+        public DigitalOutputs OutputClear { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputClear register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return OutputClear;
+        }
+
+        /// <summary>
+        /// Creates a message that clear the specified digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputClear register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.OutputClear.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that clear the specified digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedOutputClearPayload")]
+    [Description("Creates a timestamped message payload that clear the specified digital output lines.")]
+    public partial class CreateTimestampedOutputClearPayload : CreateOutputClearPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that clear the specified digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputClear register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.OutputClear.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that write the state of all digital output lines.
+    /// </summary>
+    [DisplayName("OutputStatePayload")]
+    [Description("Creates a message payload that write the state of all digital output lines.")]
+    public partial class CreateOutputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that write the state of all digital output lines.
+        /// </summary>
+        [Description("The value that write the state of all digital output lines.")]
+        public DigitalOutputs OutputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the OutputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalOutputs GetPayload()
+        {
+            return OutputState;
+        }
+
+        /// <summary>
+        /// Creates a message that write the state of all digital output lines.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the OutputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.OutputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that write the state of all digital output lines.
+    /// </summary>
+    [DisplayName("TimestampedOutputStatePayload")]
+    [Description("Creates a timestamped message payload that write the state of all digital output lines.")]
+    public partial class CreateTimestampedOutputStatePayload : CreateOutputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that write the state of all digital output lines.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the OutputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.OutputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that emits an event when the state of the digital input line changes.
+    /// </summary>
+    [DisplayName("DigitalInputStatePayload")]
+    [Description("Creates a message payload that emits an event when the state of the digital input line changes.")]
+    public partial class CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that emits an event when the state of the digital input line changes.
+        /// </summary>
+        [Description("The value that emits an event when the state of the digital input line changes.")]
+        public DigitalInputs DigitalInputState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DigitalInputState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DigitalInputs GetPayload()
+        {
+            return DigitalInputState;
+        }
+
+        /// <summary>
+        /// Creates a message that emits an event when the state of the digital input line changes.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.DigitalInputState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that emits an event when the state of the digital input line changes.
+    /// </summary>
+    [DisplayName("TimestampedDigitalInputStatePayload")]
+    [Description("Creates a timestamped message payload that emits an event when the state of the digital input line changes.")]
+    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that emits an event when the state of the digital input line changes.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that emits an event when a frame is triggered on camera 0.
+    /// </summary>
+    [DisplayName("Camera0TriggerPayload")]
+    [Description("Creates a message payload that emits an event when a frame is triggered on camera 0.")]
+    public partial class CreateCamera0TriggerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that emits an event when a frame is triggered on camera 0.
+        /// </summary>
+        [Description("The value that emits an event when a frame is triggered on camera 0.")]
+        public byte Camera0Trigger { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Camera0Trigger register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Camera0Trigger;
+        }
+
+        /// <summary>
+        /// Creates a message that emits an event when a frame is triggered on camera 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera0Trigger register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera0Trigger.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that emits an event when a frame is triggered on camera 0.
+    /// </summary>
+    [DisplayName("TimestampedCamera0TriggerPayload")]
+    [Description("Creates a timestamped message payload that emits an event when a frame is triggered on camera 0.")]
+    public partial class CreateTimestampedCamera0TriggerPayload : CreateCamera0TriggerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that emits an event when a frame is triggered on camera 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera0Trigger register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera0Trigger.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that emits an event when a frame is triggered on camera 1.
+    /// </summary>
+    [DisplayName("Camera1TriggerPayload")]
+    [Description("Creates a message payload that emits an event when a frame is triggered on camera 1.")]
+    public partial class CreateCamera1TriggerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that emits an event when a frame is triggered on camera 1.
+        /// </summary>
+        [Description("The value that emits an event when a frame is triggered on camera 1.")]
+        public byte Camera1Trigger { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Camera1Trigger register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Camera1Trigger;
+        }
+
+        /// <summary>
+        /// Creates a message that emits an event when a frame is triggered on camera 1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera1Trigger register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera1Trigger.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that emits an event when a frame is triggered on camera 1.
+    /// </summary>
+    [DisplayName("TimestampedCamera1TriggerPayload")]
+    [Description("Creates a timestamped message payload that emits an event when a frame is triggered on camera 1.")]
+    public partial class CreateTimestampedCamera1TriggerPayload : CreateCamera1TriggerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that emits an event when a frame is triggered on camera 1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera1Trigger register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera1Trigger.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that emits an event when a sync state is toggled on camera 0.
+    /// </summary>
+    [DisplayName("Camera0SyncPayload")]
+    [Description("Creates a message payload that emits an event when a sync state is toggled on camera 0.")]
+    public partial class CreateCamera0SyncPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that emits an event when a sync state is toggled on camera 0.
+        /// </summary>
+        [Description("The value that emits an event when a sync state is toggled on camera 0.")]
+        public byte Camera0Sync { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Camera0Sync register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Camera0Sync;
+        }
+
+        /// <summary>
+        /// Creates a message that emits an event when a sync state is toggled on camera 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera0Sync register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera0Sync.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that emits an event when a sync state is toggled on camera 0.
+    /// </summary>
+    [DisplayName("TimestampedCamera0SyncPayload")]
+    [Description("Creates a timestamped message payload that emits an event when a sync state is toggled on camera 0.")]
+    public partial class CreateTimestampedCamera0SyncPayload : CreateCamera0SyncPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that emits an event when a sync state is toggled on camera 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera0Sync register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera0Sync.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that emits an event when a sync state is toggled on camera 0.
+    /// </summary>
+    [DisplayName("Camera1SyncPayload")]
+    [Description("Creates a message payload that emits an event when a sync state is toggled on camera 0.")]
+    public partial class CreateCamera1SyncPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that emits an event when a sync state is toggled on camera 0.
+        /// </summary>
+        [Description("The value that emits an event when a sync state is toggled on camera 0.")]
+        public byte Camera1Sync { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Camera1Sync register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Camera1Sync;
+        }
+
+        /// <summary>
+        /// Creates a message that emits an event when a sync state is toggled on camera 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera1Sync register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera1Sync.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that emits an event when a sync state is toggled on camera 0.
+    /// </summary>
+    [DisplayName("TimestampedCamera1SyncPayload")]
+    [Description("Creates a timestamped message payload that emits an event when a sync state is toggled on camera 0.")]
+    public partial class CreateTimestampedCamera1SyncPayload : CreateCamera1SyncPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that emits an event when a sync state is toggled on camera 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera1Sync register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera1Sync.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that returns the current state of the servo motors.
+    /// </summary>
+    [DisplayName("ServoStatePayload")]
+    [Description("Creates a message payload that returns the current state of the servo motors.")]
+    public partial class CreateServoStatePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that returns the current state of the servo motors.
+        /// </summary>
+        [Description("The value that returns the current state of the servo motors.")]
+        public Servos ServoState { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ServoState register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Servos GetPayload()
+        {
+            return ServoState;
+        }
+
+        /// <summary>
+        /// Creates a message that returns the current state of the servo motors.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ServoState register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.ServoState.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that returns the current state of the servo motors.
+    /// </summary>
+    [DisplayName("TimestampedServoStatePayload")]
+    [Description("Creates a timestamped message payload that returns the current state of the servo motors.")]
+    public partial class CreateTimestampedServoStatePayload : CreateServoStatePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that returns the current state of the servo motors.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ServoState register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.ServoState.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the interval in seconds between each sync pulse.
+    /// </summary>
+    [DisplayName("SyncIntervalPayload")]
+    [Description("Creates a message payload that configures the interval in seconds between each sync pulse.")]
+    public partial class CreateSyncIntervalPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the interval in seconds between each sync pulse.
+        /// </summary>
+        [Description("The value that configures the interval in seconds between each sync pulse.")]
+        public byte SyncInterval { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the SyncInterval register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return SyncInterval;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the interval in seconds between each sync pulse.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the SyncInterval register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.SyncInterval.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the interval in seconds between each sync pulse.
+    /// </summary>
+    [DisplayName("TimestampedSyncIntervalPayload")]
+    [Description("Creates a timestamped message payload that configures the interval in seconds between each sync pulse.")]
+    public partial class CreateTimestampedSyncIntervalPayload : CreateSyncIntervalPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the interval in seconds between each sync pulse.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the SyncInterval register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.SyncInterval.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the mode of the digital input line 0.
+    /// </summary>
+    [DisplayName("DI0ModePayload")]
+    [Description("Creates a message payload that configures the mode of the digital input line 0.")]
+    public partial class CreateDI0ModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the mode of the digital input line 0.
+        /// </summary>
+        [Description("The value that configures the mode of the digital input line 0.")]
+        public DI0ModeConfig DI0Mode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the DI0Mode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public DI0ModeConfig GetPayload()
+        {
+            return DI0Mode;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the mode of the digital input line 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the DI0Mode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.DI0Mode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the mode of the digital input line 0.
+    /// </summary>
+    [DisplayName("TimestampedDI0ModePayload")]
+    [Description("Creates a timestamped message payload that configures the mode of the digital input line 0.")]
+    public partial class CreateTimestampedDI0ModePayload : CreateDI0ModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the mode of the digital input line 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the DI0Mode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.DI0Mode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the control mode of Camera/Servo 0.
+    /// </summary>
+    [DisplayName("Control0ModePayload")]
+    [Description("Creates a message payload that configures the control mode of Camera/Servo 0.")]
+    public partial class CreateControl0ModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the control mode of Camera/Servo 0.
+        /// </summary>
+        [Description("The value that configures the control mode of Camera/Servo 0.")]
+        public ControlModeConfig Control0Mode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Control0Mode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ControlModeConfig GetPayload()
+        {
+            return Control0Mode;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the control mode of Camera/Servo 0.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Control0Mode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Control0Mode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the control mode of Camera/Servo 0.
+    /// </summary>
+    [DisplayName("TimestampedControl0ModePayload")]
+    [Description("Creates a timestamped message payload that configures the control mode of Camera/Servo 0.")]
+    public partial class CreateTimestampedControl0ModePayload : CreateControl0ModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the control mode of Camera/Servo 0.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Control0Mode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Control0Mode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.
+    /// </summary>
+    [DisplayName("Camera0FrequencyPayload")]
+    [Description("Creates a message payload that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.")]
+    public partial class CreateCamera0FrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.
+        /// </summary>
+        [Range(min: 1, max: 1000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.")]
+        public ushort Camera0Frequency { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Camera0Frequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Camera0Frequency;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera0Frequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera0Frequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.
+    /// </summary>
+    [DisplayName("TimestampedCamera0FrequencyPayload")]
+    [Description("Creates a timestamped message payload that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.")]
+    public partial class CreateTimestampedCamera0FrequencyPayload : CreateCamera0FrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera0Frequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera0Frequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.
+    /// </summary>
+    [DisplayName("Servo0PeriodPayload")]
+    [Description("Creates a message payload that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.")]
+    public partial class CreateServo0PeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.
+        /// </summary>
+        [Description("The value that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.")]
+        public ushort Servo0Period { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Servo0Period register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Servo0Period;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo0Period register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo0Period.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.
+    /// </summary>
+    [DisplayName("TimestampedServo0PeriodPayload")]
+    [Description("Creates a timestamped message payload that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.")]
+    public partial class CreateTimestampedServo0PeriodPayload : CreateServo0PeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo0Period register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo0Period.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.
+    /// </summary>
+    [DisplayName("Servo0PulseWidthPayload")]
+    [Description("Creates a message payload that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.")]
+    public partial class CreateServo0PulseWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.
+        /// </summary>
+        [Description("The value that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.")]
+        public ushort Servo0PulseWidth { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Servo0PulseWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Servo0PulseWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo0PulseWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo0PulseWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.
+    /// </summary>
+    [DisplayName("TimestampedServo0PulseWidthPayload")]
+    [Description("Creates a timestamped message payload that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.")]
+    public partial class CreateTimestampedServo0PulseWidthPayload : CreateServo0PulseWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo0PulseWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo0PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the control mode of Camera/Servo 1.
+    /// </summary>
+    [DisplayName("Control1ModePayload")]
+    [Description("Creates a message payload that configures the control mode of Camera/Servo 1.")]
+    public partial class CreateControl1ModePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the control mode of Camera/Servo 1.
+        /// </summary>
+        [Description("The value that configures the control mode of Camera/Servo 1.")]
+        public ControlModeConfig Control1Mode { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Control1Mode register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ControlModeConfig GetPayload()
+        {
+            return Control1Mode;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the control mode of Camera/Servo 1.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Control1Mode register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Control1Mode.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the control mode of Camera/Servo 1.
+    /// </summary>
+    [DisplayName("TimestampedControl1ModePayload")]
+    [Description("Creates a timestamped message payload that configures the control mode of Camera/Servo 1.")]
+    public partial class CreateTimestampedControl1ModePayload : CreateControl1ModePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the control mode of Camera/Servo 1.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Control1Mode register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Control1Mode.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.
+    /// </summary>
+    [DisplayName("Camera1FrequencyPayload")]
+    [Description("Creates a message payload that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.")]
+    public partial class CreateCamera1FrequencyPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.
+        /// </summary>
+        [Range(min: 1, max: 1000)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.")]
+        public ushort Camera1Frequency { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Camera1Frequency register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Camera1Frequency;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera1Frequency register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera1Frequency.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.
+    /// </summary>
+    [DisplayName("TimestampedCamera1FrequencyPayload")]
+    [Description("Creates a timestamped message payload that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.")]
+    public partial class CreateTimestampedCamera1FrequencyPayload : CreateCamera1FrequencyPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode. Reads back the frequency the line runs at, which is the schedule window frequency while a window is open.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera1Frequency register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera1Frequency.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.
+    /// </summary>
+    [DisplayName("Servo1PeriodPayload")]
+    [Description("Creates a message payload that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.")]
+    public partial class CreateServo1PeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.
+        /// </summary>
+        [Description("The value that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.")]
+        public ushort Servo1Period { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Servo1Period register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Servo1Period;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo1Period register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo1Period.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.
+    /// </summary>
+    [DisplayName("TimestampedServo1PeriodPayload")]
+    [Description("Creates a timestamped message payload that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.")]
+    public partial class CreateTimestampedServo1PeriodPayload : CreateServo1PeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the servo motor period (us) when using Servo mode. The timer resolution is 0.25 us or better up to 16384 us, 0.5 us up to 32767 us and 1 us above.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo1Period register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo1Period.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.
+    /// </summary>
+    [DisplayName("Servo1PulseWidthPayload")]
+    [Description("Creates a message payload that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.")]
+    public partial class CreateServo1PulseWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.
+        /// </summary>
+        [Description("The value that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.")]
+        public ushort Servo1PulseWidth { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Servo1PulseWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Servo1PulseWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo1PulseWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo1PulseWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.
+    /// </summary>
+    [DisplayName("TimestampedServo1PulseWidthPayload")]
+    [Description("Creates a timestamped message payload that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.")]
+    public partial class CreateTimestampedServo1PulseWidthPayload : CreateServo1PulseWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the servo pulse width (us) when using Servo mode. Reads back the pulse width applied, rounded to the timer resolution.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo1PulseWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo1PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that specifies the active events in the device.
+    /// </summary>
+    [DisplayName("EnableEventsPayload")]
+    [Description("Creates a message payload that specifies the active events in the device.")]
+    public partial class CreateEnableEventsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that specifies the active events in the device.
+        /// </summary>
+        [Description("The value that specifies the active events in the device.")]
+        public CameraControllerEvents EnableEvents { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the EnableEvents register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public CameraControllerEvents GetPayload()
+        {
+            return EnableEvents;
+        }
+
+        /// <summary>
+        /// Creates a message that specifies the active events in the device.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the EnableEvents register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.EnableEvents.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that specifies the active events in the device.
+    /// </summary>
+    [DisplayName("TimestampedEnableEventsPayload")]
+    [Description("Creates a timestamped message payload that specifies the active events in the device.")]
+    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that specifies the active events in the device.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the EnableEvents register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the number of DI0 rising edges between each trigger burst on Camera 0 when using ExternalClock mode.
+    /// </summary>
+    [DisplayName("Camera0ClockDividerPayload")]
+    [Description("Creates a message payload that configures the number of DI0 rising edges between each trigger burst on Camera 0 when using ExternalClock mode.")]
+    public partial class CreateCamera0ClockDividerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the number of DI0 rising edges between each trigger burst on Camera 0 when using ExternalClock mode.
+        /// </summary>
+        [Range(min: 1, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the number of DI0 rising edges between each trigger burst on Camera 0 when using ExternalClock mode.")]
+        public byte Camera0ClockDivider { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Camera0ClockDivider register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Camera0ClockDivider;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the number of DI0 rising edges between each trigger burst on Camera 0 when using ExternalClock mode.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera0ClockDivider register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera0ClockDivider.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the number of DI0 rising edges between each trigger burst on Camera 0 when using ExternalClock mode.
+    /// </summary>
+    [DisplayName("TimestampedCamera0ClockDividerPayload")]
+    [Description("Creates a timestamped message payload that configures the number of DI0 rising edges between each trigger burst on Camera 0 when using ExternalClock mode.")]
+    public partial class CreateTimestampedCamera0ClockDividerPayload : CreateCamera0ClockDividerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the number of DI0 rising edges between each trigger burst on Camera 0 when using ExternalClock mode.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera0ClockDivider register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera0ClockDivider.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the number of trigger pulses evenly spread over one DI0 period on Camera 0 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.
+    /// </summary>
+    [DisplayName("Camera0ClockMultiplierPayload")]
+    [Description("Creates a message payload that configures the number of trigger pulses evenly spread over one DI0 period on Camera 0 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.")]
+    public partial class CreateCamera0ClockMultiplierPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the number of trigger pulses evenly spread over one DI0 period on Camera 0 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.
+        /// </summary>
+        [Range(min: 1, max: 64)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the number of trigger pulses evenly spread over one DI0 period on Camera 0 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.")]
+        public byte Camera0ClockMultiplier { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Camera0ClockMultiplier register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Camera0ClockMultiplier;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the number of trigger pulses evenly spread over one DI0 period on Camera 0 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera0ClockMultiplier register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera0ClockMultiplier.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the number of trigger pulses evenly spread over one DI0 period on Camera 0 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.
+    /// </summary>
+    [DisplayName("TimestampedCamera0ClockMultiplierPayload")]
+    [Description("Creates a timestamped message payload that configures the number of trigger pulses evenly spread over one DI0 period on Camera 0 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.")]
+    public partial class CreateTimestampedCamera0ClockMultiplierPayload : CreateCamera0ClockMultiplierPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the number of trigger pulses evenly spread over one DI0 period on Camera 0 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera0ClockMultiplier register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera0ClockMultiplier.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 0 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.
+    /// </summary>
+    [DisplayName("Camera0TriggerDelayPayload")]
+    [Description("Creates a message payload that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 0 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.")]
+    public partial class CreateCamera0TriggerDelayPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 0 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.
+        /// </summary>
+        [Range(min: 20)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 0 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.")]
+        public ushort Camera0TriggerDelay { get; set; } = 20;
+
+        /// <summary>
+        /// Creates a message payload for the Camera0TriggerDelay register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Camera0TriggerDelay;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 0 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera0TriggerDelay register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera0TriggerDelay.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 0 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.
+    /// </summary>
+    [DisplayName("TimestampedCamera0TriggerDelayPayload")]
+    [Description("Creates a timestamped message payload that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 0 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.")]
+    public partial class CreateTimestampedCamera0TriggerDelayPayload : CreateCamera0TriggerDelayPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 0 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera0TriggerDelay register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera0TriggerDelay.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the width (us) of the trigger pulses on Camera 0 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.
+    /// </summary>
+    [DisplayName("Camera0TriggerWidthPayload")]
+    [Description("Creates a message payload that configures the width (us) of the trigger pulses on Camera 0 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.")]
+    public partial class CreateCamera0TriggerWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the width (us) of the trigger pulses on Camera 0 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.
+        /// </summary>
+        [Range(min: 1)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the width (us) of the trigger pulses on Camera 0 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.")]
+        public ushort Camera0TriggerWidth { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Camera0TriggerWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Camera0TriggerWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the width (us) of the trigger pulses on Camera 0 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera0TriggerWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera0TriggerWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the width (us) of the trigger pulses on Camera 0 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.
+    /// </summary>
+    [DisplayName("TimestampedCamera0TriggerWidthPayload")]
+    [Description("Creates a timestamped message payload that configures the width (us) of the trigger pulses on Camera 0 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.")]
+    public partial class CreateTimestampedCamera0TriggerWidthPayload : CreateCamera0TriggerWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the width (us) of the trigger pulses on Camera 0 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera0TriggerWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera0TriggerWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the number of DI0 rising edges between each trigger burst on Camera 1 when using ExternalClock mode.
+    /// </summary>
+    [DisplayName("Camera1ClockDividerPayload")]
+    [Description("Creates a message payload that configures the number of DI0 rising edges between each trigger burst on Camera 1 when using ExternalClock mode.")]
+    public partial class CreateCamera1ClockDividerPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the number of DI0 rising edges between each trigger burst on Camera 1 when using ExternalClock mode.
+        /// </summary>
+        [Range(min: 1, max: 255)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the number of DI0 rising edges between each trigger burst on Camera 1 when using ExternalClock mode.")]
+        public byte Camera1ClockDivider { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Camera1ClockDivider register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Camera1ClockDivider;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the number of DI0 rising edges between each trigger burst on Camera 1 when using ExternalClock mode.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera1ClockDivider register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera1ClockDivider.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the number of DI0 rising edges between each trigger burst on Camera 1 when using ExternalClock mode.
+    /// </summary>
+    [DisplayName("TimestampedCamera1ClockDividerPayload")]
+    [Description("Creates a timestamped message payload that configures the number of DI0 rising edges between each trigger burst on Camera 1 when using ExternalClock mode.")]
+    public partial class CreateTimestampedCamera1ClockDividerPayload : CreateCamera1ClockDividerPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the number of DI0 rising edges between each trigger burst on Camera 1 when using ExternalClock mode.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera1ClockDivider register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera1ClockDivider.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the number of trigger pulses evenly spread over one DI0 period on Camera 1 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.
+    /// </summary>
+    [DisplayName("Camera1ClockMultiplierPayload")]
+    [Description("Creates a message payload that configures the number of trigger pulses evenly spread over one DI0 period on Camera 1 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.")]
+    public partial class CreateCamera1ClockMultiplierPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the number of trigger pulses evenly spread over one DI0 period on Camera 1 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.
+        /// </summary>
+        [Range(min: 1, max: 64)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the number of trigger pulses evenly spread over one DI0 period on Camera 1 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.")]
+        public byte Camera1ClockMultiplier { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Camera1ClockMultiplier register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Camera1ClockMultiplier;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the number of trigger pulses evenly spread over one DI0 period on Camera 1 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera1ClockMultiplier register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera1ClockMultiplier.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the number of trigger pulses evenly spread over one DI0 period on Camera 1 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.
+    /// </summary>
+    [DisplayName("TimestampedCamera1ClockMultiplierPayload")]
+    [Description("Creates a timestamped message payload that configures the number of trigger pulses evenly spread over one DI0 period on Camera 1 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.")]
+    public partial class CreateTimestampedCamera1ClockMultiplierPayload : CreateCamera1ClockMultiplierPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the number of trigger pulses evenly spread over one DI0 period on Camera 1 when using ExternalClock mode. Above 1, the DI0 period must be under 33 s and the DI0 period over the multiplier under 131 ms, otherwise the DI0 edges are skipped.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera1ClockMultiplier register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera1ClockMultiplier.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 1 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.
+    /// </summary>
+    [DisplayName("Camera1TriggerDelayPayload")]
+    [Description("Creates a message payload that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 1 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.")]
+    public partial class CreateCamera1TriggerDelayPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 1 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.
+        /// </summary>
+        [Range(min: 20)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 1 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.")]
+        public ushort Camera1TriggerDelay { get; set; } = 20;
+
+        /// <summary>
+        /// Creates a message payload for the Camera1TriggerDelay register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Camera1TriggerDelay;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 1 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera1TriggerDelay register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera1TriggerDelay.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 1 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.
+    /// </summary>
+    [DisplayName("TimestampedCamera1TriggerDelayPayload")]
+    [Description("Creates a timestamped message payload that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 1 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.")]
+    public partial class CreateTimestampedCamera1TriggerDelayPayload : CreateCamera1TriggerDelayPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the delay (us) from the DI0 rising edge to the trigger pulse on Camera 1 when using ExternalClock or OneShot mode. Shorter delays than 20 us are rejected, since the DI0 interrupt must arm the trigger before the delay elapses.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera1TriggerDelay register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera1TriggerDelay.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the width (us) of the trigger pulses on Camera 1 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.
+    /// </summary>
+    [DisplayName("Camera1TriggerWidthPayload")]
+    [Description("Creates a message payload that configures the width (us) of the trigger pulses on Camera 1 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.")]
+    public partial class CreateCamera1TriggerWidthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the width (us) of the trigger pulses on Camera 1 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.
+        /// </summary>
+        [Range(min: 1)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the width (us) of the trigger pulses on Camera 1 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.")]
+        public ushort Camera1TriggerWidth { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Camera1TriggerWidth register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Camera1TriggerWidth;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the width (us) of the trigger pulses on Camera 1 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera1TriggerWidth register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera1TriggerWidth.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the width (us) of the trigger pulses on Camera 1 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.
+    /// </summary>
+    [DisplayName("TimestampedCamera1TriggerWidthPayload")]
+    [Description("Creates a timestamped message payload that configures the width (us) of the trigger pulses on Camera 1 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.")]
+    public partial class CreateTimestampedCamera1TriggerWidthPayload : CreateCamera1TriggerWidthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the width (us) of the trigger pulses on Camera 1 when using ExternalClock, OneShot or Sequence mode, and of the software triggers.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera1TriggerWidth register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera1TriggerWidth.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures whether the camera trigger timebase is locked to the Harp clock.
+    /// </summary>
+    [DisplayName("ClockDisciplinePayload")]
+    [Description("Creates a message payload that configures whether the camera trigger timebase is locked to the Harp clock.")]
+    public partial class CreateClockDisciplinePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures whether the camera trigger timebase is locked to the Harp clock.
+        /// </summary>
+        [Description("The value that configures whether the camera trigger timebase is locked to the Harp clock.")]
+        public ClockDisciplineConfig ClockDiscipline { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ClockDiscipline register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ClockDisciplineConfig GetPayload()
+        {
+            return ClockDiscipline;
+        }
+
+        /// <summary>
+        /// Creates a message that configures whether the camera trigger timebase is locked to the Harp clock.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ClockDiscipline register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.ClockDiscipline.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures whether the camera trigger timebase is locked to the Harp clock.
+    /// </summary>
+    [DisplayName("TimestampedClockDisciplinePayload")]
+    [Description("Creates a timestamped message payload that configures whether the camera trigger timebase is locked to the Harp clock.")]
+    public partial class CreateTimestampedClockDisciplinePayload : CreateClockDisciplinePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures whether the camera trigger timebase is locked to the Harp clock.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ClockDiscipline register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.ClockDiscipline.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the clock discipline statistics in 32 MHz ticks, as the last measured error per Harp second, the applied trim per second, the residual phase and the maximum absolute residual phase.
+    /// </summary>
+    [DisplayName("ClockDriftStatsPayload")]
+    [Description("Creates a message payload that reports the clock discipline statistics in 32 MHz ticks, as the last measured error per Harp second, the applied trim per second, the residual phase and the maximum absolute residual phase.")]
+    public partial class CreateClockDriftStatsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the clock discipline statistics in 32 MHz ticks, as the last measured error per Harp second, the applied trim per second, the residual phase and the maximum absolute residual phase.
+        /// </summary>
+        [Description("The value that reports the clock discipline statistics in 32 MHz ticks, as the last measured error per Harp second, the applied trim per second, the residual phase and the maximum absolute residual phase.")]
+        public int[] ClockDriftStats { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ClockDriftStats register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public int[] GetPayload()
+        {
+            return ClockDriftStats;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the clock discipline statistics in 32 MHz ticks, as the last measured error per Harp second, the applied trim per second, the residual phase and the maximum absolute residual phase.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ClockDriftStats register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.ClockDriftStats.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the clock discipline statistics in 32 MHz ticks, as the last measured error per Harp second, the applied trim per second, the residual phase and the maximum absolute residual phase.
+    /// </summary>
+    [DisplayName("TimestampedClockDriftStatsPayload")]
+    [Description("Creates a timestamped message payload that reports the clock discipline statistics in 32 MHz ticks, as the last measured error per Harp second, the applied trim per second, the residual phase and the maximum absolute residual phase.")]
+    public partial class CreateTimestampedClockDriftStatsPayload : CreateClockDriftStatsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the clock discipline statistics in 32 MHz ticks, as the last measured error per Harp second, the applied trim per second, the residual phase and the maximum absolute residual phase.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ClockDriftStats register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.ClockDriftStats.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the intervals (us) between consecutive triggers on Camera 0 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.
+    /// </summary>
+    [DisplayName("Camera0SequencePayload")]
+    [Description("Creates a message payload that configures the intervals (us) between consecutive triggers on Camera 0 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.")]
+    public partial class CreateCamera0SequencePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the intervals (us) between consecutive triggers on Camera 0 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.
+        /// </summary>
+        [Description("The value that configures the intervals (us) between consecutive triggers on Camera 0 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.")]
+        public ushort[] Camera0Sequence { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Camera0Sequence register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return Camera0Sequence;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the intervals (us) between consecutive triggers on Camera 0 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera0Sequence register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera0Sequence.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the intervals (us) between consecutive triggers on Camera 0 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.
+    /// </summary>
+    [DisplayName("TimestampedCamera0SequencePayload")]
+    [Description("Creates a timestamped message payload that configures the intervals (us) between consecutive triggers on Camera 0 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.")]
+    public partial class CreateTimestampedCamera0SequencePayload : CreateCamera0SequencePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the intervals (us) between consecutive triggers on Camera 0 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera0Sequence register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera0Sequence.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the number of intervals used from the Camera0Sequence register, from 1 to 16.
+    /// </summary>
+    [DisplayName("Camera0SequenceLengthPayload")]
+    [Description("Creates a message payload that configures the number of intervals used from the Camera0Sequence register, from 1 to 16.")]
+    public partial class CreateCamera0SequenceLengthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the number of intervals used from the Camera0Sequence register, from 1 to 16.
+        /// </summary>
+        [Range(min: 1, max: 16)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the number of intervals used from the Camera0Sequence register, from 1 to 16.")]
+        public byte Camera0SequenceLength { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Camera0SequenceLength register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Camera0SequenceLength;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the number of intervals used from the Camera0Sequence register, from 1 to 16.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera0SequenceLength register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera0SequenceLength.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the number of intervals used from the Camera0Sequence register, from 1 to 16.
+    /// </summary>
+    [DisplayName("TimestampedCamera0SequenceLengthPayload")]
+    [Description("Creates a timestamped message payload that configures the number of intervals used from the Camera0Sequence register, from 1 to 16.")]
+    public partial class CreateTimestampedCamera0SequenceLengthPayload : CreateCamera0SequenceLengthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the number of intervals used from the Camera0Sequence register, from 1 to 16.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera0SequenceLength register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera0SequenceLength.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the number of times the sequence is played on Camera 0, up to 255. If zero, the sequence loops until the camera is stopped.
+    /// </summary>
+    [DisplayName("Camera0SequenceRepeatPayload")]
+    [Description("Creates a message payload that configures the number of times the sequence is played on Camera 0, up to 255. If zero, the sequence loops until the camera is stopped.")]
+    public partial class CreateCamera0SequenceRepeatPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the number of times the sequence is played on Camera 0, up to 255. If zero, the sequence loops until the camera is stopped.
+        /// </summary>
+        [Description("The value that configures the number of times the sequence is played on Camera 0, up to 255. If zero, the sequence loops until the camera is stopped.")]
+        public byte Camera0SequenceRepeat { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Camera0SequenceRepeat register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Camera0SequenceRepeat;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the number of times the sequence is played on Camera 0, up to 255. If zero, the sequence loops until the camera is stopped.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera0SequenceRepeat register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera0SequenceRepeat.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the number of times the sequence is played on Camera 0, up to 255. If zero, the sequence loops until the camera is stopped.
+    /// </summary>
+    [DisplayName("TimestampedCamera0SequenceRepeatPayload")]
+    [Description("Creates a timestamped message payload that configures the number of times the sequence is played on Camera 0, up to 255. If zero, the sequence loops until the camera is stopped.")]
+    public partial class CreateTimestampedCamera0SequenceRepeatPayload : CreateCamera0SequenceRepeatPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the number of times the sequence is played on Camera 0, up to 255. If zero, the sequence loops until the camera is stopped.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera0SequenceRepeat register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera0SequenceRepeat.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the intervals (us) between consecutive triggers on Camera 1 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.
+    /// </summary>
+    [DisplayName("Camera1SequencePayload")]
+    [Description("Creates a message payload that configures the intervals (us) between consecutive triggers on Camera 1 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.")]
+    public partial class CreateCamera1SequencePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the intervals (us) between consecutive triggers on Camera 1 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.
+        /// </summary>
+        [Description("The value that configures the intervals (us) between consecutive triggers on Camera 1 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.")]
+        public ushort[] Camera1Sequence { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Camera1Sequence register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return Camera1Sequence;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the intervals (us) between consecutive triggers on Camera 1 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera1Sequence register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera1Sequence.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the intervals (us) between consecutive triggers on Camera 1 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.
+    /// </summary>
+    [DisplayName("TimestampedCamera1SequencePayload")]
+    [Description("Creates a timestamped message payload that configures the intervals (us) between consecutive triggers on Camera 1 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.")]
+    public partial class CreateTimestampedCamera1SequencePayload : CreateCamera1SequencePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the intervals (us) between consecutive triggers on Camera 1 when using Sequence mode (minimum 1000 us, sensitive to 2 us). The table holds up to 16 intervals, played up to 255 times or looped, so a finite sequence has at most 4080 triggers.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera1Sequence register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera1Sequence.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the number of intervals used from the Camera1Sequence register, from 1 to 16.
+    /// </summary>
+    [DisplayName("Camera1SequenceLengthPayload")]
+    [Description("Creates a message payload that configures the number of intervals used from the Camera1Sequence register, from 1 to 16.")]
+    public partial class CreateCamera1SequenceLengthPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the number of intervals used from the Camera1Sequence register, from 1 to 16.
+        /// </summary>
+        [Range(min: 1, max: 16)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the number of intervals used from the Camera1Sequence register, from 1 to 16.")]
+        public byte Camera1SequenceLength { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Camera1SequenceLength register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Camera1SequenceLength;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the number of intervals used from the Camera1Sequence register, from 1 to 16.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera1SequenceLength register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera1SequenceLength.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the number of intervals used from the Camera1Sequence register, from 1 to 16.
+    /// </summary>
+    [DisplayName("TimestampedCamera1SequenceLengthPayload")]
+    [Description("Creates a timestamped message payload that configures the number of intervals used from the Camera1Sequence register, from 1 to 16.")]
+    public partial class CreateTimestampedCamera1SequenceLengthPayload : CreateCamera1SequenceLengthPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the number of intervals used from the Camera1Sequence register, from 1 to 16.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera1SequenceLength register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera1SequenceLength.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the number of times the sequence is played on Camera 1, up to 255. If zero, the sequence loops until the camera is stopped.
+    /// </summary>
+    [DisplayName("Camera1SequenceRepeatPayload")]
+    [Description("Creates a message payload that configures the number of times the sequence is played on Camera 1, up to 255. If zero, the sequence loops until the camera is stopped.")]
+    public partial class CreateCamera1SequenceRepeatPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the number of times the sequence is played on Camera 1, up to 255. If zero, the sequence loops until the camera is stopped.
+        /// </summary>
+        [Description("The value that configures the number of times the sequence is played on Camera 1, up to 255. If zero, the sequence loops until the camera is stopped.")]
+        public byte Camera1SequenceRepeat { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Camera1SequenceRepeat register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Camera1SequenceRepeat;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the number of times the sequence is played on Camera 1, up to 255. If zero, the sequence loops until the camera is stopped.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera1SequenceRepeat register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera1SequenceRepeat.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the number of times the sequence is played on Camera 1, up to 255. If zero, the sequence loops until the camera is stopped.
+    /// </summary>
+    [DisplayName("TimestampedCamera1SequenceRepeatPayload")]
+    [Description("Creates a timestamped message payload that configures the number of times the sequence is played on Camera 1, up to 255. If zero, the sequence loops until the camera is stopped.")]
+    public partial class CreateTimestampedCamera1SequenceRepeatPayload : CreateCamera1SequenceRepeatPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the number of times the sequence is played on Camera 1, up to 255. If zero, the sequence loops until the camera is stopped.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera1SequenceRepeat register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera1SequenceRepeat.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that enables the acquisition schedule on the specified camera lines. A window only opens on a stopped line in Camera mode, at the window frequency, and the Frequency and Mode registers are not changed.
+    /// </summary>
+    [DisplayName("ScheduleEnablePayload")]
+    [Description("Creates a message payload that enables the acquisition schedule on the specified camera lines. A window only opens on a stopped line in Camera mode, at the window frequency, and the Frequency and Mode registers are not changed.")]
+    public partial class CreateScheduleEnablePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that enables the acquisition schedule on the specified camera lines. A window only opens on a stopped line in Camera mode, at the window frequency, and the Frequency and Mode registers are not changed.
+        /// </summary>
+        [Description("The value that enables the acquisition schedule on the specified camera lines. A window only opens on a stopped line in Camera mode, at the window frequency, and the Frequency and Mode registers are not changed.")]
+        public Cameras ScheduleEnable { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ScheduleEnable register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Cameras GetPayload()
+        {
+            return ScheduleEnable;
+        }
+
+        /// <summary>
+        /// Creates a message that enables the acquisition schedule on the specified camera lines. A window only opens on a stopped line in Camera mode, at the window frequency, and the Frequency and Mode registers are not changed.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ScheduleEnable register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.ScheduleEnable.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that enables the acquisition schedule on the specified camera lines. A window only opens on a stopped line in Camera mode, at the window frequency, and the Frequency and Mode registers are not changed.
+    /// </summary>
+    [DisplayName("TimestampedScheduleEnablePayload")]
+    [Description("Creates a timestamped message payload that enables the acquisition schedule on the specified camera lines. A window only opens on a stopped line in Camera mode, at the window frequency, and the Frequency and Mode registers are not changed.")]
+    public partial class CreateTimestampedScheduleEnablePayload : CreateScheduleEnablePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that enables the acquisition schedule on the specified camera lines. A window only opens on a stopped line in Camera mode, at the window frequency, and the Frequency and Mode registers are not changed.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ScheduleEnable register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.ScheduleEnable.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that reports the camera lines with an open acquisition schedule window. An event is sent when a window opens or closes.
+    /// </summary>
+    [DisplayName("ScheduleWindowsPayload")]
+    [Description("Creates a message payload that reports the camera lines with an open acquisition schedule window. An event is sent when a window opens or closes.")]
+    public partial class CreateScheduleWindowsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that reports the camera lines with an open acquisition schedule window. An event is sent when a window opens or closes.
+        /// </summary>
+        [Description("The value that reports the camera lines with an open acquisition schedule window. An event is sent when a window opens or closes.")]
+        public Cameras ScheduleWindows { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the ScheduleWindows register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public Cameras GetPayload()
+        {
+            return ScheduleWindows;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the camera lines with an open acquisition schedule window. An event is sent when a window opens or closes.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ScheduleWindows register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.ScheduleWindows.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the camera lines with an open acquisition schedule window. An event is sent when a window opens or closes.
+    /// </summary>
+    [DisplayName("TimestampedScheduleWindowsPayload")]
+    [Description("Creates a timestamped message payload that reports the camera lines with an open acquisition schedule window. An event is sent when a window opens or closes.")]
+    public partial class CreateTimestampedScheduleWindowsPayload : CreateScheduleWindowsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the camera lines with an open acquisition schedule window. An event is sent when a window opens or closes.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ScheduleWindows register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.ScheduleWindows.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the period (s) of the acquisition schedule of Camera 0, counted from the Harp time origin.
+    /// </summary>
+    [DisplayName("Camera0SchedulePeriodPayload")]
+    [Description("Creates a message payload that configures the period (s) of the acquisition schedule of Camera 0, counted from the Harp time origin.")]
+    public partial class CreateCamera0SchedulePeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the period (s) of the acquisition schedule of Camera 0, counted from the Harp time origin.
+        /// </summary>
+        [Range(min: 1)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the period (s) of the acquisition schedule of Camera 0, counted from the Harp time origin.")]
+        public uint Camera0SchedulePeriod { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Camera0SchedulePeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return Camera0SchedulePeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the period (s) of the acquisition schedule of Camera 0, counted from the Harp time origin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera0SchedulePeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera0SchedulePeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the period (s) of the acquisition schedule of Camera 0, counted from the Harp time origin.
+    /// </summary>
+    [DisplayName("TimestampedCamera0SchedulePeriodPayload")]
+    [Description("Creates a timestamped message payload that configures the period (s) of the acquisition schedule of Camera 0, counted from the Harp time origin.")]
+    public partial class CreateTimestampedCamera0SchedulePeriodPayload : CreateCamera0SchedulePeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the period (s) of the acquisition schedule of Camera 0, counted from the Harp time origin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera0SchedulePeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera0SchedulePeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures up to 4 acquisition windows of Camera 0 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.
+    /// </summary>
+    [DisplayName("Camera0SchedulePayload")]
+    [Description("Creates a message payload that configures up to 4 acquisition windows of Camera 0 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.")]
+    public partial class CreateCamera0SchedulePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures up to 4 acquisition windows of Camera 0 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.
+        /// </summary>
+        [Description("The value that configures up to 4 acquisition windows of Camera 0 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.")]
+        public uint[] Camera0Schedule { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Camera0Schedule register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return Camera0Schedule;
+        }
+
+        /// <summary>
+        /// Creates a message that configures up to 4 acquisition windows of Camera 0 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera0Schedule register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera0Schedule.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures up to 4 acquisition windows of Camera 0 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.
+    /// </summary>
+    [DisplayName("TimestampedCamera0SchedulePayload")]
+    [Description("Creates a timestamped message payload that configures up to 4 acquisition windows of Camera 0 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.")]
+    public partial class CreateTimestampedCamera0SchedulePayload : CreateCamera0SchedulePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures up to 4 acquisition windows of Camera 0 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera0Schedule register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera0Schedule.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the period (s) of the acquisition schedule of Camera 1, counted from the Harp time origin.
+    /// </summary>
+    [DisplayName("Camera1SchedulePeriodPayload")]
+    [Description("Creates a message payload that configures the period (s) of the acquisition schedule of Camera 1, counted from the Harp time origin.")]
+    public partial class CreateCamera1SchedulePeriodPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the period (s) of the acquisition schedule of Camera 1, counted from the Harp time origin.
+        /// </summary>
+        [Range(min: 1)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the period (s) of the acquisition schedule of Camera 1, counted from the Harp time origin.")]
+        public uint Camera1SchedulePeriod { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Camera1SchedulePeriod register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint GetPayload()
+        {
+            return Camera1SchedulePeriod;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the period (s) of the acquisition schedule of Camera 1, counted from the Harp time origin.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera1SchedulePeriod register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera1SchedulePeriod.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the period (s) of the acquisition schedule of Camera 1, counted from the Harp time origin.
+    /// </summary>
+    [DisplayName("TimestampedCamera1SchedulePeriodPayload")]
+    [Description("Creates a timestamped message payload that configures the period (s) of the acquisition schedule of Camera 1, counted from the Harp time origin.")]
+    public partial class CreateTimestampedCamera1SchedulePeriodPayload : CreateCamera1SchedulePeriodPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the period (s) of the acquisition schedule of Camera 1, counted from the Harp time origin.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera1SchedulePeriod register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera1SchedulePeriod.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures up to 4 acquisition windows of Camera 1 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.
+    /// </summary>
+    [DisplayName("Camera1SchedulePayload")]
+    [Description("Creates a message payload that configures up to 4 acquisition windows of Camera 1 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.")]
+    public partial class CreateCamera1SchedulePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures up to 4 acquisition windows of Camera 1 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.
+        /// </summary>
+        [Description("The value that configures up to 4 acquisition windows of Camera 1 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.")]
+        public uint[] Camera1Schedule { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Camera1Schedule register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public uint[] GetPayload()
+        {
+            return Camera1Schedule;
+        }
+
+        /// <summary>
+        /// Creates a message that configures up to 4 acquisition windows of Camera 1 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Camera1Schedule register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Camera1Schedule.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures up to 4 acquisition windows of Camera 1 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.
+    /// </summary>
+    [DisplayName("TimestampedCamera1SchedulePayload")]
+    [Description("Creates a timestamped message payload that configures up to 4 acquisition windows of Camera 1 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.")]
+    public partial class CreateTimestampedCamera1SchedulePayload : CreateCamera1SchedulePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures up to 4 acquisition windows of Camera 1 as (offset (s), duration (s), frequency (Hz)) triplets. Windows with zero duration are ignored.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Camera1Schedule register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Camera1Schedule.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that moves the servo motor 0 to the specified pulse width (us) using the configured motion profile.
+    /// </summary>
+    [DisplayName("Servo0TargetPayload")]
+    [Description("Creates a message payload that moves the servo motor 0 to the specified pulse width (us) using the configured motion profile.")]
+    public partial class CreateServo0TargetPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that moves the servo motor 0 to the specified pulse width (us) using the configured motion profile.
+        /// </summary>
+        [Range(min: 2)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that moves the servo motor 0 to the specified pulse width (us) using the configured motion profile.")]
+        public ushort Servo0Target { get; set; } = 2;
+
+        /// <summary>
+        /// Creates a message payload for the Servo0Target register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Servo0Target;
+        }
+
+        /// <summary>
+        /// Creates a message that moves the servo motor 0 to the specified pulse width (us) using the configured motion profile.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo0Target register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo0Target.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that moves the servo motor 0 to the specified pulse width (us) using the configured motion profile.
+    /// </summary>
+    [DisplayName("TimestampedServo0TargetPayload")]
+    [Description("Creates a timestamped message payload that moves the servo motor 0 to the specified pulse width (us) using the configured motion profile.")]
+    public partial class CreateTimestampedServo0TargetPayload : CreateServo0TargetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that moves the servo motor 0 to the specified pulse width (us) using the configured motion profile.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo0Target register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo0Target.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the maximum velocity (us/s) of the servo motor 0 moves. If zero, the velocity is not limited.
+    /// </summary>
+    [DisplayName("Servo0MaxVelocityPayload")]
+    [Description("Creates a message payload that configures the maximum velocity (us/s) of the servo motor 0 moves. If zero, the velocity is not limited.")]
+    public partial class CreateServo0MaxVelocityPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the maximum velocity (us/s) of the servo motor 0 moves. If zero, the velocity is not limited.
+        /// </summary>
+        [Description("The value that configures the maximum velocity (us/s) of the servo motor 0 moves. If zero, the velocity is not limited.")]
+        public ushort Servo0MaxVelocity { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Servo0MaxVelocity register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Servo0MaxVelocity;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the maximum velocity (us/s) of the servo motor 0 moves. If zero, the velocity is not limited.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo0MaxVelocity register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo0MaxVelocity.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the maximum velocity (us/s) of the servo motor 0 moves. If zero, the velocity is not limited.
+    /// </summary>
+    [DisplayName("TimestampedServo0MaxVelocityPayload")]
+    [Description("Creates a timestamped message payload that configures the maximum velocity (us/s) of the servo motor 0 moves. If zero, the velocity is not limited.")]
+    public partial class CreateTimestampedServo0MaxVelocityPayload : CreateServo0MaxVelocityPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the maximum velocity (us/s) of the servo motor 0 moves. If zero, the velocity is not limited.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo0MaxVelocity register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo0MaxVelocity.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the acceleration (us/s^2) of the servo motor 0 moves. If zero, the acceleration is not limited.
+    /// </summary>
+    [DisplayName("Servo0AccelerationPayload")]
+    [Description("Creates a message payload that configures the acceleration (us/s^2) of the servo motor 0 moves. If zero, the acceleration is not limited.")]
+    public partial class CreateServo0AccelerationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the acceleration (us/s^2) of the servo motor 0 moves. If zero, the acceleration is not limited.
+        /// </summary>
+        [Description("The value that configures the acceleration (us/s^2) of the servo motor 0 moves. If zero, the acceleration is not limited.")]
+        public ushort Servo0Acceleration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Servo0Acceleration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Servo0Acceleration;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the acceleration (us/s^2) of the servo motor 0 moves. If zero, the acceleration is not limited.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo0Acceleration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo0Acceleration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the acceleration (us/s^2) of the servo motor 0 moves. If zero, the acceleration is not limited.
+    /// </summary>
+    [DisplayName("TimestampedServo0AccelerationPayload")]
+    [Description("Creates a timestamped message payload that configures the acceleration (us/s^2) of the servo motor 0 moves. If zero, the acceleration is not limited.")]
+    public partial class CreateTimestampedServo0AccelerationPayload : CreateServo0AccelerationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the acceleration (us/s^2) of the servo motor 0 moves. If zero, the acceleration is not limited.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo0Acceleration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo0Acceleration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the motion profile of the servo motor 0 moves.
+    /// </summary>
+    [DisplayName("Servo0ProfilePayload")]
+    [Description("Creates a message payload that configures the motion profile of the servo motor 0 moves.")]
+    public partial class CreateServo0ProfilePayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the motion profile of the servo motor 0 moves.
+        /// </summary>
+        [Description("The value that configures the motion profile of the servo motor 0 moves.")]
+        public MotionProfileConfig Servo0Profile { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Servo0Profile register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MotionProfileConfig GetPayload()
+        {
+            return Servo0Profile;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the motion profile of the servo motor 0 moves.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo0Profile register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo0Profile.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the motion profile of the servo motor 0 moves.
+    /// </summary>
+    [DisplayName("TimestampedServo0ProfilePayload")]
+    [Description("Creates a timestamped message payload that configures the motion profile of the servo motor 0 moves.")]
+    public partial class CreateTimestampedServo0ProfilePayload : CreateServo0ProfilePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the motion profile of the servo motor 0 moves.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo0Profile register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo0Profile.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that moves the servo motor 1 to the specified pulse width (us) using the configured motion profile.
+    /// </summary>
+    [DisplayName("Servo1TargetPayload")]
+    [Description("Creates a message payload that moves the servo motor 1 to the specified pulse width (us) using the configured motion profile.")]
+    public partial class CreateServo1TargetPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that moves the servo motor 1 to the specified pulse width (us) using the configured motion profile.
+        /// </summary>
+        [Range(min: 2)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that moves the servo motor 1 to the specified pulse width (us) using the configured motion profile.")]
+        public ushort Servo1Target { get; set; } = 2;
+
+        /// <summary>
+        /// Creates a message payload for the Servo1Target register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Servo1Target;
+        }
+
+        /// <summary>
+        /// Creates a message that moves the servo motor 1 to the specified pulse width (us) using the configured motion profile.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo1Target register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo1Target.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that moves the servo motor 1 to the specified pulse width (us) using the configured motion profile.
+    /// </summary>
+    [DisplayName("TimestampedServo1TargetPayload")]
+    [Description("Creates a timestamped message payload that moves the servo motor 1 to the specified pulse width (us) using the configured motion profile.")]
+    public partial class CreateTimestampedServo1TargetPayload : CreateServo1TargetPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that moves the servo motor 1 to the specified pulse width (us) using the configured motion profile.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo1Target register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo1Target.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the maximum velocity (us/s) of the servo motor 1 moves. If zero, the velocity is not limited.
+    /// </summary>
+    [DisplayName("Servo1MaxVelocityPayload")]
+    [Description("Creates a message payload that configures the maximum velocity (us/s) of the servo motor 1 moves. If zero, the velocity is not limited.")]
+    public partial class CreateServo1MaxVelocityPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the maximum velocity (us/s) of the servo motor 1 moves. If zero, the velocity is not limited.
+        /// </summary>
+        [Description("The value that configures the maximum velocity (us/s) of the servo motor 1 moves. If zero, the velocity is not limited.")]
+        public ushort Servo1MaxVelocity { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Servo1MaxVelocity register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Servo1MaxVelocity;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the maximum velocity (us/s) of the servo motor 1 moves. If zero, the velocity is not limited.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo1MaxVelocity register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo1MaxVelocity.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the maximum velocity (us/s) of the servo motor 1 moves. If zero, the velocity is not limited.
+    /// </summary>
+    [DisplayName("TimestampedServo1MaxVelocityPayload")]
+    [Description("Creates a timestamped message payload that configures the maximum velocity (us/s) of the servo motor 1 moves. If zero, the velocity is not limited.")]
+    public partial class CreateTimestampedServo1MaxVelocityPayload : CreateServo1MaxVelocityPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the maximum velocity (us/s) of the servo motor 1 moves. If zero, the velocity is not limited.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo1MaxVelocity register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo1MaxVelocity.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the acceleration (us/s^2) of the servo motor 1 moves. If zero, the acceleration is not limited.
+    /// </summary>
+    [DisplayName("Servo1AccelerationPayload")]
+    [Description("Creates a message payload that configures the acceleration (us/s^2) of the servo motor 1 moves. If zero, the acceleration is not limited.")]
+    public partial class CreateServo1AccelerationPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the acceleration (us/s^2) of the servo motor 1 moves. If zero, the acceleration is not limited.
+        /// </summary>
+        [Description("The value that configures the acceleration (us/s^2) of the servo motor 1 moves. If zero, the acceleration is not limited.")]
+        public ushort Servo1Acceleration { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Servo1Acceleration register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort GetPayload()
+        {
+            return Servo1Acceleration;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the acceleration (us/s^2) of the servo motor 1 moves. If zero, the acceleration is not limited.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo1Acceleration register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo1Acceleration.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the acceleration (us/s^2) of the servo motor 1 moves. If zero, the acceleration is not limited.
+    /// </summary>
+    [DisplayName("TimestampedServo1AccelerationPayload")]
+    [Description("Creates a timestamped message payload that configures the acceleration (us/s^2) of the servo motor 1 moves. If zero, the acceleration is not limited.")]
+    public partial class CreateTimestampedServo1AccelerationPayload : CreateServo1AccelerationPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the acceleration (us/s^2) of the servo motor 1 moves. If zero, the acceleration is not limited.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo1Acceleration register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo1Acceleration.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the motion profile of the servo motor 1 moves.
+    /// </summary>
+    [DisplayName("Servo1ProfilePayload")]
+    [Description("Creates a message payload that configures the motion profile of the servo motor 1 moves.")]
+    public partial class CreateServo1ProfilePayload
     {
         /// <summary>
-        /// Initializes a new instance of the <see cref="CreateMessage"/> class.
+        /// Gets or sets the value that configures the motion profile of the servo motor 1 moves.
         /// </summary>
-        public CreateMessage()
+        [Description("The value that configures the motion profile of the servo motor 1 moves.")]
+        public MotionProfileConfig Servo1Profile { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Servo1Profile register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public MotionProfileConfig GetPayload()
         {
-            Payload = new CreateCameraStartPayload();
+            return Servo1Profile;
         }
 
-        string INamedElement.Name => $"{nameof(CameraController)}.{GetElementDisplayName(Payload)}";
+        /// <summary>
+        /// Creates a message that configures the motion profile of the servo motor 1 moves.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo1Profile register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo1Profile.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the motion profile of the servo motor 1 moves.
+    /// </summary>
+    [DisplayName("TimestampedServo1ProfilePayload")]
+    [Description("Creates a timestamped message payload that configures the motion profile of the servo motor 1 moves.")]
+    public partial class CreateTimestampedServo1ProfilePayload : CreateServo1ProfilePayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the motion profile of the servo motor 1 moves.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo1Profile register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo1Profile.FromPayload(timestamp, messageType, GetPayload());
+        }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that starts the generation of triggers on the specified camera lines.
+    /// that reports the servo motors moving to their target or playing a trajectory. An event is sent when a move or trajectory completes.
     /// </summary>
-    [DisplayName("CameraStartPayload")]
-    [Description("Creates a message payload that starts the generation of triggers on the specified camera lines.")]
-    public partial class CreateCameraStartPayload
+    [DisplayName("ServoMovingPayload")]
+    [Description("Creates a message payload that reports the servo motors moving to their target or playing a trajectory. An event is sent when a move or trajectory completes.")]
+    public partial class CreateServoMovingPayload
     {
         /// <summary>
-        /// Gets or sets the value that starts the generation of triggers on the specified camera lines.
+        /// Gets or sets the value that reports the servo motors moving to their target or playing a trajectory. An event is sent when a move or trajectory completes.
         /// </summary>
-        [Description("The value that starts the generation of triggers on the specified camera lines.")]
-        public Cameras CameraStart { get; set; }
+        [Description("The value that reports the servo motors moving to their target or playing a trajectory. An event is sent when a move or trajectory completes.")]
+        public Servos ServoMoving { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the CameraStart register.
+        /// Creates a message payload for the ServoMoving register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Cameras GetPayload()
+        public Servos GetPayload()
+        {
+            return ServoMoving;
+        }
+
+        /// <summary>
+        /// Creates a message that reports the servo motors moving to their target or playing a trajectory. An event is sent when a move or trajectory completes.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the ServoMoving register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.ServoMoving.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that reports the servo motors moving to their target or playing a trajectory. An event is sent when a move or trajectory completes.
+    /// </summary>
+    [DisplayName("TimestampedServoMovingPayload")]
+    [Description("Creates a timestamped message payload that reports the servo motors moving to their target or playing a trajectory. An event is sent when a move or trajectory completes.")]
+    public partial class CreateTimestampedServoMovingPayload : CreateServoMovingPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that reports the servo motors moving to their target or playing a trajectory. An event is sent when a move or trajectory completes.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the ServoMoving register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.ServoMoving.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the trajectory of servo motor 0 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.
+    /// </summary>
+    [DisplayName("Servo0WaypointsPayload")]
+    [Description("Creates a message payload that configures the trajectory of servo motor 0 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.")]
+    public partial class CreateServo0WaypointsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the trajectory of servo motor 0 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.
+        /// </summary>
+        [Description("The value that configures the trajectory of servo motor 0 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.")]
+        public ushort[] Servo0Waypoints { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Servo0Waypoints register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return Servo0Waypoints;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the trajectory of servo motor 0 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo0Waypoints register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo0Waypoints.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the trajectory of servo motor 0 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.
+    /// </summary>
+    [DisplayName("TimestampedServo0WaypointsPayload")]
+    [Description("Creates a timestamped message payload that configures the trajectory of servo motor 0 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.")]
+    public partial class CreateTimestampedServo0WaypointsPayload : CreateServo0WaypointsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the trajectory of servo motor 0 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo0Waypoints register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo0Waypoints.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the number of waypoints used from the Servo0Waypoints register. The write fails while a playback is queued.
+    /// </summary>
+    [DisplayName("Servo0WaypointCountPayload")]
+    [Description("Creates a message payload that configures the number of waypoints used from the Servo0Waypoints register. The write fails while a playback is queued.")]
+    public partial class CreateServo0WaypointCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the number of waypoints used from the Servo0Waypoints register. The write fails while a playback is queued.
+        /// </summary>
+        [Range(min: 1, max: 8)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the number of waypoints used from the Servo0Waypoints register. The write fails while a playback is queued.")]
+        public byte Servo0WaypointCount { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Servo0WaypointCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
+        {
+            return Servo0WaypointCount;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the number of waypoints used from the Servo0Waypoints register. The write fails while a playback is queued.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo0WaypointCount register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo0WaypointCount.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the number of waypoints used from the Servo0Waypoints register. The write fails while a playback is queued.
+    /// </summary>
+    [DisplayName("TimestampedServo0WaypointCountPayload")]
+    [Description("Creates a timestamped message payload that configures the number of waypoints used from the Servo0Waypoints register. The write fails while a playback is queued.")]
+    public partial class CreateTimestampedServo0WaypointCountPayload : CreateServo0WaypointCountPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the number of waypoints used from the Servo0Waypoints register. The write fails while a playback is queued.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo0WaypointCount register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo0WaypointCount.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the trajectory of servo motor 1 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.
+    /// </summary>
+    [DisplayName("Servo1WaypointsPayload")]
+    [Description("Creates a message payload that configures the trajectory of servo motor 1 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.")]
+    public partial class CreateServo1WaypointsPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the trajectory of servo motor 1 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.
+        /// </summary>
+        [Description("The value that configures the trajectory of servo motor 1 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.")]
+        public ushort[] Servo1Waypoints { get; set; }
+
+        /// <summary>
+        /// Creates a message payload for the Servo1Waypoints register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public ushort[] GetPayload()
+        {
+            return Servo1Waypoints;
+        }
+
+        /// <summary>
+        /// Creates a message that configures the trajectory of servo motor 1 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.
+        /// </summary>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new message for the Servo1Waypoints register.</returns>
+        public HarpMessage GetMessage(MessageType messageType)
+        {
+            return Harp.CameraController.Servo1Waypoints.FromPayload(messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a timestamped message payload
+    /// that configures the trajectory of servo motor 1 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.
+    /// </summary>
+    [DisplayName("TimestampedServo1WaypointsPayload")]
+    [Description("Creates a timestamped message payload that configures the trajectory of servo motor 1 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.")]
+    public partial class CreateTimestampedServo1WaypointsPayload : CreateServo1WaypointsPayload
+    {
+        /// <summary>
+        /// Creates a timestamped message that configures the trajectory of servo motor 1 as up to 8 (time (ms), pulse width (us)) waypoints. The pulse width is linearly interpolated between waypoints. The waypoints are copied when the playback starts, so the next trajectory can be uploaded while one is playing. The write fails while a playback is queued.
+        /// </summary>
+        /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
+        /// <param name="messageType">Specifies the type of the created message.</param>
+        /// <returns>A new timestamped message for the Servo1Waypoints register.</returns>
+        public HarpMessage GetMessage(double timestamp, MessageType messageType)
+        {
+            return Harp.CameraController.Servo1Waypoints.FromPayload(timestamp, messageType, GetPayload());
+        }
+    }
+
+    /// <summary>
+    /// Represents an operator that creates a message payload
+    /// that configures the number of waypoints used from the Servo1Waypoints register. The write fails while a playback is queued.
+    /// </summary>
+    [DisplayName("Servo1WaypointCountPayload")]
+    [Description("Creates a message payload that configures the number of waypoints used from the Servo1Waypoints register. The write fails while a playback is queued.")]
+    public partial class CreateServo1WaypointCountPayload
+    {
+        /// <summary>
+        /// Gets or sets the value that configures the number of waypoints used from the Servo1Waypoints register. The write fails while a playback is queued.
+        /// </summary>
+        [Range(min: 1, max: 8)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that configures the number of waypoints used from the Servo1Waypoints register. The write fails while a playback is queued.")]
+        public byte Servo1WaypointCount { get; set; } = 1;
+
+        /// <summary>
+        /// Creates a message payload for the Servo1WaypointCount register.
+        /// </summary>
+        /// <returns>The created message payload value.</returns>
+        public byte GetPayload()
         {
-            return CameraStart;
+            return Servo1WaypointCount;
         }
 
         /// <summary>
-        /// Creates a message that starts the generation of triggers on the specified camera lines.
+        /// Creates a message that configures the number of waypoints used from the Servo1Waypoints register. The write fails while a playback is queued.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the CameraStart register.</returns>
+        /// <returns>A new message for the Servo1WaypointCount register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.CameraStart.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.Servo1WaypointCount.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that starts the generation of triggers on the specified camera lines.
+    /// that configures the number of waypoints used from the Servo1Waypoints register. The write fails while a playback is queued.
     /// </summary>
-    [DisplayName("TimestampedCameraStartPayload")]
-    [Description("Creates a timestamped message payload that starts the generation of triggers on the specified camera lines.")]
-    public partial class CreateTimestampedCameraStartPayload : CreateCameraStartPayload
+    [DisplayName("TimestampedServo1WaypointCountPayload")]
+    [Description("Creates a timestamped message payload that configures the number of waypoints used from the Servo1Waypoints register. The write fails while a playback is queued.")]
+    public partial class CreateTimestampedServo1WaypointCountPayload : CreateServo1WaypointCountPayload
     {
         /// <summary>
-        /// Creates a timestamped message that starts the generation of triggers on the specified camera lines.
+        /// Creates a timestamped message that configures the number of waypoints used from the Servo1Waypoints register. The write fails while a playback is queued.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the CameraStart register.</returns>
+        /// <returns>A new timestamped message for the Servo1WaypointCount register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.CameraStart.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.Servo1WaypointCount.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that stops the generation of triggers on the specified camera lines.
+    /// that starts the trajectory playback on the specified servo motors. On a servo motor playing a trajectory, the playback of the uploaded waypoints is queued and starts on the PWM period that ends the current trajectory.
     /// </summary>
-    [DisplayName("CameraStopPayload")]
-    [Description("Creates a message payload that stops the generation of triggers on the specified camera lines.")]
-    public partial class CreateCameraStopPayload
+    [DisplayName("ServoPlayPayload")]
+    [Description("Creates a message payload that starts the trajectory playback on the specified servo motors. On a servo motor playing a trajectory, the playback of the uploaded waypoints is queued and starts on the PWM period that ends the current trajectory.")]
+    public partial class CreateServoPlayPayload
     {
         /// <summary>
-        /// Gets or sets the value that stops the generation of triggers on the specified camera lines.
+        /// Gets or sets the value that starts the trajectory playback on the specified servo motors. On a servo motor playing a trajectory, the playback of the uploaded waypoints is queued and starts on the PWM period that ends the current trajectory.
         /// </summary>
-        [Description("The value that stops the generation of triggers on the specified camera lines.")]
-        public Cameras CameraStop { get; set; }
+        [Description("The value that starts the trajectory playback on the specified servo motors. On a servo motor playing a trajectory, the playback of the uploaded waypoints is queued and starts on the PWM period that ends the current trajectory.")]
+        public Servos ServoPlay { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the CameraStop register.
+        /// Creates a message payload for the ServoPlay register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Cameras GetPayload()
+        public Servos GetPayload()
         {
-            return CameraStop;
+            return ServoPlay;
         }
 
         /// <summary>
-        /// Creates a message that stops the generation of triggers on the specified camera lines.
+        /// Creates a message that starts the trajectory playback on the specified servo motors. On a servo motor playing a trajectory, the playback of the uploaded waypoints is queued and starts on the PWM period that ends the current trajectory.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the CameraStop register.</returns>
+        /// <returns>A new message for the ServoPlay register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.CameraStop.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.ServoPlay.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that stops the generation of triggers on the specified camera lines.
+    /// that starts the trajectory playback on the specified servo motors. On a servo motor playing a trajectory, the playback of the uploaded waypoints is queued and starts on the PWM period that ends the current trajectory.
     /// </summary>
-    [DisplayName("TimestampedCameraStopPayload")]
-    [Description("Creates a timestamped message payload that stops the generation of triggers on the specified camera lines.")]
-    public partial class CreateTimestampedCameraStopPayload : CreateCameraStopPayload
+    [DisplayName("TimestampedServoPlayPayload")]
+    [Description("Creates a timestamped message payload that starts the trajectory playback on the specified servo motors. On a servo motor playing a trajectory, the playback of the uploaded waypoints is queued and starts on the PWM period that ends the current trajectory.")]
+    public partial class CreateTimestampedServoPlayPayload : CreateServoPlayPayload
     {
         /// <summary>
-        /// Creates a timestamped message that stops the generation of triggers on the specified camera lines.
+        /// Creates a timestamped message that starts the trajectory playback on the specified servo motors. On a servo motor playing a trajectory, the playback of the uploaded waypoints is queued and starts on the PWM period that ends the current trajectory.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the CameraStop register.</returns>
+        /// <returns>A new timestamped message for the ServoPlay register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.CameraStop.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.ServoPlay.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that enables servo control on the specified camera lines.
+    /// that configures the servo motors whose trajectory playback starts on each DI0 rising edge.
     /// </summary>
-    [DisplayName("ServoEnablePayload")]
-    [Description("Creates a message payload that enables servo control on the specified camera lines.")]
-    public partial class CreateServoEnablePayload
+    [DisplayName("ServoPlayOnDI0Payload")]
+    [Description("Creates a message payload that configures the servo motors whose trajectory playback starts on each DI0 rising edge.")]
+    public partial class CreateServoPlayOnDI0Payload
     {
         /// <summary>
-        /// Gets or sets the value that enables servo control on the specified camera lines.
+        /// Gets or sets the value that configures the servo motors whose trajectory playback starts on each DI0 rising edge.
         /// </summary>
-        [Description("The value that enables servo control on the specified camera lines.")]
-        public Servos ServoEnable { get; set; }
+        [Description("The value that configures the servo motors whose trajectory playback starts on each DI0 rising edge.")]
+        public Servos ServoPlayOnDI0 { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ServoEnable register.
+        /// Creates a message payload for the ServoPlayOnDI0 register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public Servos GetPayload()
         {
-            return ServoEnable;
+            return ServoPlayOnDI0;
         }
 
         /// <summary>
-        /// Creates a message that enables servo control on the specified camera lines.
+        /// Creates a message that configures the servo motors whose trajectory playback starts on each DI0 rising edge.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ServoEnable register.</returns>
+        /// <returns>A new message for the ServoPlayOnDI0 register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.ServoEnable.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.ServoPlayOnDI0.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that enables servo control on the specified camera lines.
+    /// that configures the servo motors whose trajectory playback starts on each DI0 rising edge.
     /// </summary>
-    [DisplayName("TimestampedServoEnablePayload")]
-    [Description("Creates a timestamped message payload that enables servo control on the specified camera lines.")]
-    public partial class CreateTimestampedServoEnablePayload : CreateServoEnablePayload
+    [DisplayName("TimestampedServoPlayOnDI0Payload")]
+    [Description("Creates a timestamped message payload that configures the servo motors whose trajectory playback starts on each DI0 rising edge.")]
+    public partial class CreateTimestampedServoPlayOnDI0Payload : CreateServoPlayOnDI0Payload
     {
         /// <summary>
-        /// Creates a timestamped message that enables servo control on the specified camera lines.
+        /// Creates a timestamped message that configures the servo motors whose trajectory playback starts on each DI0 rising edge.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ServoEnable register.</returns>
+        /// <returns>A new timestamped message for the ServoPlayOnDI0 register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.ServoEnable.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.ServoPlayOnDI0.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that disables servo control on the specified camera lines.
+    /// that configures the servo 0 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.
     /// </summary>
-    [DisplayName("ServoDisablePayload")]
-    [Description("Creates a message payload that disables servo control on the specified camera lines.")]
-    public partial class CreateServoDisablePayload
+    [DisplayName("Servo0PulseWidthFinePayload")]
+    [Description("Creates a message payload that configures the servo 0 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.")]
+    public partial class CreateServo0PulseWidthFinePayload
     {
         /// <summary>
-        /// Gets or sets the value that disables servo control on the specified camera lines.
+        /// Gets or sets the value that configures the servo 0 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.
         /// </summary>
-        [Description("The value that disables servo control on the specified camera lines.")]
-        public Servos ServoDisable { get; set; }
+        [Description("The value that configures the servo 0 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.")]
+        public ushort Servo0PulseWidthFine { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ServoDisable register.
+        /// Creates a message payload for the Servo0PulseWidthFine register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Servos GetPayload()
+        public ushort GetPayload()
         {
-            return ServoDisable;
+            return Servo0PulseWidthFine;
         }
 
         /// <summary>
-        /// Creates a message that disables servo control on the specified camera lines.
+        /// Creates a message that configures the servo 0 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ServoDisable register.</returns>
+        /// <returns>A new message for the Servo0PulseWidthFine register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.ServoDisable.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.Servo0PulseWidthFine.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that disables servo control on the specified camera lines.
+    /// that configures the servo 0 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.
     /// </summary>
-    [DisplayName("TimestampedServoDisablePayload")]
-    [Description("Creates a timestamped message payload that disables servo control on the specified camera lines.")]
-    public partial class CreateTimestampedServoDisablePayload : CreateServoDisablePayload
+    [DisplayName("TimestampedServo0PulseWidthFinePayload")]
+    [Description("Creates a timestamped message payload that configures the servo 0 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.")]
+    public partial class CreateTimestampedServo0PulseWidthFinePayload : CreateServo0PulseWidthFinePayload
     {
         /// <summary>
-        /// Creates a timestamped message that disables servo control on the specified camera lines.
+        /// Creates a timestamped message that configures the servo 0 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ServoDisable register.</returns>
+        /// <returns>A new timestamped message for the Servo0PulseWidthFine register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.ServoDisable.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.Servo0PulseWidthFine.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that set the specified digital output lines.
+    /// that configures the servo 1 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.
     /// </summary>
-    [DisplayName("OutputSetPayload")]
-    [Description("Creates a message payload that set the specified digital output lines.")]
-    public partial class CreateOutputSetPayload
+    [DisplayName("Servo1PulseWidthFinePayload")]
+    [Description("Creates a message payload that configures the servo 1 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.")]
+    public partial class CreateServo1PulseWidthFinePayload
     {
         /// <summary>
-        /// Gets or sets the value that set the specified digital output lines.
+        /// Gets or sets the value that configures the servo 1 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.
         /// </summary>
-        [Description("The value that set the specified digital output lines.")]
-        public DigitalOutputs OutputSet { get; set; }
+        [Description("The value that configures the servo 1 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.")]
+        public ushort Servo1PulseWidthFine { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OutputSet register.
+        /// Creates a message payload for the Servo1PulseWidthFine register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public ushort GetPayload()
         {
-            return OutputSet;
+            return Servo1PulseWidthFine;
         }
 
         /// <summary>
-        /// Creates a message that set the specified digital output lines.
+        /// Creates a message that configures the servo 1 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OutputSet register.</returns>
+        /// <returns>A new message for the Servo1PulseWidthFine register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.OutputSet.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.Servo1PulseWidthFine.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that set the specified digital output lines.
+    /// that configures the servo 1 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.
     /// </summary>
-    [DisplayName("TimestampedOutputSetPayload")]
-    [Description("Creates a timestamped message payload that set the specified digital output lines.")]
-    public partial class CreateTimestampedOutputSetPayload : CreateOutputSetPayload
+    [DisplayName("TimestampedServo1PulseWidthFinePayload")]
+    [Description("Creates a timestamped message payload that configures the servo 1 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.")]
+    public partial class CreateTimestampedServo1PulseWidthFinePayload : CreateServo1PulseWidthFinePayload
     {
         /// <summary>
-        /// Creates a timestamped message that set the specified digital output lines.
+        /// Creates a timestamped message that configures the servo 1 pulse width in units of 1/8 us when using Servo mode. The pulse width is applied at the timer resolution given by the period, so only periods up to 8192 us use every 1/8 us step. Reads back the pulse width applied, rounded to the timer resolution.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OutputSet register.</returns>
+        /// <returns>A new timestamped message for the Servo1PulseWidthFine register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.OutputSet.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.Servo1PulseWidthFine.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that clear the specified digital output lines.
+    /// that queues a batch of servo 0 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.
     /// </summary>
-    [DisplayName("OutputClearPayload")]
-    [Description("Creates a message payload that clear the specified digital output lines.")]
-    public partial class CreateOutputClearPayload
+    [DisplayName("Servo0SetpointFifoPayload")]
+    [Description("Creates a message payload that queues a batch of servo 0 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.")]
+    public partial class CreateServo0SetpointFifoPayload
     {
         /// <summary>
-        /// Gets or sets the value that clear the specified digital output lines.
+        /// Gets or sets the value that queues a batch of servo 0 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.
         /// </summary>
-        [Description("The value that clear the specified digital output lines.")]
-        public DigitalOutputs OutputClear { get; set; }
+        [Description("The value that queues a batch of servo 0 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.")]
+        public ushort[] Servo0SetpointFifo { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OutputClear register.
+        /// Creates a message payload for the Servo0SetpointFifo register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public ushort[] GetPayload()
         {
-            return OutputClear;
+            return Servo0SetpointFifo;
         }
 
         /// <summary>
-        /// Creates a message that clear the specified digital output lines.
+        /// Creates a message that queues a batch of servo 0 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OutputClear register.</returns>
+        /// <returns>A new message for the Servo0SetpointFifo register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.OutputClear.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.Servo0SetpointFifo.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that clear the specified digital output lines.
+    /// that queues a batch of servo 0 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.
     /// </summary>
-    [DisplayName("TimestampedOutputClearPayload")]
-    [Description("Creates a timestamped message payload that clear the specified digital output lines.")]
-    public partial class CreateTimestampedOutputClearPayload : CreateOutputClearPayload
+    [DisplayName("TimestampedServo0SetpointFifoPayload")]
+    [Description("Creates a timestamped message payload that queues a batch of servo 0 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.")]
+    public partial class CreateTimestampedServo0SetpointFifoPayload : CreateServo0SetpointFifoPayload
     {
         /// <summary>
-        /// Creates a timestamped message that clear the specified digital output lines.
+        /// Creates a timestamped message that queues a batch of servo 0 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OutputClear register.</returns>
+        /// <returns>A new timestamped message for the Servo0SetpointFifo register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.OutputClear.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.Servo0SetpointFifo.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that write the state of all digital output lines.
+    /// that queues a batch of servo 1 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.
     /// </summary>
-    [DisplayName("OutputStatePayload")]
-    [Description("Creates a message payload that write the state of all digital output lines.")]
-    public partial class CreateOutputStatePayload
+    [DisplayName("Servo1SetpointFifoPayload")]
+    [Description("Creates a message payload that queues a batch of servo 1 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.")]
+    public partial class CreateServo1SetpointFifoPayload
     {
         /// <summary>
-        /// Gets or sets the value that write the state of all digital output lines.
+        /// Gets or sets the value that queues a batch of servo 1 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.
         /// </summary>
-        [Description("The value that write the state of all digital output lines.")]
-        public DigitalOutputs OutputState { get; set; }
+        [Description("The value that queues a batch of servo 1 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.")]
+        public ushort[] Servo1SetpointFifo { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the OutputState register.
+        /// Creates a message payload for the Servo1SetpointFifo register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalOutputs GetPayload()
+        public ushort[] GetPayload()
         {
-            return OutputState;
+            return Servo1SetpointFifo;
         }
 
         /// <summary>
-        /// Creates a message that write the state of all digital output lines.
+        /// Creates a message that queues a batch of servo 1 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the OutputState register.</returns>
+        /// <returns>A new message for the Servo1SetpointFifo register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.OutputState.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.Servo1SetpointFifo.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that write the state of all digital output lines.
+    /// that queues a batch of servo 1 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.
     /// </summary>
-    [DisplayName("TimestampedOutputStatePayload")]
-    [Description("Creates a timestamped message payload that write the state of all digital output lines.")]
-    public partial class CreateTimestampedOutputStatePayload : CreateOutputStatePayload
+    [DisplayName("TimestampedServo1SetpointFifoPayload")]
+    [Description("Creates a timestamped message payload that queues a batch of servo 1 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.")]
+    public partial class CreateTimestampedServo1SetpointFifoPayload : CreateServo1SetpointFifoPayload
     {
         /// <summary>
-        /// Creates a timestamped message that write the state of all digital output lines.
+        /// Creates a timestamped message that queues a batch of servo 1 pulse widths (1/8 us) that are applied one per PWM period, in order. Zero entries are skipped. The write fails if the servo is not running or there is no room for the batch.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the OutputState register.</returns>
+        /// <returns>A new timestamped message for the Servo1SetpointFifo register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.OutputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.Servo1SetpointFifo.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that emits an event when the state of the digital input line changes.
+    /// that reports the number of setpoint FIFO underruns of each servo motor. An event is sent when a FIFO runs empty, and the last pulse width is kept.
     /// </summary>
-    [DisplayName("DigitalInputStatePayload")]
-    [Description("Creates a message payload that emits an event when the state of the digital input line changes.")]
-    public partial class CreateDigitalInputStatePayload
+    [DisplayName("ServoUnderrunsPayload")]
+    [Description("Creates a message payload that reports the number of setpoint FIFO underruns of each servo motor. An event is sent when a FIFO runs empty, and the last pulse width is kept.")]
+    public partial class CreateServoUnderrunsPayload
     {
         /// <summary>
-        /// Gets or sets the value that emits an event when the state of the digital input line changes.
+        /// Gets or sets the value that reports the number of setpoint FIFO underruns of each servo motor. An event is sent when a FIFO runs empty, and the last pulse width is kept.
         /// </summary>
-        [Description("The value that emits an event when the state of the digital input line changes.")]
-        public DigitalInputs DigitalInputState { get; set; }
+        [Description("The value that reports the number of setpoint FIFO underruns of each servo motor. An event is sent when a FIFO runs empty, and the last pulse width is kept.")]
+        public ushort[] ServoUnderruns { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DigitalInputState register.
+        /// Creates a message payload for the ServoUnderruns register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DigitalInputs GetPayload()
+        public ushort[] GetPayload()
         {
-            return DigitalInputState;
+            return ServoUnderruns;
         }
 
         /// <summary>
-        /// Creates a message that emits an event when the state of the digital input line changes.
+        /// Creates a message that reports the number of setpoint FIFO underruns of each servo motor. An event is sent when a FIFO runs empty, and the last pulse width is kept.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DigitalInputState register.</returns>
+        /// <returns>A new message for the ServoUnderruns register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.DigitalInputState.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.ServoUnderruns.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that emits an event when the state of the digital input line changes.
+    /// that reports the number of setpoint FIFO underruns of each servo motor. An event is sent when a FIFO runs empty, and the last pulse width is kept.
     /// </summary>
-    [DisplayName("TimestampedDigitalInputStatePayload")]
-    [Description("Creates a timestamped message payload that emits an event when the state of the digital input line changes.")]
-    public partial class CreateTimestampedDigitalInputStatePayload : CreateDigitalInputStatePayload
+    [DisplayName("TimestampedServoUnderrunsPayload")]
+    [Description("Creates a timestamped message payload that reports the number of setpoint FIFO underruns of each servo motor. An event is sent when a FIFO runs empty, and the last pulse width is kept.")]
+    public partial class CreateTimestampedServoUnderrunsPayload : CreateServoUnderrunsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that emits an event when the state of the digital input line changes.
+        /// Creates a timestamped message that reports the number of setpoint FIFO underruns of each servo motor. An event is sent when a FIFO runs empty, and the last pulse width is kept.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DigitalInputState register.</returns>
+        /// <returns>A new timestamped message for the ServoUnderruns register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.DigitalInputState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.ServoUnderruns.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that emits an event when a frame is triggered on camera 0.
+    /// that reports the function holding each timer, in the order TCC0 (Camera/Servo 0), TCC1, TCD0 (Camera/Servo 1), TCD1 and TCE0. TCC1 is the Harp timestamp timer and always reports 8. 0: free, 1: Camera, 2: Servo, 3: ExternalClock or OneShot (TCE0 measures the DI0 period), 4: Sequence, 5: clock discipline (TCD1), 6: CameraSoftTrigger, 7: trigger jitter measurement (TCE0), 8: Harp core.
     /// </summary>
-    [DisplayName("Camera0TriggerPayload")]
-    [Description("Creates a message payload that emits an event when a frame is triggered on camera 0.")]
-    public partial class CreateCamera0TriggerPayload
+    [DisplayName("TimerOwnersPayload")]
+    [Description("Creates a message payload that reports the function holding each timer, in the order TCC0 (Camera/Servo 0), TCC1, TCD0 (Camera/Servo 1), TCD1 and TCE0. TCC1 is the Harp timestamp timer and always reports 8. 0: free, 1: Camera, 2: Servo, 3: ExternalClock or OneShot (TCE0 measures the DI0 period), 4: Sequence, 5: clock discipline (TCD1), 6: CameraSoftTrigger, 7: trigger jitter measurement (TCE0), 8: Harp core.")]
+    public partial class CreateTimerOwnersPayload
     {
         /// <summary>
-        /// Gets or sets the value that emits an event when a frame is triggered on camera 0.
+        /// Gets or sets the value that reports the function holding each timer, in the order TCC0 (Camera/Servo 0), TCC1, TCD0 (Camera/Servo 1), TCD1 and TCE0. TCC1 is the Harp timestamp timer and always reports 8. 0: free, 1: Camera, 2: Servo, 3: ExternalClock or OneShot (TCE0 measures the DI0 period), 4: Sequence, 5: clock discipline (TCD1), 6: CameraSoftTrigger, 7: trigger jitter measurement (TCE0), 8: Harp core.
         /// </summary>
-        [Description("The value that emits an event when a frame is triggered on camera 0.")]
-        public byte Camera0Trigger { get; set; }
+        [Description("The value that reports the function holding each timer, in the order TCC0 (Camera/Servo 0), TCC1, TCD0 (Camera/Servo 1), TCD1 and TCE0. TCC1 is the Harp timestamp timer and always reports 8. 0: free, 1: Camera, 2: Servo, 3: ExternalClock or OneShot (TCE0 measures the DI0 period), 4: Sequence, 5: clock discipline (TCD1), 6: CameraSoftTrigger, 7: trigger jitter measurement (TCE0), 8: Harp core.")]
+        public byte[] TimerOwners { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Camera0Trigger register.
+        /// Creates a message payload for the TimerOwners register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte GetPayload()
+        public byte[] GetPayload()
         {
-            return Camera0Trigger;
+            return TimerOwners;
         }
 
         /// <summary>
-        /// Creates a message that emits an event when a frame is triggered on camera 0.
+        /// Creates a message that reports the function holding each timer, in the order TCC0 (Camera/Servo 0), TCC1, TCD0 (Camera/Servo 1), TCD1 and TCE0. TCC1 is the Harp timestamp timer and always reports 8. 0: free, 1: Camera, 2: Servo, 3: ExternalClock or OneShot (TCE0 measures the DI0 period), 4: Sequence, 5: clock discipline (TCD1), 6: CameraSoftTrigger, 7: trigger jitter measurement (TCE0), 8: Harp core.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Camera0Trigger register.</returns>
+        /// <returns>A new message for the TimerOwners register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.Camera0Trigger.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.TimerOwners.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that emits an event when a frame is triggered on camera 0.
+    /// that reports the function holding each timer, in the order TCC0 (Camera/Servo 0), TCC1, TCD0 (Camera/Servo 1), TCD1 and TCE0. TCC1 is the Harp timestamp timer and always reports 8. 0: free, 1: Camera, 2: Servo, 3: ExternalClock or OneShot (TCE0 measures the DI0 period), 4: Sequence, 5: clock discipline (TCD1), 6: CameraSoftTrigger, 7: trigger jitter measurement (TCE0), 8: Harp core.
     /// </summary>
-    [DisplayName("TimestampedCamera0TriggerPayload")]
-    [Description("Creates a timestamped message payload that emits an event when a frame is triggered on camera 0.")]
-    public partial class CreateTimestampedCamera0TriggerPayload : CreateCamera0TriggerPayload
+    [DisplayName("TimestampedTimerOwnersPayload")]
+    [Description("Creates a timestamped message payload that reports the function holding each timer, in the order TCC0 (Camera/Servo 0), TCC1, TCD0 (Camera/Servo 1), TCD1 and TCE0. TCC1 is the Harp timestamp timer and always reports 8. 0: free, 1: Camera, 2: Servo, 3: ExternalClock or OneShot (TCE0 measures the DI0 period), 4: Sequence, 5: clock discipline (TCD1), 6: CameraSoftTrigger, 7: trigger jitter measurement (TCE0), 8: Harp core.")]
+    public partial class CreateTimestampedTimerOwnersPayload : CreateTimerOwnersPayload
     {
         /// <summary>
-        /// Creates a timestamped message that emits an event when a frame is triggered on camera 0.
+        /// Creates a timestamped message that reports the function holding each timer, in the order TCC0 (Camera/Servo 0), TCC1, TCD0 (Camera/Servo 1), TCD1 and TCE0. TCC1 is the Harp timestamp timer and always reports 8. 0: free, 1: Camera, 2: Servo, 3: ExternalClock or OneShot (TCE0 measures the DI0 period), 4: Sequence, 5: clock discipline (TCD1), 6: CameraSoftTrigger, 7: trigger jitter measurement (TCE0), 8: Harp core.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Camera0Trigger register.</returns>
+        /// <returns>A new timestamped message for the TimerOwners register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.Camera0Trigger.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.TimerOwners.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that emits an event when a frame is triggered on camera 1.
+    /// that restarts the PWM period of the specified running servo motors on the same clock cycle. The period in progress is cut short on each servo motor restarted. Servos with the same period stay phase-aligned.
     /// </summary>
-    [DisplayName("Camera1TriggerPayload")]
-    [Description("Creates a message payload that emits an event when a frame is triggered on camera 1.")]
-    public partial class CreateCamera1TriggerPayload
+    [DisplayName("ServoAlignPayload")]
+    [Description("Creates a message payload that restarts the PWM period of the specified running servo motors on the same clock cycle. The period in progress is cut short on each servo motor restarted. Servos with the same period stay phase-aligned.")]
+    public partial class CreateServoAlignPayload
     {
         /// <summary>
-        /// Gets or sets the value that emits an event when a frame is triggered on camera 1.
+        /// Gets or sets the value that restarts the PWM period of the specified running servo motors on the same clock cycle. The period in progress is cut short on each servo motor restarted. Servos with the same period stay phase-aligned.
         /// </summary>
-        [Description("The value that emits an event when a frame is triggered on camera 1.")]
-        public byte Camera1Trigger { get; set; }
+        [Description("The value that restarts the PWM period of the specified running servo motors on the same clock cycle. The period in progress is cut short on each servo motor restarted. Servos with the same period stay phase-aligned.")]
+        public Servos ServoAlign { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Camera1Trigger register.
+        /// Creates a message payload for the ServoAlign register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte GetPayload()
+        public Servos GetPayload()
         {
-            return Camera1Trigger;
+            return ServoAlign;
         }
 
         /// <summary>
-        /// Creates a message that emits an event when a frame is triggered on camera 1.
+        /// Creates a message that restarts the PWM period of the specified running servo motors on the same clock cycle. The period in progress is cut short on each servo motor restarted. Servos with the same period stay phase-aligned.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Camera1Trigger register.</returns>
+        /// <returns>A new message for the ServoAlign register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.Camera1Trigger.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.ServoAlign.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that emits an event when a frame is triggered on camera 1.
+    /// that restarts the PWM period of the specified running servo motors on the same clock cycle. The period in progress is cut short on each servo motor restarted. Servos with the same period stay phase-aligned.
     /// </summary>
-    [DisplayName("TimestampedCamera1TriggerPayload")]
-    [Description("Creates a timestamped message payload that emits an event when a frame is triggered on camera 1.")]
-    public partial class CreateTimestampedCamera1TriggerPayload : CreateCamera1TriggerPayload
+    [DisplayName("TimestampedServoAlignPayload")]
+    [Description("Creates a timestamped message payload that restarts the PWM period of the specified running servo motors on the same clock cycle. The period in progress is cut short on each servo motor restarted. Servos with the same period stay phase-aligned.")]
+    public partial class CreateTimestampedServoAlignPayload : CreateServoAlignPayload
     {
         /// <summary>
-        /// Creates a timestamped message that emits an event when a frame is triggered on camera 1.
+        /// Creates a timestamped message that restarts the PWM period of the specified running servo motors on the same clock cycle. The period in progress is cut short on each servo motor restarted. Servos with the same period stay phase-aligned.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Camera1Trigger register.</returns>
+        /// <returns>A new timestamped message for the ServoAlign register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.Camera1Trigger.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.ServoAlign.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that emits an event when a sync state is toggled on camera 0.
+    /// that reports the state of each camera/servo line. 0: idle, 1: starting (a start waits for the stop in progress), 2: running camera triggers, 3: stopping after the current trigger, 4: running a servo. An event is sent on each change.
     /// </summary>
-    [DisplayName("Camera0SyncPayload")]
-    [Description("Creates a message payload that emits an event when a sync state is toggled on camera 0.")]
-    public partial class CreateCamera0SyncPayload
+    [DisplayName("ChannelStatePayload")]
+    [Description("Creates a message payload that reports the state of each camera/servo line. 0: idle, 1: starting (a start waits for the stop in progress), 2: running camera triggers, 3: stopping after the current trigger, 4: running a servo. An event is sent on each change.")]
+    public partial class CreateChannelStatePayload
     {
         /// <summary>
-        /// Gets or sets the value that emits an event when a sync state is toggled on camera 0.
+        /// Gets or sets the value that reports the state of each camera/servo line. 0: idle, 1: starting (a start waits for the stop in progress), 2: running camera triggers, 3: stopping after the current trigger, 4: running a servo. An event is sent on each change.
         /// </summary>
-        [Description("The value that emits an event when a sync state is toggled on camera 0.")]
-        public byte Camera0Sync { get; set; }
+        [Description("The value that reports the state of each camera/servo line. 0: idle, 1: starting (a start waits for the stop in progress), 2: running camera triggers, 3: stopping after the current trigger, 4: running a servo. An event is sent on each change.")]
+        public byte[] ChannelState { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Camera0Sync register.
+        /// Creates a message payload for the ChannelState register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte GetPayload()
+        public byte[] GetPayload()
         {
-            return Camera0Sync;
+            return ChannelState;
         }
 
         /// <summary>
-        /// Creates a message that emits an event when a sync state is toggled on camera 0.
+        /// Creates a message that reports the state of each camera/servo line. 0: idle, 1: starting (a start waits for the stop in progress), 2: running camera triggers, 3: stopping after the current trigger, 4: running a servo. An event is sent on each change.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Camera0Sync register.</returns>
+        /// <returns>A new message for the ChannelState register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.Camera0Sync.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.ChannelState.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that emits an event when a sync state is toggled on camera 0.
+    /// that reports the state of each camera/servo line. 0: idle, 1: starting (a start waits for the stop in progress), 2: running camera triggers, 3: stopping after the current trigger, 4: running a servo. An event is sent on each change.
     /// </summary>
-    [DisplayName("TimestampedCamera0SyncPayload")]
-    [Description("Creates a timestamped message payload that emits an event when a sync state is toggled on camera 0.")]
-    public partial class CreateTimestampedCamera0SyncPayload : CreateCamera0SyncPayload
+    [DisplayName("TimestampedChannelStatePayload")]
+    [Description("Creates a timestamped message payload that reports the state of each camera/servo line. 0: idle, 1: starting (a start waits for the stop in progress), 2: running camera triggers, 3: stopping after the current trigger, 4: running a servo. An event is sent on each change.")]
+    public partial class CreateTimestampedChannelStatePayload : CreateChannelStatePayload
     {
         /// <summary>
-        /// Creates a timestamped message that emits an event when a sync state is toggled on camera 0.
+        /// Creates a timestamped message that reports the state of each camera/servo line. 0: idle, 1: starting (a start waits for the stop in progress), 2: running camera triggers, 3: stopping after the current trigger, 4: running a servo. An event is sent on each change.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Camera0Sync register.</returns>
+        /// <returns>A new timestamped message for the ChannelState register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.Camera0Sync.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.ChannelState.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that emits an event when a sync state is toggled on camera 0.
+    /// that fires a single trigger pulse with the configured TriggerWidth on the specified cameras, at the same time. The pulse starts while the command is handled, a few us after it is received, and a Camera event is sent. The sync output is not changed. The write fails if a specified line is not stopped.
     /// </summary>
-    [DisplayName("Camera1SyncPayload")]
-    [Description("Creates a message payload that emits an event when a sync state is toggled on camera 0.")]
-    public partial class CreateCamera1SyncPayload
+    [DisplayName("CameraSoftTriggerPayload")]
+    [Description("Creates a message payload that fires a single trigger pulse with the configured TriggerWidth on the specified cameras, at the same time. The pulse starts while the command is handled, a few us after it is received, and a Camera event is sent. The sync output is not changed. The write fails if a specified line is not stopped.")]
+    public partial class CreateCameraSoftTriggerPayload
     {
         /// <summary>
-        /// Gets or sets the value that emits an event when a sync state is toggled on camera 0.
+        /// Gets or sets the value that fires a single trigger pulse with the configured TriggerWidth on the specified cameras, at the same time. The pulse starts while the command is handled, a few us after it is received, and a Camera event is sent. The sync output is not changed. The write fails if a specified line is not stopped.
         /// </summary>
-        [Description("The value that emits an event when a sync state is toggled on camera 0.")]
-        public byte Camera1Sync { get; set; }
+        [Description("The value that fires a single trigger pulse with the configured TriggerWidth on the specified cameras, at the same time. The pulse starts while the command is handled, a few us after it is received, and a Camera event is sent. The sync output is not changed. The write fails if a specified line is not stopped.")]
+        public Cameras CameraSoftTrigger { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Camera1Sync register.
+        /// Creates a message payload for the CameraSoftTrigger register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte GetPayload()
+        public Cameras GetPayload()
         {
-            return Camera1Sync;
+            return CameraSoftTrigger;
         }
 
         /// <summary>
-        /// Creates a message that emits an event when a sync state is toggled on camera 0.
+        /// Creates a message that fires a single trigger pulse with the configured TriggerWidth on the specified cameras, at the same time. The pulse starts while the command is handled, a few us after it is received, and a Camera event is sent. The sync output is not changed. The write fails if a specified line is not stopped.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Camera1Sync register.</returns>
+        /// <returns>A new message for the CameraSoftTrigger register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.Camera1Sync.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.CameraSoftTrigger.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that emits an event when a sync state is toggled on camera 0.
+    /// that fires a single trigger pulse with the configured TriggerWidth on the specified cameras, at the same time. The pulse starts while the command is handled, a few us after it is received, and a Camera event is sent. The sync output is not changed. The write fails if a specified line is not stopped.
     /// </summary>
-    [DisplayName("TimestampedCamera1SyncPayload")]
-    [Description("Creates a timestamped message payload that emits an event when a sync state is toggled on camera 0.")]
-    public partial class CreateTimestampedCamera1SyncPayload : CreateCamera1SyncPayload
+    [DisplayName("TimestampedCameraSoftTriggerPayload")]
+    [Description("Creates a timestamped message payload that fires a single trigger pulse with the configured TriggerWidth on the specified cameras, at the same time. The pulse starts while the command is handled, a few us after it is received, and a Camera event is sent. The sync output is not changed. The write fails if a specified line is not stopped.")]
+    public partial class CreateTimestampedCameraSoftTriggerPayload : CreateCameraSoftTriggerPayload
     {
         /// <summary>
-        /// Creates a timestamped message that emits an event when a sync state is toggled on camera 0.
+        /// Creates a timestamped message that fires a single trigger pulse with the configured TriggerWidth on the specified cameras, at the same time. The pulse starts while the command is handled, a few us after it is received, and a Camera event is sent. The sync output is not changed. The write fails if a specified line is not stopped.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Camera1Sync register.</returns>
+        /// <returns>A new timestamped message for the CameraSoftTrigger register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.Camera1Sync.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.CameraSoftTrigger.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that returns the current state of the servo motors.
+    /// that when set to 1, writes to the configuration registers are checked for address, type, length and value and queued instead of applied, up to 6 writes and 48 bytes, enough for one schedule. Writes to command and action registers, like CameraStart, CameraStop, CameraSoftTrigger, Servo0Target, ServoPlay or Servo0SetpointFifo, fail while staging. The write reply reports whether the write was queued and carries the previous value.
     /// </summary>
-    [DisplayName("ServoStatePayload")]
-    [Description("Creates a message payload that returns the current state of the servo motors.")]
-    public partial class CreateServoStatePayload
+    [DisplayName("ConfigStagePayload")]
+    [Description("Creates a message payload that when set to 1, writes to the configuration registers are checked for address, type, length and value and queued instead of applied, up to 6 writes and 48 bytes, enough for one schedule. Writes to command and action registers, like CameraStart, CameraStop, CameraSoftTrigger, Servo0Target, ServoPlay or Servo0SetpointFifo, fail while staging. The write reply reports whether the write was queued and carries the previous value.")]
+    public partial class CreateConfigStagePayload
     {
         /// <summary>
-        /// Gets or sets the value that returns the current state of the servo motors.
+        /// Gets or sets the value that when set to 1, writes to the configuration registers are checked for address, type, length and value and queued instead of applied, up to 6 writes and 48 bytes, enough for one schedule. Writes to command and action registers, like CameraStart, CameraStop, CameraSoftTrigger, Servo0Target, ServoPlay or Servo0SetpointFifo, fail while staging. The write reply reports whether the write was queued and carries the previous value.
         /// </summary>
-        [Description("The value that returns the current state of the servo motors.")]
-        public Servos ServoState { get; set; }
+        [Description("The value that when set to 1, writes to the configuration registers are checked for address, type, length and value and queued instead of applied, up to 6 writes and 48 bytes, enough for one schedule. Writes to command and action registers, like CameraStart, CameraStop, CameraSoftTrigger, Servo0Target, ServoPlay or Servo0SetpointFifo, fail while staging. The write reply reports whether the write was queued and carries the previous value.")]
+        public byte ConfigStage { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the ServoState register.
+        /// Creates a message payload for the ConfigStage register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public Servos GetPayload()
+        public byte GetPayload()
         {
-            return ServoState;
+            return ConfigStage;
         }
 
         /// <summary>
-        /// Creates a message that returns the current state of the servo motors.
+        /// Creates a message that when set to 1, writes to the configuration registers are checked for address, type, length and value and queued instead of applied, up to 6 writes and 48 bytes, enough for one schedule. Writes to command and action registers, like CameraStart, CameraStop, CameraSoftTrigger, Servo0Target, ServoPlay or Servo0SetpointFifo, fail while staging. The write reply reports whether the write was queued and carries the previous value.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the ServoState register.</returns>
+        /// <returns>A new message for the ConfigStage register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.ServoState.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.ConfigStage.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
-    /// Represents an operator that creates a timestamped message payload
-    /// that returns the current state of the servo motors.
-    /// </summary>
-    [DisplayName("TimestampedServoStatePayload")]
-    [Description("Creates a timestamped message payload that returns the current state of the servo motors.")]
-    public partial class CreateTimestampedServoStatePayload : CreateServoStatePayload
+    /// Represents an operator that creates a timestamped message payload
+    /// that when set to 1, writes to the configuration registers are checked for address, type, length and value and queued instead of applied, up to 6 writes and 48 bytes, enough for one schedule. Writes to command and action registers, like CameraStart, CameraStop, CameraSoftTrigger, Servo0Target, ServoPlay or Servo0SetpointFifo, fail while staging. The write reply reports whether the write was queued and carries the previous value.
+    /// </summary>
+    [DisplayName("TimestampedConfigStagePayload")]
+    [Description("Creates a timestamped message payload that when set to 1, writes to the configuration registers are checked for address, type, length and value and queued instead of applied, up to 6 writes and 48 bytes, enough for one schedule. Writes to command and action registers, like CameraStart, CameraStop, CameraSoftTrigger, Servo0Target, ServoPlay or Servo0SetpointFifo, fail while staging. The write reply reports whether the write was queued and carries the previous value.")]
+    public partial class CreateTimestampedConfigStagePayload : CreateConfigStagePayload
     {
         /// <summary>
-        /// Creates a timestamped message that returns the current state of the servo motors.
+        /// Creates a timestamped message that when set to 1, writes to the configuration registers are checked for address, type, length and value and queued instead of applied, up to 6 writes and 48 bytes, enough for one schedule. Writes to command and action registers, like CameraStart, CameraStop, CameraSoftTrigger, Servo0Target, ServoPlay or Servo0SetpointFifo, fail while staging. The write reply reports whether the write was queued and carries the previous value.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the ServoState register.</returns>
+        /// <returns>A new timestamped message for the ConfigStage register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.ServoState.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.ConfigStage.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures the interval in seconds between each sync pulse.
+    /// that applies or discards the queued writes. The queued writes are applied in order with the interrupts disabled, and the modes take effect once, from the final values. Reads the number of queued writes rejected by the last commit, and an event is sent when a commit completes.
     /// </summary>
-    [DisplayName("SyncIntervalPayload")]
-    [Description("Creates a message payload that configures the interval in seconds between each sync pulse.")]
-    public partial class CreateSyncIntervalPayload
+    [DisplayName("ConfigCommitPayload")]
+    [Description("Creates a message payload that applies or discards the queued writes. The queued writes are applied in order with the interrupts disabled, and the modes take effect once, from the final values. Reads the number of queued writes rejected by the last commit, and an event is sent when a commit completes.")]
+    public partial class CreateConfigCommitPayload
     {
         /// <summary>
-        /// Gets or sets the value that configures the interval in seconds between each sync pulse.
+        /// Gets or sets the value that applies or discards the queued writes. The queued writes are applied in order with the interrupts disabled, and the modes take effect once, from the final values. Reads the number of queued writes rejected by the last commit, and an event is sent when a commit completes.
         /// </summary>
-        [Description("The value that configures the interval in seconds between each sync pulse.")]
-        public byte SyncInterval { get; set; }
+        [Description("The value that applies or discards the queued writes. The queued writes are applied in order with the interrupts disabled, and the modes take effect once, from the final values. Reads the number of queued writes rejected by the last commit, and an event is sent when a commit completes.")]
+        public CommitMode ConfigCommit { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the SyncInterval register.
+        /// Creates a message payload for the ConfigCommit register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public byte GetPayload()
+        public CommitMode GetPayload()
         {
-            return SyncInterval;
+            return ConfigCommit;
         }
 
         /// <summary>
-        /// Creates a message that configures the interval in seconds between each sync pulse.
+        /// Creates a message that applies or discards the queued writes. The queued writes are applied in order with the interrupts disabled, and the modes take effect once, from the final values. Reads the number of queued writes rejected by the last commit, and an event is sent when a commit completes.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the SyncInterval register.</returns>
+        /// <returns>A new message for the ConfigCommit register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.SyncInterval.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.ConfigCommit.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures the interval in seconds between each sync pulse.
+    /// that applies or discards the queued writes. The queued writes are applied in order with the interrupts disabled, and the modes take effect once, from the final values. Reads the number of queued writes rejected by the last commit, and an event is sent when a commit completes.
     /// </summary>
-    [DisplayName("TimestampedSyncIntervalPayload")]
-    [Description("Creates a timestamped message payload that configures the interval in seconds between each sync pulse.")]
-    public partial class CreateTimestampedSyncIntervalPayload : CreateSyncIntervalPayload
+    [DisplayName("TimestampedConfigCommitPayload")]
+    [Description("Creates a timestamped message payload that applies or discards the queued writes. The queued writes are applied in order with the interrupts disabled, and the modes take effect once, from the final values. Reads the number of queued writes rejected by the last commit, and an event is sent when a commit completes.")]
+    public partial class CreateTimestampedConfigCommitPayload : CreateConfigCommitPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures the interval in seconds between each sync pulse.
+        /// Creates a timestamped message that applies or discards the queued writes. The queued writes are applied in order with the interrupts disabled, and the modes take effect once, from the final values. Reads the number of queued writes rejected by the last commit, and an event is sent when a commit completes.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the SyncInterval register.</returns>
+        /// <returns>A new timestamped message for the ConfigCommit register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.SyncInterval.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.ConfigCommit.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures the mode of the digital input line 0.
+    /// that packed device state in one reply, multi-byte fields little-endian. 0: OutputState, 1: DigitalInputState, 2-3: ChannelState, 4: ServoMoving, 5: DI0Mode, 6: Control0Mode, 7: Control1Mode, 8-9: Camera0Frequency, 10-11: Camera1Frequency, 12-13: Servo0Period, 14-15: Servo1Period, 16-17: Servo0PulseWidthFine, 18-19: Servo1PulseWidthFine, 20-23: Camera0 trigger count, 24-27: Camera1 trigger count, 28-31: ServoUnderruns, 32: EnableEvents, 33: ClockDiscipline, 34: SyncInterval, 35: ScheduleEnable. The trigger counts include every trigger pulse since the last reset, whether or not its event was sent.
     /// </summary>
-    [DisplayName("DI0ModePayload")]
-    [Description("Creates a message payload that configures the mode of the digital input line 0.")]
-    public partial class CreateDI0ModePayload
+    [DisplayName("SnapshotPayload")]
+    [Description("Creates a message payload that packed device state in one reply, multi-byte fields little-endian. 0: OutputState, 1: DigitalInputState, 2-3: ChannelState, 4: ServoMoving, 5: DI0Mode, 6: Control0Mode, 7: Control1Mode, 8-9: Camera0Frequency, 10-11: Camera1Frequency, 12-13: Servo0Period, 14-15: Servo1Period, 16-17: Servo0PulseWidthFine, 18-19: Servo1PulseWidthFine, 20-23: Camera0 trigger count, 24-27: Camera1 trigger count, 28-31: ServoUnderruns, 32: EnableEvents, 33: ClockDiscipline, 34: SyncInterval, 35: ScheduleEnable. The trigger counts include every trigger pulse since the last reset, whether or not its event was sent.")]
+    public partial class CreateSnapshotPayload
     {
         /// <summary>
-        /// Gets or sets the value that configures the mode of the digital input line 0.
+        /// Gets or sets the value that packed device state in one reply, multi-byte fields little-endian. 0: OutputState, 1: DigitalInputState, 2-3: ChannelState, 4: ServoMoving, 5: DI0Mode, 6: Control0Mode, 7: Control1Mode, 8-9: Camera0Frequency, 10-11: Camera1Frequency, 12-13: Servo0Period, 14-15: Servo1Period, 16-17: Servo0PulseWidthFine, 18-19: Servo1PulseWidthFine, 20-23: Camera0 trigger count, 24-27: Camera1 trigger count, 28-31: ServoUnderruns, 32: EnableEvents, 33: ClockDiscipline, 34: SyncInterval, 35: ScheduleEnable. The trigger counts include every trigger pulse since the last reset, whether or not its event was sent.
         /// </summary>
-        [Description("The value that configures the mode of the digital input line 0.")]
-        public DI0ModeConfig DI0Mode { get; set; }
+        [Description("The value that packed device state in one reply, multi-byte fields little-endian. 0: OutputState, 1: DigitalInputState, 2-3: ChannelState, 4: ServoMoving, 5: DI0Mode, 6: Control0Mode, 7: Control1Mode, 8-9: Camera0Frequency, 10-11: Camera1Frequency, 12-13: Servo0Period, 14-15: Servo1Period, 16-17: Servo0PulseWidthFine, 18-19: Servo1PulseWidthFine, 20-23: Camera0 trigger count, 24-27: Camera1 trigger count, 28-31: ServoUnderruns, 32: EnableEvents, 33: ClockDiscipline, 34: SyncInterval, 35: ScheduleEnable. The trigger counts include every trigger pulse since the last reset, whether or not its event was sent.")]
+        public byte[] Snapshot { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the DI0Mode register.
+        /// Creates a message payload for the Snapshot register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public DI0ModeConfig GetPayload()
+        public byte[] GetPayload()
         {
-            return DI0Mode;
+            return Snapshot;
         }
 
         /// <summary>
-        /// Creates a message that configures the mode of the digital input line 0.
+        /// Creates a message that packed device state in one reply, multi-byte fields little-endian. 0: OutputState, 1: DigitalInputState, 2-3: ChannelState, 4: ServoMoving, 5: DI0Mode, 6: Control0Mode, 7: Control1Mode, 8-9: Camera0Frequency, 10-11: Camera1Frequency, 12-13: Servo0Period, 14-15: Servo1Period, 16-17: Servo0PulseWidthFine, 18-19: Servo1PulseWidthFine, 20-23: Camera0 trigger count, 24-27: Camera1 trigger count, 28-31: ServoUnderruns, 32: EnableEvents, 33: ClockDiscipline, 34: SyncInterval, 35: ScheduleEnable. The trigger counts include every trigger pulse since the last reset, whether or not its event was sent.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the DI0Mode register.</returns>
+        /// <returns>A new message for the Snapshot register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.DI0Mode.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.Snapshot.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures the mode of the digital input line 0.
+    /// that packed device state in one reply, multi-byte fields little-endian. 0: OutputState, 1: DigitalInputState, 2-3: ChannelState, 4: ServoMoving, 5: DI0Mode, 6: Control0Mode, 7: Control1Mode, 8-9: Camera0Frequency, 10-11: Camera1Frequency, 12-13: Servo0Period, 14-15: Servo1Period, 16-17: Servo0PulseWidthFine, 18-19: Servo1PulseWidthFine, 20-23: Camera0 trigger count, 24-27: Camera1 trigger count, 28-31: ServoUnderruns, 32: EnableEvents, 33: ClockDiscipline, 34: SyncInterval, 35: ScheduleEnable. The trigger counts include every trigger pulse since the last reset, whether or not its event was sent.
     /// </summary>
-    [DisplayName("TimestampedDI0ModePayload")]
-    [Description("Creates a timestamped message payload that configures the mode of the digital input line 0.")]
-    public partial class CreateTimestampedDI0ModePayload : CreateDI0ModePayload
+    [DisplayName("TimestampedSnapshotPayload")]
+    [Description("Creates a timestamped message payload that packed device state in one reply, multi-byte fields little-endian. 0: OutputState, 1: DigitalInputState, 2-3: ChannelState, 4: ServoMoving, 5: DI0Mode, 6: Control0Mode, 7: Control1Mode, 8-9: Camera0Frequency, 10-11: Camera1Frequency, 12-13: Servo0Period, 14-15: Servo1Period, 16-17: Servo0PulseWidthFine, 18-19: Servo1PulseWidthFine, 20-23: Camera0 trigger count, 24-27: Camera1 trigger count, 28-31: ServoUnderruns, 32: EnableEvents, 33: ClockDiscipline, 34: SyncInterval, 35: ScheduleEnable. The trigger counts include every trigger pulse since the last reset, whether or not its event was sent.")]
+    public partial class CreateTimestampedSnapshotPayload : CreateSnapshotPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures the mode of the digital input line 0.
+        /// Creates a timestamped message that packed device state in one reply, multi-byte fields little-endian. 0: OutputState, 1: DigitalInputState, 2-3: ChannelState, 4: ServoMoving, 5: DI0Mode, 6: Control0Mode, 7: Control1Mode, 8-9: Camera0Frequency, 10-11: Camera1Frequency, 12-13: Servo0Period, 14-15: Servo1Period, 16-17: Servo0PulseWidthFine, 18-19: Servo1PulseWidthFine, 20-23: Camera0 trigger count, 24-27: Camera1 trigger count, 28-31: ServoUnderruns, 32: EnableEvents, 33: ClockDiscipline, 34: SyncInterval, 35: ScheduleEnable. The trigger counts include every trigger pulse since the last reset, whether or not its event was sent.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the DI0Mode register.</returns>
+        /// <returns>A new timestamped message for the Snapshot register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.DI0Mode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.Snapshot.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures the control mode of Camera/Servo 0.
+    /// that inverts the specified output lines in the port, so an active trigger, sync or servo pulse drives the line low and the line idles high. Use it for cameras that trigger on a falling edge or need an active-low trigger. The levels in OutputState and the events keep reporting the logic level, and the change applies at once, also to a running line.
     /// </summary>
-    [DisplayName("Control0ModePayload")]
-    [Description("Creates a message payload that configures the control mode of Camera/Servo 0.")]
-    public partial class CreateControl0ModePayload
+    [DisplayName("OutputInvertPayload")]
+    [Description("Creates a message payload that inverts the specified output lines in the port, so an active trigger, sync or servo pulse drives the line low and the line idles high. Use it for cameras that trigger on a falling edge or need an active-low trigger. The levels in OutputState and the events keep reporting the logic level, and the change applies at once, also to a running line.")]
+    public partial class CreateOutputInvertPayload
     {
         /// <summary>
-        /// Gets or sets the value that configures the control mode of Camera/Servo 0.
+        /// Gets or sets the value that inverts the specified output lines in the port, so an active trigger, sync or servo pulse drives the line low and the line idles high. Use it for cameras that trigger on a falling edge or need an active-low trigger. The levels in OutputState and the events keep reporting the logic level, and the change applies at once, also to a running line.
         /// </summary>
-        [Description("The value that configures the control mode of Camera/Servo 0.")]
-        public ControlModeConfig Control0Mode { get; set; }
+        [Description("The value that inverts the specified output lines in the port, so an active trigger, sync or servo pulse drives the line low and the line idles high. Use it for cameras that trigger on a falling edge or need an active-low trigger. The levels in OutputState and the events keep reporting the logic level, and the change applies at once, also to a running line.")]
+        public DigitalOutputs OutputInvert { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Control0Mode register.
+        /// Creates a message payload for the OutputInvert register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ControlModeConfig GetPayload()
+        public DigitalOutputs GetPayload()
         {
-            return Control0Mode;
+            return OutputInvert;
         }
 
         /// <summary>
-        /// Creates a message that configures the control mode of Camera/Servo 0.
+        /// Creates a message that inverts the specified output lines in the port, so an active trigger, sync or servo pulse drives the line low and the line idles high. Use it for cameras that trigger on a falling edge or need an active-low trigger. The levels in OutputState and the events keep reporting the logic level, and the change applies at once, also to a running line.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Control0Mode register.</returns>
+        /// <returns>A new message for the OutputInvert register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.Control0Mode.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.OutputInvert.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures the control mode of Camera/Servo 0.
+    /// that inverts the specified output lines in the port, so an active trigger, sync or servo pulse drives the line low and the line idles high. Use it for cameras that trigger on a falling edge or need an active-low trigger. The levels in OutputState and the events keep reporting the logic level, and the change applies at once, also to a running line.
     /// </summary>
-    [DisplayName("TimestampedControl0ModePayload")]
-    [Description("Creates a timestamped message payload that configures the control mode of Camera/Servo 0.")]
-    public partial class CreateTimestampedControl0ModePayload : CreateControl0ModePayload
+    [DisplayName("TimestampedOutputInvertPayload")]
+    [Description("Creates a timestamped message payload that inverts the specified output lines in the port, so an active trigger, sync or servo pulse drives the line low and the line idles high. Use it for cameras that trigger on a falling edge or need an active-low trigger. The levels in OutputState and the events keep reporting the logic level, and the change applies at once, also to a running line.")]
+    public partial class CreateTimestampedOutputInvertPayload : CreateOutputInvertPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures the control mode of Camera/Servo 0.
+        /// Creates a timestamped message that inverts the specified output lines in the port, so an active trigger, sync or servo pulse drives the line low and the line idles high. Use it for cameras that trigger on a falling edge or need an active-low trigger. The levels in OutputState and the events keep reporting the logic level, and the change applies at once, also to a running line.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Control0Mode register.</returns>
+        /// <returns>A new timestamped message for the OutputInvert register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.Control0Mode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.OutputInvert.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode.
+    /// that execution time of the ISR selected by IsrProfileSlot in CPU cycles (31.25 ns), from firmware built with ISR_PROFILING defined. Otherwise the register reads all zeros. Count (saturated), min, max, mean, then a histogram of counts below 32, 64, 128, 256, 512, 1024 and 2048 cycles and from 2048 cycles.
     /// </summary>
-    [DisplayName("Camera0FrequencyPayload")]
-    [Description("Creates a message payload that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode.")]
-    public partial class CreateCamera0FrequencyPayload
+    [DisplayName("IsrProfilePayload")]
+    [Description("Creates a message payload that execution time of the ISR selected by IsrProfileSlot in CPU cycles (31.25 ns), from firmware built with ISR_PROFILING defined. Otherwise the register reads all zeros. Count (saturated), min, max, mean, then a histogram of counts below 32, 64, 128, 256, 512, 1024 and 2048 cycles and from 2048 cycles.")]
+    public partial class CreateIsrProfilePayload
     {
         /// <summary>
-        /// Gets or sets the value that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode.
+        /// Gets or sets the value that execution time of the ISR selected by IsrProfileSlot in CPU cycles (31.25 ns), from firmware built with ISR_PROFILING defined. Otherwise the register reads all zeros. Count (saturated), min, max, mean, then a histogram of counts below 32, 64, 128, 256, 512, 1024 and 2048 cycles and from 2048 cycles.
         /// </summary>
-        [Range(min: 1, max: 600)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode.")]
-        public ushort Camera0Frequency { get; set; } = 1;
+        [Description("The value that execution time of the ISR selected by IsrProfileSlot in CPU cycles (31.25 ns), from firmware built with ISR_PROFILING defined. Otherwise the register reads all zeros. Count (saturated), min, max, mean, then a histogram of counts below 32, 64, 128, 256, 512, 1024 and 2048 cycles and from 2048 cycles.")]
+        public ushort[] IsrProfile { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Camera0Frequency register.
+        /// Creates a message payload for the IsrProfile register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return Camera0Frequency;
+            return IsrProfile;
         }
 
         /// <summary>
-        /// Creates a message that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode.
+        /// Creates a message that execution time of the ISR selected by IsrProfileSlot in CPU cycles (31.25 ns), from firmware built with ISR_PROFILING defined. Otherwise the register reads all zeros. Count (saturated), min, max, mean, then a histogram of counts below 32, 64, 128, 256, 512, 1024 and 2048 cycles and from 2048 cycles.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Camera0Frequency register.</returns>
+        /// <returns>A new message for the IsrProfile register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.Camera0Frequency.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.IsrProfile.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode.
+    /// that execution time of the ISR selected by IsrProfileSlot in CPU cycles (31.25 ns), from firmware built with ISR_PROFILING defined. Otherwise the register reads all zeros. Count (saturated), min, max, mean, then a histogram of counts below 32, 64, 128, 256, 512, 1024 and 2048 cycles and from 2048 cycles.
     /// </summary>
-    [DisplayName("TimestampedCamera0FrequencyPayload")]
-    [Description("Creates a timestamped message payload that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode.")]
-    public partial class CreateTimestampedCamera0FrequencyPayload : CreateCamera0FrequencyPayload
+    [DisplayName("TimestampedIsrProfilePayload")]
+    [Description("Creates a timestamped message payload that execution time of the ISR selected by IsrProfileSlot in CPU cycles (31.25 ns), from firmware built with ISR_PROFILING defined. Otherwise the register reads all zeros. Count (saturated), min, max, mean, then a histogram of counts below 32, 64, 128, 256, 512, 1024 and 2048 cycles and from 2048 cycles.")]
+    public partial class CreateTimestampedIsrProfilePayload : CreateIsrProfilePayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures the frequency (Hz) of the trigger pulses on Camera 0 when using Camera mode.
+        /// Creates a timestamped message that execution time of the ISR selected by IsrProfileSlot in CPU cycles (31.25 ns), from firmware built with ISR_PROFILING defined. Otherwise the register reads all zeros. Count (saturated), min, max, mean, then a histogram of counts below 32, 64, 128, 256, 512, 1024 and 2048 cycles and from 2048 cycles.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Camera0Frequency register.</returns>
+        /// <returns>A new timestamped message for the IsrProfile register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.Camera0Frequency.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.IsrProfile.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).
+    /// that write 1 to clear the ISR execution time statistics.
     /// </summary>
-    [DisplayName("Servo0PeriodPayload")]
-    [Description("Creates a message payload that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).")]
-    public partial class CreateServo0PeriodPayload
+    [DisplayName("IsrProfileResetPayload")]
+    [Description("Creates a message payload that write 1 to clear the ISR execution time statistics.")]
+    public partial class CreateIsrProfileResetPayload
     {
         /// <summary>
-        /// Gets or sets the value that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).
+        /// Gets or sets the value that write 1 to clear the ISR execution time statistics.
         /// </summary>
-        [Description("The value that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).")]
-        public ushort Servo0Period { get; set; }
+        [Description("The value that write 1 to clear the ISR execution time statistics.")]
+        public byte IsrProfileReset { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Servo0Period register.
+        /// Creates a message payload for the IsrProfileReset register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public byte GetPayload()
         {
-            return Servo0Period;
+            return IsrProfileReset;
         }
 
         /// <summary>
-        /// Creates a message that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).
+        /// Creates a message that write 1 to clear the ISR execution time statistics.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Servo0Period register.</returns>
+        /// <returns>A new message for the IsrProfileReset register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.Servo0Period.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.IsrProfileReset.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).
+    /// that write 1 to clear the ISR execution time statistics.
     /// </summary>
-    [DisplayName("TimestampedServo0PeriodPayload")]
-    [Description("Creates a timestamped message payload that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).")]
-    public partial class CreateTimestampedServo0PeriodPayload : CreateServo0PeriodPayload
+    [DisplayName("TimestampedIsrProfileResetPayload")]
+    [Description("Creates a timestamped message payload that write 1 to clear the ISR execution time statistics.")]
+    public partial class CreateTimestampedIsrProfileResetPayload : CreateIsrProfileResetPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).
+        /// Creates a timestamped message that write 1 to clear the ISR execution time statistics.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Servo0Period register.</returns>
+        /// <returns>A new timestamped message for the IsrProfileReset register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.Servo0Period.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.IsrProfileReset.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).
+    /// that selects the trigger line whose rising edges are fed back to TCE0 to measure the actual trigger period. Only periods of a line in Camera mode are measured. The write fails while DI0 is used as an external clock, and starting the external clock turns the measurement off.
     /// </summary>
-    [DisplayName("Servo0PulseWidthPayload")]
-    [Description("Creates a message payload that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).")]
-    public partial class CreateServo0PulseWidthPayload
+    [DisplayName("TriggerJitterModePayload")]
+    [Description("Creates a message payload that selects the trigger line whose rising edges are fed back to TCE0 to measure the actual trigger period. Only periods of a line in Camera mode are measured. The write fails while DI0 is used as an external clock, and starting the external clock turns the measurement off.")]
+    public partial class CreateTriggerJitterModePayload
     {
         /// <summary>
-        /// Gets or sets the value that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).
+        /// Gets or sets the value that selects the trigger line whose rising edges are fed back to TCE0 to measure the actual trigger period. Only periods of a line in Camera mode are measured. The write fails while DI0 is used as an external clock, and starting the external clock turns the measurement off.
         /// </summary>
-        [Description("The value that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).")]
-        public ushort Servo0PulseWidth { get; set; }
+        [Description("The value that selects the trigger line whose rising edges are fed back to TCE0 to measure the actual trigger period. Only periods of a line in Camera mode are measured. The write fails while DI0 is used as an external clock, and starting the external clock turns the measurement off.")]
+        public TriggerJitterModeConfig TriggerJitterMode { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Servo0PulseWidth register.
+        /// Creates a message payload for the TriggerJitterMode register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public TriggerJitterModeConfig GetPayload()
         {
-            return Servo0PulseWidth;
+            return TriggerJitterMode;
         }
 
         /// <summary>
-        /// Creates a message that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).
+        /// Creates a message that selects the trigger line whose rising edges are fed back to TCE0 to measure the actual trigger period. Only periods of a line in Camera mode are measured. The write fails while DI0 is used as an external clock, and starting the external clock turns the measurement off.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Servo0PulseWidth register.</returns>
+        /// <returns>A new message for the TriggerJitterMode register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.Servo0PulseWidth.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.TriggerJitterMode.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).
+    /// that selects the trigger line whose rising edges are fed back to TCE0 to measure the actual trigger period. Only periods of a line in Camera mode are measured. The write fails while DI0 is used as an external clock, and starting the external clock turns the measurement off.
     /// </summary>
-    [DisplayName("TimestampedServo0PulseWidthPayload")]
-    [Description("Creates a timestamped message payload that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).")]
-    public partial class CreateTimestampedServo0PulseWidthPayload : CreateServo0PulseWidthPayload
+    [DisplayName("TimestampedTriggerJitterModePayload")]
+    [Description("Creates a timestamped message payload that selects the trigger line whose rising edges are fed back to TCE0 to measure the actual trigger period. Only periods of a line in Camera mode are measured. The write fails while DI0 is used as an external clock, and starting the external clock turns the measurement off.")]
+    public partial class CreateTimestampedTriggerJitterModePayload : CreateTriggerJitterModePayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).
+        /// Creates a timestamped message that selects the trigger line whose rising edges are fed back to TCE0 to measure the actual trigger period. Only periods of a line in Camera mode are measured. The write fails while DI0 is used as an external clock, and starting the external clock turns the measurement off.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Servo0PulseWidth register.</returns>
+        /// <returns>A new timestamped message for the TriggerJitterMode register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.Servo0PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.TriggerJitterMode.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures the control mode of Camera/Servo 1.
+    /// that periods further than this from the nominal period of the camera frequency are counted as outliers (ns). Applied from the next Harp second.
     /// </summary>
-    [DisplayName("Control1ModePayload")]
-    [Description("Creates a message payload that configures the control mode of Camera/Servo 1.")]
-    public partial class CreateControl1ModePayload
+    [DisplayName("TriggerJitterThresholdPayload")]
+    [Description("Creates a message payload that periods further than this from the nominal period of the camera frequency are counted as outliers (ns). Applied from the next Harp second.")]
+    public partial class CreateTriggerJitterThresholdPayload
     {
         /// <summary>
-        /// Gets or sets the value that configures the control mode of Camera/Servo 1.
+        /// Gets or sets the value that periods further than this from the nominal period of the camera frequency are counted as outliers (ns). Applied from the next Harp second.
         /// </summary>
-        [Description("The value that configures the control mode of Camera/Servo 1.")]
-        public ControlModeConfig Control1Mode { get; set; }
+        [Description("The value that periods further than this from the nominal period of the camera frequency are counted as outliers (ns). Applied from the next Harp second.")]
+        public ushort TriggerJitterThreshold { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Control1Mode register.
+        /// Creates a message payload for the TriggerJitterThreshold register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ControlModeConfig GetPayload()
+        public ushort GetPayload()
         {
-            return Control1Mode;
+            return TriggerJitterThreshold;
         }
 
         /// <summary>
-        /// Creates a message that configures the control mode of Camera/Servo 1.
+        /// Creates a message that periods further than this from the nominal period of the camera frequency are counted as outliers (ns). Applied from the next Harp second.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Control1Mode register.</returns>
+        /// <returns>A new message for the TriggerJitterThreshold register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.Control1Mode.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.TriggerJitterThreshold.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures the control mode of Camera/Servo 1.
+    /// that periods further than this from the nominal period of the camera frequency are counted as outliers (ns). Applied from the next Harp second.
     /// </summary>
-    [DisplayName("TimestampedControl1ModePayload")]
-    [Description("Creates a timestamped message payload that configures the control mode of Camera/Servo 1.")]
-    public partial class CreateTimestampedControl1ModePayload : CreateControl1ModePayload
+    [DisplayName("TimestampedTriggerJitterThresholdPayload")]
+    [Description("Creates a timestamped message payload that periods further than this from the nominal period of the camera frequency are counted as outliers (ns). Applied from the next Harp second.")]
+    public partial class CreateTimestampedTriggerJitterThresholdPayload : CreateTriggerJitterThresholdPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures the control mode of Camera/Servo 1.
+        /// Creates a timestamped message that periods further than this from the nominal period of the camera frequency are counted as outliers (ns). Applied from the next Harp second.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Control1Mode register.</returns>
+        /// <returns>A new timestamped message for the TriggerJitterThreshold register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.Control1Mode.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.TriggerJitterThreshold.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode.
+    /// that trigger period statistics of the last Harp second, updated and sent as an event each second while enabled: count, mean (ns), standard deviation (ns), min (ns), max (ns) and outliers. Deviations beyond 1023 ticks of the measurement time base are clamped for the mean and standard deviation and counted as outliers.
     /// </summary>
-    [DisplayName("Camera1FrequencyPayload")]
-    [Description("Creates a message payload that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode.")]
-    public partial class CreateCamera1FrequencyPayload
+    [DisplayName("TriggerJitterStatsPayload")]
+    [Description("Creates a message payload that trigger period statistics of the last Harp second, updated and sent as an event each second while enabled: count, mean (ns), standard deviation (ns), min (ns), max (ns) and outliers. Deviations beyond 1023 ticks of the measurement time base are clamped for the mean and standard deviation and counted as outliers.")]
+    public partial class CreateTriggerJitterStatsPayload
     {
         /// <summary>
-        /// Gets or sets the value that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode.
+        /// Gets or sets the value that trigger period statistics of the last Harp second, updated and sent as an event each second while enabled: count, mean (ns), standard deviation (ns), min (ns), max (ns) and outliers. Deviations beyond 1023 ticks of the measurement time base are clamped for the mean and standard deviation and counted as outliers.
         /// </summary>
-        [Range(min: 1, max: 600)]
-        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
-        [Description("The value that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode.")]
-        public ushort Camera1Frequency { get; set; } = 1;
+        [Description("The value that trigger period statistics of the last Harp second, updated and sent as an event each second while enabled: count, mean (ns), standard deviation (ns), min (ns), max (ns) and outliers. Deviations beyond 1023 ticks of the measurement time base are clamped for the mean and standard deviation and counted as outliers.")]
+        public uint[] TriggerJitterStats { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Camera1Frequency register.
+        /// Creates a message payload for the TriggerJitterStats register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public uint[] GetPayload()
         {
-            return Camera1Frequency;
+            return TriggerJitterStats;
         }
 
         /// <summary>
-        /// Creates a message that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode.
+        /// Creates a message that trigger period statistics of the last Harp second, updated and sent as an event each second while enabled: count, mean (ns), standard deviation (ns), min (ns), max (ns) and outliers. Deviations beyond 1023 ticks of the measurement time base are clamped for the mean and standard deviation and counted as outliers.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Camera1Frequency register.</returns>
+        /// <returns>A new message for the TriggerJitterStats register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.Camera1Frequency.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.TriggerJitterStats.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode.
+    /// that trigger period statistics of the last Harp second, updated and sent as an event each second while enabled: count, mean (ns), standard deviation (ns), min (ns), max (ns) and outliers. Deviations beyond 1023 ticks of the measurement time base are clamped for the mean and standard deviation and counted as outliers.
     /// </summary>
-    [DisplayName("TimestampedCamera1FrequencyPayload")]
-    [Description("Creates a timestamped message payload that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode.")]
-    public partial class CreateTimestampedCamera1FrequencyPayload : CreateCamera1FrequencyPayload
+    [DisplayName("TimestampedTriggerJitterStatsPayload")]
+    [Description("Creates a timestamped message payload that trigger period statistics of the last Harp second, updated and sent as an event each second while enabled: count, mean (ns), standard deviation (ns), min (ns), max (ns) and outliers. Deviations beyond 1023 ticks of the measurement time base are clamped for the mean and standard deviation and counted as outliers.")]
+    public partial class CreateTimestampedTriggerJitterStatsPayload : CreateTriggerJitterStatsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures the frequency (Hz) of the trigger pulses on Camera 1 when using Camera mode.
+        /// Creates a timestamped message that trigger period statistics of the last Harp second, updated and sent as an event each second while enabled: count, mean (ns), standard deviation (ns), min (ns), max (ns) and outliers. Deviations beyond 1023 ticks of the measurement time base are clamped for the mean and standard deviation and counted as outliers.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Camera1Frequency register.</returns>
+        /// <returns>A new timestamped message for the TriggerJitterStats register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.Camera1Frequency.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.TriggerJitterStats.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).
+    /// that bytes of RAM above the variables that the stack has not reached since the reset, the headroom left after the deepest ISR nesting seen so far.
     /// </summary>
-    [DisplayName("Servo1PeriodPayload")]
-    [Description("Creates a message payload that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).")]
-    public partial class CreateServo1PeriodPayload
+    [DisplayName("StackFreePayload")]
+    [Description("Creates a message payload that bytes of RAM above the variables that the stack has not reached since the reset, the headroom left after the deepest ISR nesting seen so far.")]
+    public partial class CreateStackFreePayload
     {
         /// <summary>
-        /// Gets or sets the value that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).
+        /// Gets or sets the value that bytes of RAM above the variables that the stack has not reached since the reset, the headroom left after the deepest ISR nesting seen so far.
         /// </summary>
-        [Description("The value that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).")]
-        public ushort Servo1Period { get; set; }
+        [Description("The value that bytes of RAM above the variables that the stack has not reached since the reset, the headroom left after the deepest ISR nesting seen so far.")]
+        public ushort StackFree { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Servo1Period register.
+        /// Creates a message payload for the StackFree register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
         public ushort GetPayload()
         {
-            return Servo1Period;
+            return StackFree;
         }
 
         /// <summary>
-        /// Creates a message that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).
+        /// Creates a message that bytes of RAM above the variables that the stack has not reached since the reset, the headroom left after the deepest ISR nesting seen so far.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Servo1Period register.</returns>
+        /// <returns>A new message for the StackFree register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.Servo1Period.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.StackFree.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).
+    /// that bytes of RAM above the variables that the stack has not reached since the reset, the headroom left after the deepest ISR nesting seen so far.
     /// </summary>
-    [DisplayName("TimestampedServo1PeriodPayload")]
-    [Description("Creates a timestamped message payload that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).")]
-    public partial class CreateTimestampedServo1PeriodPayload : CreateServo1PeriodPayload
+    [DisplayName("TimestampedStackFreePayload")]
+    [Description("Creates a timestamped message payload that bytes of RAM above the variables that the stack has not reached since the reset, the headroom left after the deepest ISR nesting seen so far.")]
+    public partial class CreateTimestampedStackFreePayload : CreateStackFreePayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures the servo motor period (us) when using Servo mode (sensitive to 2 us).
+        /// Creates a timestamped message that bytes of RAM above the variables that the stack has not reached since the reset, the headroom left after the deepest ISR nesting seen so far.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Servo1Period register.</returns>
+        /// <returns>A new timestamped message for the StackFree register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.Servo1Period.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.StackFree.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).
+    /// that reports the number of DI0 edges skipped on each camera since ExternalClock or OneShot mode was started. An edge is skipped when the DI0 interrupt comes too late to arm the trigger before the delay elapses, or when the DI0 period over the multiplier is out of range.
     /// </summary>
-    [DisplayName("Servo1PulseWidthPayload")]
-    [Description("Creates a message payload that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).")]
-    public partial class CreateServo1PulseWidthPayload
+    [DisplayName("ExternalClockSkipsPayload")]
+    [Description("Creates a message payload that reports the number of DI0 edges skipped on each camera since ExternalClock or OneShot mode was started. An edge is skipped when the DI0 interrupt comes too late to arm the trigger before the delay elapses, or when the DI0 period over the multiplier is out of range.")]
+    public partial class CreateExternalClockSkipsPayload
     {
         /// <summary>
-        /// Gets or sets the value that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).
+        /// Gets or sets the value that reports the number of DI0 edges skipped on each camera since ExternalClock or OneShot mode was started. An edge is skipped when the DI0 interrupt comes too late to arm the trigger before the delay elapses, or when the DI0 period over the multiplier is out of range.
         /// </summary>
-        [Description("The value that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).")]
-        public ushort Servo1PulseWidth { get; set; }
+        [Description("The value that reports the number of DI0 edges skipped on each camera since ExternalClock or OneShot mode was started. An edge is skipped when the DI0 interrupt comes too late to arm the trigger before the delay elapses, or when the DI0 period over the multiplier is out of range.")]
+        public ushort[] ExternalClockSkips { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the Servo1PulseWidth register.
+        /// Creates a message payload for the ExternalClockSkips register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public ushort GetPayload()
+        public ushort[] GetPayload()
         {
-            return Servo1PulseWidth;
+            return ExternalClockSkips;
         }
 
         /// <summary>
-        /// Creates a message that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).
+        /// Creates a message that reports the number of DI0 edges skipped on each camera since ExternalClock or OneShot mode was started. An edge is skipped when the DI0 interrupt comes too late to arm the trigger before the delay elapses, or when the DI0 period over the multiplier is out of range.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the Servo1PulseWidth register.</returns>
+        /// <returns>A new message for the ExternalClockSkips register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.Servo1PulseWidth.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.ExternalClockSkips.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).
+    /// that reports the number of DI0 edges skipped on each camera since ExternalClock or OneShot mode was started. An edge is skipped when the DI0 interrupt comes too late to arm the trigger before the delay elapses, or when the DI0 period over the multiplier is out of range.
     /// </summary>
-    [DisplayName("TimestampedServo1PulseWidthPayload")]
-    [Description("Creates a timestamped message payload that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).")]
-    public partial class CreateTimestampedServo1PulseWidthPayload : CreateServo1PulseWidthPayload
+    [DisplayName("TimestampedExternalClockSkipsPayload")]
+    [Description("Creates a timestamped message payload that reports the number of DI0 edges skipped on each camera since ExternalClock or OneShot mode was started. An edge is skipped when the DI0 interrupt comes too late to arm the trigger before the delay elapses, or when the DI0 period over the multiplier is out of range.")]
+    public partial class CreateTimestampedExternalClockSkipsPayload : CreateExternalClockSkipsPayload
     {
         /// <summary>
-        /// Creates a timestamped message that configures the servo pulse width (us) when using Servo mode (sensitive to 2 us).
+        /// Creates a timestamped message that reports the number of DI0 edges skipped on each camera since ExternalClock or OneShot mode was started. An edge is skipped when the DI0 interrupt comes too late to arm the trigger before the delay elapses, or when the DI0 period over the multiplier is out of range.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the Servo1PulseWidth register.</returns>
+        /// <returns>A new timestamped message for the ExternalClockSkips register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.Servo1PulseWidth.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.ExternalClockSkips.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a message payload
-    /// that specifies the active events in the device.
+    /// that selects the ISR reported by IsrProfile: 0 DI0 edges, 1 Camera0/Servo0 period, 2 Camera1/Servo1 period, 3 Camera0 compare, 4 Camera1 compare, 5 trigger jitter capture.
     /// </summary>
-    [DisplayName("EnableEventsPayload")]
-    [Description("Creates a message payload that specifies the active events in the device.")]
-    public partial class CreateEnableEventsPayload
+    [DisplayName("IsrProfileSlotPayload")]
+    [Description("Creates a message payload that selects the ISR reported by IsrProfile: 0 DI0 edges, 1 Camera0/Servo0 period, 2 Camera1/Servo1 period, 3 Camera0 compare, 4 Camera1 compare, 5 trigger jitter capture.")]
+    public partial class CreateIsrProfileSlotPayload
     {
         /// <summary>
-        /// Gets or sets the value that specifies the active events in the device.
+        /// Gets or sets the value that selects the ISR reported by IsrProfile: 0 DI0 edges, 1 Camera0/Servo0 period, 2 Camera1/Servo1 period, 3 Camera0 compare, 4 Camera1 compare, 5 trigger jitter capture.
         /// </summary>
-        [Description("The value that specifies the active events in the device.")]
-        public CameraControllerEvents EnableEvents { get; set; }
+        [Range(min: 0, max: 5)]
+        [Editor(DesignTypes.NumericUpDownEditor, DesignTypes.UITypeEditor)]
+        [Description("The value that selects the ISR reported by IsrProfile: 0 DI0 edges, 1 Camera0/Servo0 period, 2 Camera1/Servo1 period, 3 Camera0 compare, 4 Camera1 compare, 5 trigger jitter capture.")]
+        public byte IsrProfileSlot { get; set; }
 
         /// <summary>
-        /// Creates a message payload for the EnableEvents register.
+        /// Creates a message payload for the IsrProfileSlot register.
         /// </summary>
         /// <returns>The created message payload value.</returns>
-        public CameraControllerEvents GetPayload()
+        public byte GetPayload()
         {
-            return EnableEvents;
+            return IsrProfileSlot;
         }
 
         /// <summary>
-        /// Creates a message that specifies the active events in the device.
+        /// Creates a message that selects the ISR reported by IsrProfile: 0 DI0 edges, 1 Camera0/Servo0 period, 2 Camera1/Servo1 period, 3 Camera0 compare, 4 Camera1 compare, 5 trigger jitter capture.
         /// </summary>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new message for the EnableEvents register.</returns>
+        /// <returns>A new message for the IsrProfileSlot register.</returns>
         public HarpMessage GetMessage(MessageType messageType)
         {
-            return Harp.CameraController.EnableEvents.FromPayload(messageType, GetPayload());
+            return Harp.CameraController.IsrProfileSlot.FromPayload(messageType, GetPayload());
         }
     }
 
     /// <summary>
     /// Represents an operator that creates a timestamped message payload
-    /// that specifies the active events in the device.
+    /// that selects the ISR reported by IsrProfile: 0 DI0 edges, 1 Camera0/Servo0 period, 2 Camera1/Servo1 period, 3 Camera0 compare, 4 Camera1 compare, 5 trigger jitter capture.
     /// </summary>
-    [DisplayName("TimestampedEnableEventsPayload")]
-    [Description("Creates a timestamped message payload that specifies the active events in the device.")]
-    public partial class CreateTimestampedEnableEventsPayload : CreateEnableEventsPayload
+    [DisplayName("TimestampedIsrProfileSlotPayload")]
+    [Description("Creates a timestamped message payload that selects the ISR reported by IsrProfile: 0 DI0 edges, 1 Camera0/Servo0 period, 2 Camera1/Servo1 period, 3 Camera0 compare, 4 Camera1 compare, 5 trigger jitter capture.")]
+    public partial class CreateTimestampedIsrProfileSlotPayload : CreateIsrProfileSlotPayload
     {
         /// <summary>
-        /// Creates a timestamped message that specifies the active events in the device.
+        /// Creates a timestamped message that selects the ISR reported by IsrProfile: 0 DI0 edges, 1 Camera0/Servo0 period, 2 Camera1/Servo1 period, 3 Camera0 compare, 4 Camera1 compare, 5 trigger jitter capture.
         /// </summary>
         /// <param name="timestamp">The timestamp of the message payload, in seconds.</param>
         /// <param name="messageType">Specifies the type of the created message.</param>
-        /// <returns>A new timestamped message for the EnableEvents register.</returns>
+        /// <returns>A new timestamped message for the IsrProfileSlot register.</returns>
         public HarpMessage GetMessage(double timestamp, MessageType messageType)
         {
-            return Harp.CameraController.EnableEvents.FromPayload(timestamp, messageType, GetPayload());
+            return Harp.CameraController.IsrProfileSlot.FromPayload(timestamp, messageType, GetPayload());
         }
     }
 
@@ -4208,7 +13593,79 @@ namespace Harp.CameraController
         /// <summary>
         /// Enables DigitalInputs
         /// </summary>
-        DigitalInputs = 0x2
+        DigitalInputs = 0x2,
+
+        /// <summary>
+        /// Enables ScheduleWindows events.
+        /// </summary>
+        ScheduleWindows = 0x4,
+
+        /// <summary>
+        /// Enables ServoMoving events.
+        /// </summary>
+        ServoMoving = 0x8,
+
+        /// <summary>
+        /// Enables ServoUnderruns events.
+        /// </summary>
+        ServoUnderruns = 0x10,
+
+        /// <summary>
+        /// Enables ChannelState events.
+        /// </summary>
+        ChannelState = 0x20,
+
+        /// <summary>
+        /// Enables ConfigCommit events.
+        /// </summary>
+        ConfigCommit = 0x40,
+
+        /// <summary>
+        /// Enables TriggerJitterStats events.
+        /// </summary>
+        TriggerJitter = 0x80
+    }
+
+    /// <summary>
+    /// Specifies the trigger line measured through the loopback.
+    /// </summary>
+    public enum TriggerJitterModeConfig : byte
+    {
+        /// <summary>
+        /// No trigger period measurement.
+        /// </summary>
+        Disabled = 0,
+
+        /// <summary>
+        /// Measures the Camera0 trigger period.
+        /// </summary>
+        Camera0 = 1,
+
+        /// <summary>
+        /// Measures the Camera1 trigger period.
+        /// </summary>
+        Camera1 = 2
+    }
+
+    /// <summary>
+    /// Specifies how the queued writes are handled.
+    /// </summary>
+    public enum CommitMode : byte
+    {
+        /// <summary>
+        /// Drops the queued writes.
+        /// </summary>
+        Discard = 0,
+
+        /// <summary>
+        /// Applies the queued writes at once.
+        /// </summary>
+        Now = 1,
+
+        /// <summary>
+        /// Applies the queued writes on the next Harp second.
+        /// </summary>
+        NextSecond = 2
     }
 
     /// <summary>
@@ -4265,6 +13722,53 @@ namespace Harp.CameraController
         /// <summary>
         /// Enables Servo mode and it will produce the configured trigger.
         /// </summary>
-        Servo = 1
+        Servo = 1,
+
+        /// <summary>
+        /// Enables ExternalClock mode and triggers will be derived from the DI0 rising edges. DI0 only reports rising edges while in use.
+        /// </summary>
+        ExternalClock = 2,
+
+        /// <summary>
+        /// Enables OneShot mode and a single trigger will be produced after the next DI0 rising edge, using the configured delay and width. The trigger event reports the time of the DI0 edge.
+        /// </summary>
+        OneShot = 3,
+
+        /// <summary>
+        /// Enables Sequence mode and the triggers will follow the configured sequence of intervals, streamed to the timer by DMA.
+        /// </summary>
+        Sequence = 4
+    }
+
+    /// <summary>
+    /// Specifies the timebase used by the camera triggers.
+    /// </summary>
+    public enum ClockDisciplineConfig : byte
+    {
+        /// <summary>
+        /// The camera triggers use the local oscillator.
+        /// </summary>
+        Disabled = 0,
+
+        /// <summary>
+        /// The camera trigger periods are continuously trimmed to follow the Harp clock.
+        /// </summary>
+        HarpClock = 1
+    }
+
+    /// <summary>
+    /// Specifies the motion profile of the servo motor moves.
+    /// </summary>
+    public enum MotionProfileConfig : byte
+    {
+        /// <summary>
+        /// Constant acceleration up to the maximum velocity and constant deceleration to the target.
+        /// </summary>
+        Trapezoidal = 0,
+
+        /// <summary>
+        /// Smooth velocity and acceleration with no jumps at the start and end of the move.
+        /// </summary>
+        SCurve = 1
     }
 }